@@ -177,6 +177,16 @@ extern "C" {
 */
 #include "dart_synchronization.h"
 
+/*
+   --- DART event tracing ---
+*/
+#include "dart_trace.h"
+
+/*
+   --- DART communication statistics ---
+*/
+#include "dart_stats.h"
+
 
 #ifdef __cplusplus
 } // extern "C"
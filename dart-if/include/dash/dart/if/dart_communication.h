@@ -165,6 +165,74 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoall.
+ *
+ * Every unit sends the \c i-th block of \c nelem values in \c sendbuf to
+ * unit \c i and receives the block sent by unit \c i in the \c i-th block
+ * of \c recvbuf.
+ *
+ * \param sendbuf The buffer containing \c nelem values for every unit in
+ *                the team, in unit order. Transfer is performed in-place
+ *                if \c sendbuf is identical to a non-NULL \c recvbuf.
+ * \param recvbuf The buffer to hold \c nelem values received from every
+ *                unit in the team, in unit order.
+ * \param nelem   Number of values sent to and received from every unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * Counts and displacements exceeding \c INT_MAX at any unit require a
+ * different exchange at all units. To agree on the exchange, every call
+ * performs an allreduce on the team before the data is exchanged, which
+ * roughly doubles the latency of small exchanges.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to every
+ *                    unit. Transfer is performed in-place if \c sendbuf is
+ *                    identical to a non-NULL \c recvbuf. \c sendbuf may
+ *                    be \c NULL if all counts in \c nsendelem are zero.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit. Not referenced in in-place transfers.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf. Not referenced in in-place
+ *                    transfers.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param team        The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -213,6 +281,61 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Scan.
+ *
+ * Computes the inclusive prefix reduction of the values in \c sendbuf
+ * over the units \c 0 ... \c i of the team and stores it in \c recvbuf of
+ * unit \c i.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of the element-wise operation \c op in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_scan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Exscan.
+ *
+ * Computes the exclusive prefix reduction of the values in \c sendbuf
+ * over the units \c 0 ... \c i-1 of the team and stores it in \c recvbuf
+ * of unit \c i.
+ * The content of \c recvbuf at unit \c 0 is undefined.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of the element-wise operation \c op in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
 /** \} */
 
 /**
@@ -277,6 +400,43 @@ dart_ret_t dart_accumulate_blocking_local(
   dart_datatype_t  dtype,
   dart_operation_t op) DART_NOTHROW;
 
+/**
+ * Perform an element-wise atomic update on \c nelem scattered elements
+ * relative to \c gptr by applying the operation \c op with the
+ * corresponding value in \c values on them.
+ * Element \c i is located at element offset \c offsets[i] from \c gptr.
+ * Offsets must be unique.
+ *
+ * DART Equivalent to MPI_Accumulate with an indexed target datatype,
+ * all updates are issued in a single operation.
+ * Like \ref dart_accumulate, the operation is only guaranteed to be
+ * completed after a call to \ref dart_flush and the buffer \c values must
+ * not be modified before a call to \ref dart_flush_local. The buffer
+ * \c offsets may be reused after return.
+ *
+ * \param gptr    A global pointer determining the target unit and the
+ *                base address of the accumulate operation.
+ * \param values  The local buffer holding the elements to accumulate.
+ * \param offsets The element offsets of the target elements relative to
+ *                \c gptr.
+ * \param nelem   The number of elements to accumulate.
+ * \param dtype   The data type to use in the accumulate operation \c op,
+ *                must be a basic type.
+ * \param op      The accumulation operation to perform.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_accumulate_indexed(
+  dart_gptr_t      gptr,
+  const void     * values,
+  const uint64_t * offsets,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op) DART_NOTHROW;
+
 /**
  * Perform an element-wise atomic update on the value of type \c dtype pointed
  * to by \c gptr by applying the operation \c op with \c value on it and
@@ -477,7 +637,7 @@ dart_ret_t dart_flush_local_all(
 /** \} */
 
 /**
- * \name Non-blocking single-sided communication operations using handles
+ * \name Non-blocking communication operations using handles
  * The handle can be used to wait for a specific operation to complete using \c wait functions.
  */
 
@@ -547,6 +707,104 @@ dart_ret_t dart_put_handle(
   dart_datatype_t   dst_type,
   dart_handle_t   * handle) DART_NOTHROW;
 
+/**
+ * Non-blocking variant of \c dart_barrier.
+ * Completion of the barrier is determined using \c dart_wait,
+ * \c dart_test and the like, handles of collective operations can be
+ * mixed with handles of one-sided operations in \c dart_waitall and
+ * \c dart_testall.
+ *
+ * \param team       The team to perform the barrier on.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_bcast.
+ * The content of \c buf must not be accessed before completion of the
+ * operation.
+ *
+ * \param buf        Buffer that is the source (root) or the destination
+ *                   of the broadcast.
+ * \param nelem      The number of elements of type \c dtype in \c buf.
+ * \param dtype      The data type of values in \c buf.
+ * \param root       The unit that broadcasts data to all other members
+ *                   in \c team.
+ * \param team       The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allreduce.
+ * The content of \c sendbuf and \c recvbuf must not be accessed before
+ * completion of the operation.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_operation_t  op,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allgather.
+ * The content of \c sendbuf and \c recvbuf must not be accessed before
+ * completion of the operation.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the allgather.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
 /**
  * Wait for the local and remote completion of an operation.
  *
@@ -694,6 +952,164 @@ dart_ret_t dart_handle_free(
 
 /** \} */
 
+/**
+ * \name Non-blocking communication operations using handle groups
+ * A handle group collects the requests of non-blocking operations in a
+ * contiguous array that is completed as a whole. Handle groups do not
+ * allocate memory and can be placed on the stack.
+ */
+
+/** \{ */
+
+/**
+ * Maximum number of requests in a handle group. A single operation
+ * contributes up to two requests.
+ */
+#ifndef DART_HANDLE_GROUP_MAX_REQS
+#define DART_HANDLE_GROUP_MAX_REQS 64
+#endif
+
+/**
+ * Maximum number of distinct windows of operations in a handle group that
+ * require remote completion.
+ */
+#ifndef DART_HANDLE_GROUP_MAX_WINS
+#define DART_HANDLE_GROUP_MAX_WINS 4
+#endif
+
+/**
+ * Group of non-blocking operations that are completed together, see
+ * \c dart_handle_group_put and \c dart_handle_group_wait.
+ * Members are managed by the DART implementation.
+ *
+ * Operations are added to the group until it is full, in which case all
+ * operations in the group are completed before the next operation is
+ * added.
+ */
+typedef struct dart_handle_group {
+  /// requests of pending operations, implementation-defined
+  uint64_t reqs[DART_HANDLE_GROUP_MAX_REQS];
+  /// windows requiring remote completion, implementation-defined
+  uint64_t wins[DART_HANDLE_GROUP_MAX_WINS];
+  /// number of pending requests
+  uint16_t num_reqs;
+  /// number of windows requiring remote completion
+  uint16_t num_wins;
+  /// team of the first pending operation, waits are accounted to it
+  dart_team_t team;
+} dart_handle_group_t;
+
+/**
+ * Initialize an empty handle group.
+ *
+ * \param group  The handle group to initialize.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_init(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Variant of \c dart_get_handle adding the operation to a handle group.
+ * Neither local nor remote completion is guaranteed before the group is
+ * completed using \c dart_handle_group_wait and the like.
+ *
+ * \param dest      Local target memory to store the data.
+ * \param gptr      Global pointer being the source of the data transfer.
+ * \param nelem     The number of elements of \c dtype in buffer \c dest.
+ * \param src_type  The data type of the values at the source.
+ * \param dst_type  The data type of the values in buffer \c dest.
+ * \param group     The handle group to add the operation to.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_get(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Variant of \c dart_put_handle adding the operation to a handle group.
+ * Neither local nor remote completion is guaranteed before the group is
+ * completed using \c dart_handle_group_wait and the like.
+ *
+ * \param gptr      Global pointer being the target of the data transfer.
+ * \param src       Local source memory to transfer data from.
+ * \param nelem     The number of elements of type \c dtype to transfer.
+ * \param src_type  The data type of the values in buffer \c src.
+ * \param dst_type  The data type of the values at the target.
+ * \param group     The handle group to add the operation to.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_put(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Wait for the local and remote completion of all operations in the
+ * group. The group is empty afterwards and can be reused.
+ *
+ * \param group  The handle group to complete.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_wait(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Wait for the local completion of all operations in the group.
+ * Remote completion of put operations is still established by a
+ * subsequent \c dart_handle_group_wait.
+ *
+ * \param group  The handle group to complete.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_wait_local(
+  dart_handle_group_t * group) DART_NOTHROW;
+
+/**
+ * Test for the completion of all operations in the group and ensure
+ * their remote completion. If the operations completed, the group is
+ * empty afterwards and can be reused.
+ *
+ * \param group        The handle group to test for completion.
+ * \param[out] result  \c True if all operations have completed.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{group}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_group_test(
+  dart_handle_group_t * group,
+  int32_t             * result) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
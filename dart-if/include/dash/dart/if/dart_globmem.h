@@ -262,6 +262,11 @@ dart_ret_t dart_gptr_setflags(
  * address space of the calling unit and returns a global pointer to it.
  * This is *not* a collective function.
  *
+ * Allocations are served from a pool of \c DART_LOCAL_ALLOC_SIZE bytes
+ * (16 MiB unless set in the environment, e.g. \c DART_LOCAL_ALLOC_SIZE=64M)
+ * that is extended as needed. Blocks of the pool and single allocations
+ * are limited to 2 GiB.
+ *
  * \param nelem The number of elements of type \c dtype to allocate.
  * \param dtype The type to use.
  * \param[out] gptr Global Pointer to hold the allocation
@@ -292,6 +297,45 @@ dart_ret_t dart_memalloc(
  */
 dart_ret_t dart_memfree(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Usage statistics of the pool serving \ref dart_memalloc.
+ *
+ * Threads count their calls locally and add them to the statistics in
+ * batches, counts of threads other than the caller may lag behind.
+ *
+ * \ingroup DartGlobMem
+ */
+typedef struct
+{
+  /** Number of memory blocks in the pool, i.e., 1 + number of extensions */
+  size_t num_blocks;
+  /** Number of bytes in all blocks of the pool */
+  size_t size;
+  /** Number of bytes in use, including padding and thread-cached memory */
+  size_t used;
+  /** Number of calls to \ref dart_memalloc */
+  size_t num_alloc;
+  /** Number of calls to \ref dart_memfree */
+  size_t num_free;
+  /** Number of allocations served from the calling thread's cache */
+  size_t num_cache_hits;
+} dart_memalloc_stats_t;
+
+/**
+ * Query usage statistics of the pool serving \ref dart_memalloc at the
+ * calling unit.
+ * This is *not* a collective function.
+ *
+ * \param[out] stats  The pool statistics.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memalloc_stats(
+  dart_memalloc_stats_t * stats) DART_NOTHROW;
+
 /**
  * Collective function on the specified team to allocate \c nelem elements
  * of type \c dtype of memory in each unit's global address space with a
@@ -328,6 +372,32 @@ dart_ret_t dart_team_memalloc_aligned(
   dart_datatype_t   dtype,
   dart_gptr_t     * gptr) DART_NOTHROW;
 
+/**
+ * Collective function on the specified team to reserve a symmetric heap of
+ * \c nbytes bytes in each unit's global address space.
+ * Subsequent calls to \ref dart_team_memalloc_aligned on the team are
+ * served from the heap without creating an MPI window as long as the heap
+ * is not exhausted. Each unit has to call \c dart_team_memheap_reserve
+ * with the same \c nbytes.
+ * The heap is released when the team is destroyed.
+ *
+ * A heap of \c N bytes is reserved automatically on the first allocation
+ * on every team if the environment variable \c DART_SYMHEAP_SIZE is set
+ * to \c N, optionally suffixed by \c K, \c M or \c G.
+ *
+ * \param teamid  The team participating in the collective operation.
+ * \param nbytes  The number of bytes to reserve per unit.
+ *
+ * \return  \c DART_OK on success, \c DART_ERR_INVAL if the team already
+ *          has a symmetric heap, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_team_memheap_reserve(
+  dart_team_t       teamid,
+  size_t            nbytes) DART_NOTHROW;
+
 /**
  * Collective function to free global memory previously allocated
  * using \ref dart_team_memalloc_aligned.
@@ -0,0 +1,146 @@
+#ifndef DART__IF__STATS_H__
+#define DART__IF__STATS_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_util.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \file dart_stats.h
+ *
+ * \defgroup  DartStats  DART communication statistics
+ * \ingroup   DartInterface
+ *
+ * Counters of communication operations issued by the calling unit, per
+ * team and per target unit.
+ *
+ * Counters are always available but only updated while enabled, either
+ * with \ref dart_stats_enable or by setting the environment variable
+ * \c DART_STATS to \c 1 before \c dart_init. If disabled, the overhead is
+ * a single branch per operation.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DART_INTERFACE_ON
+
+/**
+ * Counters of one-sided operations of the calling unit targeting a
+ * single unit.
+ *
+ * \ingroup DartStats
+ */
+typedef struct
+{
+  /** Number of put operations. */
+  uint64_t put_ops;
+  /** Number of bytes written in put operations. */
+  uint64_t put_bytes;
+  /** Number of get operations. */
+  uint64_t get_ops;
+  /** Number of bytes read in get operations. */
+  uint64_t get_bytes;
+  /** Number of accumulate, fetch-and-op and compare-and-swap operations. */
+  uint64_t acc_ops;
+  /** Number of bytes in accumulate operations. */
+  uint64_t acc_bytes;
+  /** Operations on the calling unit's own memory, served by memcpy. */
+  uint64_t local_ops;
+  /** Operations served through shared memory windows. */
+  uint64_t shmem_ops;
+  /** Operations issued as MPI RMA operations. */
+  uint64_t mpi_ops;
+  /** Number of flush operations. */
+  uint64_t flush_ops;
+  /** Time spent in flush operations in nanoseconds. */
+  uint64_t flush_ns;
+} dart_stats_target_t;
+
+/**
+ * Counters of the calling unit in a team.
+ *
+ * \ingroup DartStats
+ */
+typedef struct
+{
+  /**
+   * Sum of the counters of all target units. Flush operations on all
+   * target units of a segment are included in \c flush_ops and
+   * \c flush_ns.
+   */
+  dart_stats_target_t total;
+  /**
+   * Number of wait operations on handles of one-sided operations in the
+   * team. A wait on handles of several teams is accounted to the team of
+   * the first handle, waits on non-blocking collectives only are not
+   * included.
+   */
+  uint64_t wait_ops;
+  /** Time spent in wait operations in nanoseconds. */
+  uint64_t wait_ns;
+  /** Number of collective operations. */
+  uint64_t coll_ops;
+  /** Number of bytes contributed by the calling unit to collectives. */
+  uint64_t coll_bytes;
+  /**
+   * Time spent in collective operations in nanoseconds.
+   * Non-blocking collectives are accounted when they are completed by a
+   * wait or test operation, the time spent in a wait operation on them is
+   * included in \c coll_ns.
+   */
+  uint64_t coll_ns;
+} dart_stats_t;
+
+/**
+ * Enable or disable updating of communication statistics counters.
+ *
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_enable(bool enable) DART_NOTHROW;
+
+/**
+ * Whether communication statistics counters are updated.
+ *
+ * \ingroup DartStats
+ */
+bool dart_stats_enabled() DART_NOTHROW;
+
+/**
+ * Counters of the calling unit in the specified team.
+ *
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_get(
+  dart_team_t    team,
+  dart_stats_t * stats) DART_NOTHROW;
+
+/**
+ * Counters of operations of the calling unit targeting the specified
+ * unit in the specified team.
+ *
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_get_target(
+  dart_team_t           team,
+  dart_team_unit_t      target,
+  dart_stats_target_t * stats) DART_NOTHROW;
+
+/**
+ * Reset all counters of the calling unit in the specified team.
+ *
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_reset(
+  dart_team_t team) DART_NOTHROW;
+
+#define DART_INTERFACE_OFF
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DART__IF__STATS_H__ */
@@ -45,6 +45,34 @@ dart_ret_t dart_team_lock_init(
   dart_team_t   teamid,
   dart_lock_t * lock)   DART_NOTHROW;
 
+/**
+ * Collective operation to initialize a hierarchical cohort \c lock object.
+ *
+ * Units sharing memory on a node form a cohort and contend on a lock in
+ * shared memory first. Only the unit acquiring the cohort lock while the
+ * cohort does not own the global lock enqueues the cohort in the global
+ * queue lock. On release, the global lock is passed to the next waiting
+ * unit of the same cohort if there is one, up to a limited number of
+ * consecutive times.
+ *
+ * The environment variable \c DART_LOCK_COHORT_SIZE limits the number of
+ * units in a cohort, e.g. to the number of cores of a NUMA domain.
+ *
+ * The lock is acquired and released using the same functions as a lock
+ * initialized using \ref dart_team_lock_init.
+ *
+ * \param teamid Team this lock is used for.
+ * \param lock   The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_cohort_lock_init(
+  dart_team_t   teamid,
+  dart_lock_t * lock)   DART_NOTHROW;
+
 /**
  * Collective operation to destroy a \c lock initialized using
  * \ref dart_team_lock_init.
@@ -108,6 +136,207 @@ dart_ret_t dart_lock_try_acquire(
 dart_ret_t dart_lock_release(
   dart_lock_t   lock)   DART_NOTHROW;
 
+/**
+ * Try to acquire the lock, blocking for at most \c timeout_us
+ * microseconds.
+ *
+ * Note that the lock is not recursive, trying to acquire the lock twice
+ * in the same thread is erroneous.
+ *
+ * The lock is not acquired fairly: instead of waiting in the lock queue,
+ * the unit retries with exponentially increasing delay, so units blocking
+ * in \ref dart_lock_acquire are preferred and the call may time out under
+ * sustained contention.
+ *
+ * \param lock       The lock to acquire
+ * \param timeout_us Maximum time to wait for the lock in microseconds,
+ *                   0 is equivalent to \ref dart_lock_try_acquire.
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_try_acquire_for(
+  dart_lock_t   lock,
+  uint64_t      timeout_us,
+  int32_t     * result) DART_NOTHROW;
+
+
+/**
+ * Reader-writer lock allowing either a single writer or any number of
+ * readers among the units in a team.
+ *
+ * Readers register in a counter shared by all units on the same node, a
+ * writer waits for the counters of all nodes to drain. A writer sets a
+ * flag replicated on every node, readers only check the flag on their
+ * own node. Readers arriving while a writer holds or waits for the lock
+ * back off, so writers are not starved by a steady stream of readers.
+ * \ingroup DartSync
+ */
+typedef struct dart_rwlock_struct *dart_rwlock_t;
+
+/**
+ * Collective operation to initialize the reader-writer \c lock object.
+ *
+ * \param teamid Team this lock is used for.
+ * \param lock   The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_init(
+  dart_team_t     teamid,
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Collective operation to destroy a \c lock initialized using
+ * \ref dart_team_rwlock_init.
+ *
+ * \param lock   The \c lock to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_destroy(
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired exclusively.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock exclusively and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock exclusively, blocking for at most
+ * \c timeout_us microseconds.
+ *
+ * Competing writers retry with exponentially increasing delay and are
+ * not served in order of arrival, so the call may time out under
+ * sustained contention.
+ *
+ * \param lock       The lock to acquire
+ * \param timeout_us Maximum time to wait for the lock in microseconds.
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_for(
+  dart_rwlock_t   lock,
+  uint64_t        timeout_us,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release the \c lock acquired exclusively.
+ * Fails with \c DART_ERR_INVAL if the calling unit does not hold the
+ * \c lock exclusively.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired for reading.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_shared(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock for reading and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_shared(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock for reading, blocking for at most
+ * \c timeout_us microseconds.
+ *
+ * \param lock       The lock to acquire
+ * \param timeout_us Maximum time to wait for the lock in microseconds.
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_shared_for(
+  dart_rwlock_t   lock,
+  uint64_t        timeout_us,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release the \c lock acquired for reading.
+ * Fails with \c DART_ERR_INVAL if the calling unit does not hold the
+ * \c lock for reading.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release_shared(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
 
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
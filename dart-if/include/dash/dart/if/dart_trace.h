@@ -0,0 +1,128 @@
+#ifndef DART__IF__TRACE_H__
+#define DART__IF__TRACE_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_util.h>
+
+#include <stddef.h>
+
+/**
+ * \file dart_trace.h
+ *
+ * \defgroup  DartTrace  DART event tracing interface
+ * \ingroup   DartInterface
+ *
+ * Hooks for event tracing of DART communication and synchronization
+ * operations.
+ *
+ * A single callback can be registered that is invoked on entry and exit
+ * of every traced DART operation. Without a registered callback, the
+ * overhead of tracing is a single branch per operation.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DART_INTERFACE_ON
+
+/**
+ * Traced DART operations.
+ *
+ * \ingroup DartTrace
+ */
+typedef enum
+{
+  DART_TRACE_GET = 0,
+  DART_TRACE_PUT,
+  DART_TRACE_GET_HANDLE,
+  DART_TRACE_PUT_HANDLE,
+  DART_TRACE_GET_BLOCKING,
+  DART_TRACE_PUT_BLOCKING,
+  DART_TRACE_ACCUMULATE,
+  DART_TRACE_FETCH_AND_OP,
+  DART_TRACE_COMPARE_AND_SWAP,
+  DART_TRACE_FLUSH,
+  DART_TRACE_FLUSH_LOCAL,
+  DART_TRACE_WAIT,
+  DART_TRACE_WAIT_LOCAL,
+  DART_TRACE_BARRIER,
+  DART_TRACE_BCAST,
+  DART_TRACE_SCATTER,
+  DART_TRACE_GATHER,
+  DART_TRACE_ALLGATHER,
+  DART_TRACE_ALLTOALL,
+  DART_TRACE_ALLREDUCE,
+  DART_TRACE_REDUCE,
+  DART_TRACE_SEND,
+  DART_TRACE_RECV,
+  DART_TRACE_SENDRECV,
+  DART_TRACE_SCAN,
+  DART_TRACE_EXSCAN,
+  DART_TRACE_IBARRIER,
+  DART_TRACE_IBCAST,
+  DART_TRACE_IALLGATHER,
+  DART_TRACE_IALLREDUCE,
+  /** Number of traced operations, not a valid event. */
+  DART_TRACE_EVENT_LAST
+} dart_trace_event_t;
+
+/**
+ * Phase of a traced DART operation.
+ *
+ * \ingroup DartTrace
+ */
+typedef enum
+{
+  DART_TRACE_BEGIN = 0,
+  DART_TRACE_END
+} dart_trace_phase_t;
+
+/**
+ * Signature of trace callbacks.
+ *
+ * \c nbytes is the number of bytes transferred by the calling unit in
+ * communication operations and 0 for synchronization operations. It is
+ * identical in the \c DART_TRACE_BEGIN and \c DART_TRACE_END calls of an
+ * operation.
+ *
+ * Callbacks are invoked from the thread calling the DART operation and
+ * must not call DART functions themselves.
+ *
+ * \ingroup DartTrace
+ */
+typedef void (*dart_trace_callback_t)(
+  dart_trace_event_t   event,
+  dart_trace_phase_t   phase,
+  size_t               nbytes,
+  void               * userdata);
+
+/**
+ * Register the trace callback, replacing a previously registered
+ * callback. Pass \c NULL to disable tracing.
+ *
+ * Operations that already started when the callback is replaced are
+ * completed with the callback and user data active at their start.
+ * May be called concurrently with traced operations of other threads.
+ *
+ * \ingroup DartTrace
+ */
+dart_ret_t dart_trace_set_callback(
+  dart_trace_callback_t   callback,
+  void                  * userdata) DART_NOTHROW;
+
+/**
+ * Name of a traced operation, e.g. \c "dart_get".
+ *
+ * \ingroup DartTrace
+ */
+const char * dart_trace_event_name(
+  dart_trace_event_t event) DART_NOTHROW;
+
+#define DART_INTERFACE_OFF
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DART__IF__TRACE_H__ */
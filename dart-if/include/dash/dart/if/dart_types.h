@@ -725,6 +725,24 @@ dart_type_create_indexed(
 dart_ret_t
 dart_type_destroy(dart_datatype_t *dart_type);
 
+/**
+ * Query the number of hits and misses of the cache of committed MPI
+ * datatypes used in transfers of strided data types since initialization.
+ *
+ * \param[out] hits    Number of transfers that reused a cached type.
+ *                     May be \c NULL.
+ * \param[out] misses  Number of transfers that created a new type.
+ *                     May be \c NULL.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_type_cache_stats(
+  size_t * hits,
+  size_t * misses);
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
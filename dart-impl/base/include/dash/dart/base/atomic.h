@@ -44,6 +44,31 @@
 #define DART_FETCHPTR(ptr) \
           DART_FETCH_AND_ADDPTR(ptr, 0)
 
+/**
+ * Plain load with acquire semantics, does not acquire exclusive ownership
+ * of the cache line as the DART_FETCH* operations do.
+ */
+#define DART_LOAD_ACQUIRE32(ptr) \
+          __atomic_load_n((int32_t *)(ptr), __ATOMIC_ACQUIRE)
+
+/**
+ * Plain store with release semantics.
+ */
+#define DART_STORE_RELEASE32(ptr, val) \
+          __atomic_store_n((int32_t *)(ptr), (val), __ATOMIC_RELEASE)
+
+/**
+ * Plain pointer load with acquire semantics.
+ */
+#define DART_LOAD_ACQUIREPTR(ptr) \
+          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+
+/**
+ * Replace the pointer at \c ptr with \c val and return the previous value.
+ */
+#define DART_EXCHANGEPTR(ptr, val) \
+          __atomic_exchange_n((ptr), (val), __ATOMIC_ACQ_REL)
+
 #define DART_FETCH_AND_ADD64(ptr, val) \
           __sync_fetch_and_add((int64_t *)(ptr), (val))
 #define DART_FETCH_AND_ADD32(ptr, val) \
@@ -202,6 +227,36 @@ __fetch_and_addptr(char **ptr, int64_t val) {
   return res;
 }
 
+static inline void *
+DART_MAYBE_UNUSED
+__exchangeptr(void **ptr, void *val) {
+  void * res = *ptr;
+  *ptr = val;
+  return res;
+}
+
+
+
+#define DART_FETCH64(ptr) \
+          (*(int64_t *)(ptr))
+#define DART_FETCH32(ptr) \
+          (*(int32_t *)(ptr))
+#define DART_FETCH16(ptr) \
+          (*(int16_t *)(ptr))
+#define DART_FETCH8(ptr)  \
+          (*(int8_t  *)(ptr))
+#define DART_FETCHPTR(ptr) \
+          (*(void   **)(ptr))
+
+#define DART_LOAD_ACQUIRE32(ptr) \
+          (*(volatile int32_t *)(ptr))
+#define DART_STORE_RELEASE32(ptr, val) \
+          (*(volatile int32_t *)(ptr) = (val))
+
+#define DART_LOAD_ACQUIREPTR(ptr) \
+          (*(ptr))
+#define DART_EXCHANGEPTR(ptr, val) \
+          __exchangeptr((void **)(ptr), (val))
 
 
 #define DART_FETCH_AND_ADD64(ptr, val) \
@@ -226,11 +281,11 @@ __fetch_and_addptr(char **ptr, int64_t val) {
 #define DART_FETCH_AND_INC64(ptr)  \
           ((*(int64_t *)ptr)++)
 #define DART_FETCH_AND_INC32(ptr) \
-          ((*(int64_t *)ptr)++)
+          ((*(int32_t *)ptr)++)
 #define DART_FETCH_AND_INC16(ptr)  \
-          ((*(int64_t *)ptr)++)
+          ((*(int16_t *)ptr)++)
 #define DART_FETCH_AND_INC8(ptr)   \
-          ((*(int64_t *)ptr)++)
+          ((*(int8_t  *)ptr)++)
 #define DART_FETCH_AND_INCPTR(ptr) \
           __fetch_and_addptr((void **)(ptr), sizeof(**(ptr)))
 
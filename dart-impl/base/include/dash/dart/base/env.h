@@ -0,0 +1,34 @@
+/**
+ * \file dart/base/env.h
+ *
+ * Access to settings from environment variables.
+ */
+#ifndef DART__BASE__ENV_H__
+#define DART__BASE__ENV_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Read a size in bytes from the environment variable \c env.
+ * Accepts an optional suffix \c K, \c M or \c G.
+ *
+ * \return  The size in bytes or \c fallback if the variable is not set or
+ *          has an invalid value.
+ */
+size_t dart__base__env__size(
+  const char  * env,
+  size_t        fallback);
+
+/**
+ * Read a boolean flag from the environment variable \c env.
+ * Accepts \c 1, \c on, \c true and \c 0, \c off, \c false.
+ *
+ * \return  The flag or \c fallback if the variable is not set or has an
+ *          invalid value.
+ */
+bool dart__base__env__bool(
+  const char  * env,
+  bool          fallback);
+
+#endif /* DART__BASE__ENV_H__ */
@@ -28,6 +28,12 @@
  */
 #define dart__unlikely(x)    __builtin_expect(!!(x), 0)
 
+/**
+ * Call \c func with a pointer to the annotated local variable when it
+ * goes out of scope. The variable may be otherwise unused.
+ */
+#define DART_SCOPE_CLEANUP(func) __attribute__((cleanup(func), unused))
+
 #if !defined(_CRAYC)
 /**
  * Mark a variable or function internal, i.e., it is not accessed from outside
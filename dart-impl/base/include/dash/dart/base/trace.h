@@ -0,0 +1,89 @@
+/**
+ * \file dart/base/trace.h
+ *
+ * Invocation of the trace callback registered with
+ * \ref dart_trace_set_callback in DART operations.
+ */
+#ifndef DART__BASE__TRACE_H__
+#define DART__BASE__TRACE_H__
+
+#include <dash/dart/if/dart_trace.h>
+#include <dash/dart/if/dart_util.h>
+#include <dash/dart/base/macro.h>
+#include <dash/dart/base/atomic.h>
+
+#include <stddef.h>
+
+/**
+ * Registered trace callback and its user data, published as a single
+ * pointer so that callback and user data are always read consistently.
+ */
+typedef struct dart__base__trace_handler_s
+{
+  dart_trace_callback_t                callback;
+  void                               * userdata;
+  /// next handler in the list of replaced handlers
+  struct dart__base__trace_handler_s * next;
+} dart__base__trace_handler_t;
+
+extern dart__base__trace_handler_t * dart__base__trace_handler;
+
+/**
+ * Release the active and all replaced trace handlers, called in
+ * \c dart_exit when no traced operations are in progress.
+ */
+void dart__base__trace_finalize() DART_INTERNAL;
+
+typedef struct
+{
+  dart_trace_callback_t   callback;
+  void                  * userdata;
+  dart_trace_event_t      event;
+  size_t                  nbytes;
+} dart__base__trace_scope_t;
+
+DART_INLINE
+dart__base__trace_scope_t dart__base__trace_begin(
+  dart_trace_event_t event,
+  size_t             nbytes)
+{
+  dart__base__trace_scope_t           scope;
+  const dart__base__trace_handler_t * handler =
+    DART_LOAD_ACQUIREPTR(&dart__base__trace_handler);
+  scope.callback = (handler != NULL) ? handler->callback : NULL;
+  scope.userdata = (handler != NULL) ? handler->userdata : NULL;
+  scope.event    = event;
+  scope.nbytes   = nbytes;
+  if (dart__unlikely(scope.callback != NULL)) {
+    scope.callback(event, DART_TRACE_BEGIN, nbytes, scope.userdata);
+  }
+  return scope;
+}
+
+DART_INLINE
+void dart__base__trace_end(
+  dart__base__trace_scope_t * scope)
+{
+  if (dart__unlikely(scope->callback != NULL)) {
+    scope->callback(scope->event, DART_TRACE_END, scope->nbytes,
+                    scope->userdata);
+  }
+}
+
+/**
+ * Trace the enclosing scope as DART operation \c event transferring
+ * \c nbytes bytes.
+ *
+ * The end of the operation is traced on every exit of the scope.
+ * The expression \c nbytes is only evaluated if a trace callback is
+ * registered.
+ */
+#define DART_TRACE_SCOPE(event, nbytes)                              \
+  dart__base__trace_scope_t __dart_trace_scope                       \
+    DART_SCOPE_CLEANUP(dart__base__trace_end) =                      \
+      dart__base__trace_begin(                                       \
+        (event),                                                     \
+        dart__unlikely(dart__base__trace_handler != NULL)            \
+          ? (nbytes) : 0)
+
+#endif /* DART__BASE__TRACE_H__ */
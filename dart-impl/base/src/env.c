@@ -0,0 +1,59 @@
+/**
+ * \file dart/base/env.c
+ *
+ */
+
+#include <dash/dart/base/env.h>
+#include <dash/dart/base/logging.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+
+size_t dart__base__env__size(
+  const char  * env,
+  size_t        fallback)
+{
+  const char *envstr = getenv(env);
+  if (envstr == NULL) {
+    return fallback;
+  }
+  char *end;
+  unsigned long long size = strtoull(envstr, &end, 10);
+  if (end == envstr) {
+    DART_LOG_WARN("Ignoring invalid value of %s: '%s'", env, envstr);
+    return fallback;
+  }
+  switch (*end) {
+    case 'g': case 'G': size <<= 10; // fall-through
+    case 'm': case 'M': size <<= 10; // fall-through
+    case 'k': case 'K': size <<= 10; ++end; break;
+    default: break;
+  }
+  if (*end != '\0') {
+    DART_LOG_WARN("Ignoring invalid value of %s: '%s'", env, envstr);
+    return fallback;
+  }
+  return size;
+}
+
+bool dart__base__env__bool(
+  const char  * env,
+  bool          fallback)
+{
+  const char *envstr = getenv(env);
+  if (envstr == NULL) {
+    return fallback;
+  }
+  if (strcmp(envstr, "1") == 0 || strcasecmp(envstr, "on") == 0 ||
+      strcasecmp(envstr, "true") == 0) {
+    return true;
+  }
+  if (strcmp(envstr, "0") == 0 || strcasecmp(envstr, "off") == 0 ||
+      strcasecmp(envstr, "false") == 0) {
+    return false;
+  }
+  DART_LOG_WARN("Ignoring invalid value of %s: '%s'", env, envstr);
+  return fallback;
+}
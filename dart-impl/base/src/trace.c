@@ -0,0 +1,94 @@
+#include <dash/dart/base/trace.h>
+#include <dash/dart/base/atomic.h>
+
+#include <dash/dart/if/dart_trace.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+
+dart__base__trace_handler_t * dart__base__trace_handler = NULL;
+
+/* Handlers replaced by dart_trace_set_callback, operations that started
+ * before may still use them. */
+static dart__base__trace_handler_t * dart__base__trace_retired = NULL;
+
+static const char * const dart__base__trace_event_names[] = {
+  "dart_get",
+  "dart_put",
+  "dart_get_handle",
+  "dart_put_handle",
+  "dart_get_blocking",
+  "dart_put_blocking",
+  "dart_accumulate",
+  "dart_fetch_and_op",
+  "dart_compare_and_swap",
+  "dart_flush",
+  "dart_flush_local",
+  "dart_wait",
+  "dart_wait_local",
+  "dart_barrier",
+  "dart_bcast",
+  "dart_scatter",
+  "dart_gather",
+  "dart_allgather",
+  "dart_alltoall",
+  "dart_allreduce",
+  "dart_reduce",
+  "dart_send",
+  "dart_recv",
+  "dart_sendrecv",
+  "dart_scan",
+  "dart_exscan",
+  "dart_ibarrier",
+  "dart_ibcast",
+  "dart_iallgather",
+  "dart_iallreduce"
+};
+
+dart_ret_t dart_trace_set_callback(
+  dart_trace_callback_t   callback,
+  void                  * userdata)
+{
+  dart__base__trace_handler_t * handler = NULL;
+  if (callback != NULL) {
+    handler = malloc(sizeof(dart__base__trace_handler_t));
+    if (handler == NULL) {
+      return DART_ERR_OTHER;
+    }
+    handler->callback = callback;
+    handler->userdata = userdata;
+    handler->next     = NULL;
+  }
+  dart__base__trace_handler_t * prev =
+    DART_EXCHANGEPTR(&dart__base__trace_handler, handler);
+  if (prev != NULL) {
+    dart__base__trace_handler_t * head;
+    do {
+      head       = DART_LOAD_ACQUIREPTR(&dart__base__trace_retired);
+      prev->next = head;
+    } while (DART_COMPARE_AND_SWAPPTR(
+               &dart__base__trace_retired, head, prev) != head);
+  }
+  return DART_OK;
+}
+
+void dart__base__trace_finalize()
+{
+  free(DART_EXCHANGEPTR(&dart__base__trace_handler, NULL));
+  dart__base__trace_handler_t * handler =
+    DART_EXCHANGEPTR(&dart__base__trace_retired, NULL);
+  while (handler != NULL) {
+    dart__base__trace_handler_t * next = handler->next;
+    free(handler);
+    handler = next;
+  }
+}
+
+const char * dart_trace_event_name(
+  dart_trace_event_t event)
+{
+  if (event < 0 || event >= DART_TRACE_EVENT_LAST) {
+    return "dart_unknown";
+  }
+  return dart__base__trace_event_names[event];
+}
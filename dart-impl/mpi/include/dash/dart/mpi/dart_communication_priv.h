@@ -25,6 +25,50 @@
  */
 #define MAX_CONTIG_ELEMENTS INT_MAX
 
+/**
+ * Name of the environment variable specifying the maximum number of
+ * elements updated in a single \c MPI_Accumulate in
+ * \ref dart_accumulate_indexed, 0 to update all elements at once.
+ */
+#define DART_ACCUMULATE_INDEXED_CHUNK_ENVSTR "DART_ACCUMULATE_INDEXED_CHUNK"
+
+/**
+ * Default maximum number of elements updated in a single
+ * \c MPI_Accumulate in \ref dart_accumulate_indexed.
+ * Some MPI implementations (e.g. Open MPI osc/pt2pt) stall on accumulate
+ * operations with large indexed target datatypes.
+ */
+#ifndef DART_ACCUMULATE_INDEXED_CHUNK
+#define DART_ACCUMULATE_INDEXED_CHUNK 256
+#endif
+
+/**
+ * Maximum number of elements updated in a single \c MPI_Accumulate in
+ * \ref dart_accumulate_indexed, 0 if unbounded.
+ * Set from \c DART_ACCUMULATE_INDEXED_CHUNK_ENVSTR in \c dart_init.
+ */
+extern size_t dart__mpi__accumulate_indexed_chunk DART_INTERNAL;
+
+/** DART handle type for non-blocking one-sided operations. */
+struct dart_handle_struct
+{
+  MPI_Request reqs[2];   // a large transfer might consist of two operations
+  MPI_Win     win;
+  dart_unit_t dest;
+  uint8_t     num_reqs;
+  bool        needs_flush;
+  /// team of a one-sided operation, DART_UNDEFINED_TEAM_ID otherwise
+  dart_team_t team;
+  /// team of a non-blocking collective, DART_UNDEFINED_TEAM_ID otherwise
+  dart_team_t coll_team;
+  /// bytes contributed by the calling unit to the non-blocking collective
+  size_t      coll_nbytes;
+  /// next free handle in the handle pool
+  struct dart_handle_struct * next;
+  /// generation of the handle pool the handle was allocated from
+  int32_t     generation;
+};
+
 typedef enum {
   DART_KIND_BASIC = 0,
   DART_KIND_STRIDED,
@@ -2,9 +2,18 @@
 #define DART__MPI__DART_GLOBMEM_PRIV_H__
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/mpi/dart_team_private.h>
 #include <mpi.h>
 
 /* Global object for one-sided communication on memory region allocated with 'local allocation'. */
 extern MPI_Win dart_win_local_alloc DART_INTERNAL;
 
+/**
+ * Free the symmetric heap of the given team, if any.
+ * Collective on the team, all allocations served from the heap become
+ * invalid.
+ */
+dart_ret_t
+dart__mpi__symheap_release(dart_team_data_t *team_data) DART_INTERNAL;
+
 #endif /* DART__MPI__DART_GLOBMEM_PRIV_H__ */
@@ -0,0 +1,52 @@
+/**
+ * \file dash/dart/mpi/dart_handle_pool.h
+ *
+ * Pool of handles of non-blocking operations.
+ *
+ * Handles are allocated in slabs that are released in \c dart_exit.
+ * Free handles are kept in per-thread free lists so that allocating and
+ * releasing a handle does not require heap allocations or
+ * synchronization in the common case.
+ */
+#ifndef DART__MPI__DART_HANDLE_POOL_H__
+#define DART__MPI__DART_HANDLE_POOL_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * Number of handles allocated at once when the pool is exhausted.
+ */
+#ifndef DART_HANDLE_POOL_SLAB_SIZE
+#define DART_HANDLE_POOL_SLAB_SIZE 256
+#endif
+
+/**
+ * Maximum number of free handles kept per thread. Excess handles are
+ * returned to the shared free list of the pool.
+ */
+#ifndef DART_HANDLE_POOL_CACHE_DEPTH
+#define DART_HANDLE_POOL_CACHE_DEPTH 1024
+#endif
+
+/**
+ * Get a handle from the pool. All members of the handle are reset.
+ * Returns \c DART_HANDLE_NULL if the pool cannot be extended.
+ */
+dart_handle_t dart__mpi__handle_alloc() DART_INTERNAL;
+
+/**
+ * Return a handle to the pool, \c DART_HANDLE_NULL is ignored.
+ * Handles allocated before the pool was released are dropped.
+ */
+void dart__mpi__handle_free(dart_handle_t handle) DART_INTERNAL;
+
+/**
+ * Release all slabs of the pool. Handles obtained from the pool must not
+ * be used afterwards. If handles have not been returned to the pool, the
+ * slabs are kept so that returning them later is harmless.
+ */
+dart_ret_t dart__mpi__handle_pool_fini() DART_INTERNAL;
+
+#endif /* DART__MPI__DART_HANDLE_POOL_H__ */
@@ -0,0 +1,103 @@
+/**
+ * \file dash/dart/mpi/dart_localpool.h
+ *
+ * Pool of memory serving non-collective allocations in \c dart_memalloc.
+ *
+ * The pool consists of the shared-memory block allocated in \c dart_init
+ * and extension blocks that are allocated and attached to the dynamic
+ * window of \c DART_TEAM_ALL once the initial block is exhausted.
+ * Small allocations are served from per-thread caches of size classes,
+ * which range from 64 B to 1 KiB with the default
+ * \c DART_LOCAL_ALLOC_CACHE_CLASSES.
+ */
+#ifndef DART__MPI__DART_LOCALPOOL_H__
+#define DART__MPI__DART_LOCALPOOL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <mpi.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * Name of the environment variable specifying the size of the initial
+ * block of the pool, e.g. \c 64M.
+ */
+#define DART_LOCAL_ALLOC_SIZE_ENVSTR "DART_LOCAL_ALLOC_SIZE"
+
+/**
+ * Default size of the initial block of the pool, in bytes.
+ */
+#ifndef DART_LOCAL_ALLOC_SIZE
+#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
+#endif
+
+/**
+ * Maximum number of blocks in the pool, including the initial block.
+ */
+#ifndef DART_LOCAL_ALLOC_MAX_BLOCKS
+#define DART_LOCAL_ALLOC_MAX_BLOCKS 32
+#endif
+
+/**
+ * Number of size classes cached per thread, the smallest class holds
+ * allocations of 64 bytes and the largest class holds allocations of
+ * <tt>64 << (DART_LOCAL_ALLOC_CACHE_CLASSES-1)</tt> bytes.
+ */
+#ifndef DART_LOCAL_ALLOC_CACHE_CLASSES
+#define DART_LOCAL_ALLOC_CACHE_CLASSES 5
+#endif
+
+/**
+ * Maximum number of free allocations cached per thread and size class.
+ */
+#ifndef DART_LOCAL_ALLOC_CACHE_DEPTH
+#define DART_LOCAL_ALLOC_CACHE_DEPTH 32
+#endif
+
+/**
+ * Size of the initial block of the pool from \c DART_LOCAL_ALLOC_SIZE_ENVSTR,
+ * rounded to the next power of two and limited to 2 GiB.
+ */
+size_t dart_localpool_size_from_env() DART_INTERNAL;
+
+/**
+ * Register the initial block of \c size bytes starting at \c base, a power
+ * of two.
+ * Allocations from this block are addressed relative to \c base in
+ * segment \c DART_SEGMENT_LOCAL.
+ * Extension blocks are attached to the dynamic window \c win and
+ * addressed in segment \c DART_SEGMENT_LOCAL_EXT.
+ */
+dart_ret_t dart_localpool_init(
+  char    * base,
+  size_t    size,
+  MPI_Win   win) DART_INTERNAL;
+
+/**
+ * Release all blocks of the pool. Extension blocks are detached from the
+ * dynamic window and freed.
+ */
+dart_ret_t dart_localpool_fini() DART_INTERNAL;
+
+/**
+ * Allocate \c nbytes from the pool, extending the pool if needed.
+ *
+ * \param[out] segid   The segment ID of the allocation.
+ * \param[out] offset  The offset of the allocation in the segment.
+ */
+dart_ret_t dart_localpool_alloc(
+  size_t     nbytes,
+  int16_t  * segid,
+  uint64_t * offset) DART_INTERNAL;
+
+/**
+ * Return an allocation to the pool.
+ */
+dart_ret_t dart_localpool_free(
+  int16_t    segid,
+  uint64_t   offset) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_LOCALPOOL_H__ */
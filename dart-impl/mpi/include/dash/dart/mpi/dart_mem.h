@@ -17,7 +17,6 @@
 // forward declaration
 struct dart_buddy;
 extern char* dart_mempool_localalloc DART_INTERNAL;
-extern struct dart_buddy* dart_localpool DART_INTERNAL;
 
 /**
  * Create a new buddy allocator instance.
@@ -51,6 +50,12 @@ size_t dart_buddy_alloc(struct dart_buddy *, size_t size) DART_INTERNAL;
  */
 int dart_buddy_free(struct dart_buddy *, uint64_t offset) DART_INTERNAL;
 
+/**
+ * The number of bytes currently allocated, including the padding of
+ * allocations to the next power of two.
+ */
+size_t dart_buddy_used(struct dart_buddy *) DART_INTERNAL;
+
 /**
  * ???
  */
@@ -17,6 +17,15 @@ typedef int16_t dart_segid_t;
 
 #define DART_SEGMENT_HASH_SIZE 256
 
+/**
+ * Segment ID of local allocations served from extensions of the local
+ * allocation pool, see \c dart_localpool_alloc.
+ * Offsets in this segment are absolute addresses in the memory of the
+ * unit that are accessed through the dynamic window of \c DART_TEAM_ALL.
+ * Never handed out by \c dart_segment_alloc for other segment types.
+ */
+#define DART_SEGMENT_LOCAL_EXT ((dart_segid_t)INT16_MIN)
+
 typedef struct
 {
   size_t       size;
@@ -28,6 +37,8 @@ typedef struct
   uint16_t     flags;       /* 16 bit flags */
   dart_segid_t segid;       /* ID of the segment, globally unique in a team */
   bool         is_dynamic;  /* whether this is a shared memory segment */
+  bool         is_symheap;  /* whether this segment is carved out of the
+                               team's symmetric heap */
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
@@ -54,6 +65,7 @@ typedef struct {
 
 typedef enum {
   DART_SEGMENT_LOCAL_ALLOC,
+  DART_SEGMENT_LOCAL_EXT_ALLOC,
   DART_SEGMENT_ALLOC,
   DART_SEGMENT_REGISTER
 } dart_segment_type;
@@ -0,0 +1,218 @@
+/**
+ * \file dart_stats_priv.h
+ *
+ * Updates of communication statistics counters in DART operations.
+ */
+#ifndef DART__MPI__STATS_PRIV_H__
+#define DART__MPI__STATS_PRIV_H__
+
+#include <dash/dart/if/dart_stats.h>
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_util.h>
+
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_segment.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define DART_STATS_ENVSTR "DART_STATS"
+
+extern bool dart__mpi__stats_enabled;
+
+typedef enum {
+  DART_STATS_PUT = 0,
+  DART_STATS_GET,
+  DART_STATS_ACC
+} dart__mpi__stats_rma_t;
+
+DART_INLINE
+void dart__mpi__stats_add(uint64_t * counter, uint64_t value)
+{
+  __atomic_fetch_add(counter, value, __ATOMIC_RELAXED);
+}
+
+DART_INLINE
+uint64_t dart__mpi__stats_now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Account a one-sided operation of \c nbytes bytes on \c target and the
+ * path it is served by, following the decision in \c dart__mpi__get_basic
+ * and \c dart__mpi__put_basic.
+ */
+DART_INLINE
+void dart__mpi__stats_rma(
+  dart__mpi__stats_rma_t      kind,
+  dart_team_data_t          * team_data,
+  dart_team_unit_t            target,
+  const dart_segment_info_t * seginfo,
+  size_t                      nbytes,
+  bool                        basic)
+{
+  if (team_data->stats_target == NULL) {
+    return;
+  }
+  dart_stats_target_t * stats = &team_data->stats_target[target.id];
+  switch (kind) {
+    case DART_STATS_PUT:
+      dart__mpi__stats_add(&stats->put_ops,   1);
+      dart__mpi__stats_add(&stats->put_bytes, nbytes);
+      break;
+    case DART_STATS_GET:
+      dart__mpi__stats_add(&stats->get_ops,   1);
+      dart__mpi__stats_add(&stats->get_bytes, nbytes);
+      break;
+    case DART_STATS_ACC:
+      dart__mpi__stats_add(&stats->acc_ops,   1);
+      dart__mpi__stats_add(&stats->acc_bytes, nbytes);
+      break;
+  }
+  if (basic && team_data->unitid == target.id) {
+    dart__mpi__stats_add(&stats->local_ops, 1);
+    return;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (basic && seginfo->segid >= 0 &&
+      team_data->sharedmem_tab[target.id].id >= 0) {
+    dart__mpi__stats_add(&stats->shmem_ops, 1);
+    return;
+  }
+#else
+  dart__unused(seginfo);
+#endif
+  dart__mpi__stats_add(&stats->mpi_ops, 1);
+}
+
+/**
+ * Account a one-sided operation if statistics are enabled.
+ * The expression \c nbytes is only evaluated if statistics are enabled.
+ */
+#define DART_STATS_RMA(kind, team_data, target, seginfo, nbytes, basic)  \
+  do {                                                                  \
+    if (dart__unlikely(dart__mpi__stats_enabled)) {                     \
+      dart__mpi__stats_rma((kind), (team_data), (target), (seginfo),    \
+                           (nbytes), (basic));                          \
+    }                                                                   \
+  } while (0)
+
+typedef enum {
+  DART_STATS_FLUSH = 0,
+  DART_STATS_WAIT,
+  DART_STATS_COLLECTIVE
+} dart__mpi__stats_timed_t;
+
+typedef struct {
+  uint64_t                  start;
+  dart__mpi__stats_timed_t  kind;
+  dart_team_t               team;
+  dart_team_unit_t          target;
+  size_t                    nbytes;
+} dart__mpi__stats_timer_t;
+
+DART_INLINE
+dart__mpi__stats_timer_t dart__mpi__stats_timer_begin(
+  dart__mpi__stats_timed_t kind,
+  dart_team_t              team,
+  dart_team_unit_t         target,
+  size_t                   nbytes)
+{
+  dart__mpi__stats_timer_t timer;
+  timer.start  = dart__unlikely(dart__mpi__stats_enabled)
+                   ? dart__mpi__stats_now()
+                   : 0;
+  timer.kind   = kind;
+  timer.team   = team;
+  timer.target = target;
+  timer.nbytes = nbytes;
+  return timer;
+}
+
+void dart__mpi__stats_timer_end(
+  dart__mpi__stats_timer_t * timer) DART_INTERNAL;
+
+/**
+ * Account the time spent in the enclosing scope as operation \c kind in
+ * team \c team. The target unit \c target is only considered for
+ * \c DART_STATS_FLUSH, \c DART_UNDEFINED_TEAM_UNIT_ID refers to all units
+ * in the team.
+ * The expression \c nbytes is only evaluated if statistics are enabled.
+ */
+#define DART_STATS_TIMED_SCOPE(kind, team, target, nbytes)          \
+  dart__mpi__stats_timer_t __dart_stats_timer                       \
+    DART_SCOPE_CLEANUP(dart__mpi__stats_timer_end) =                \
+      dart__mpi__stats_timer_begin(                                 \
+        (kind), (team), (target),                                   \
+        dart__unlikely(dart__mpi__stats_enabled) ? (nbytes) : 0)
+
+/**
+ * Account the completion of a non-blocking collective operation of
+ * \c nbytes bytes in team \c team. The time since \c start is accounted
+ * as collective time unless \c start is 0.
+ */
+void dart__mpi__stats_coll_complete(
+  dart_team_t team,
+  size_t      nbytes,
+  uint64_t    start) DART_INTERNAL;
+
+/**
+ * Account the time spent in the enclosing scope as wait operation in the
+ * team set by \c DART_STATS_WAIT_TEAM or \c DART_STATS_WAIT_HANDLE.
+ * Nothing is accounted if no team has been set.
+ */
+#define DART_STATS_WAIT_SCOPE()                                     \
+  DART_STATS_TIMED_SCOPE(DART_STATS_WAIT, DART_UNDEFINED_TEAM_ID,   \
+                         DART_UNDEFINED_TEAM_UNIT_ID, 0)
+
+/**
+ * Account the wait operation of the enclosing \c DART_STATS_WAIT_SCOPE
+ * in team \c teamid unless a team has been set before.
+ */
+#define DART_STATS_WAIT_TEAM(teamid)                                \
+  do {                                                              \
+    if (__dart_stats_timer.team == DART_UNDEFINED_TEAM_ID) {        \
+      __dart_stats_timer.team = (teamid);                           \
+    }                                                               \
+  } while (0)
+
+/**
+ * Account the completion of \c handle in the enclosing
+ * \c DART_STATS_WAIT_SCOPE. For a non-blocking collective operation, the
+ * time spent in the scope so far is accounted as collective time of its
+ * team. Otherwise, the wait operation is accounted in the team of the
+ * handle.
+ */
+#define DART_STATS_WAIT_HANDLE(handle)                              \
+  do {                                                              \
+    if (dart__unlikely(dart__mpi__stats_enabled)) {                 \
+      if ((handle)->coll_team != DART_UNDEFINED_TEAM_ID) {          \
+        dart__mpi__stats_coll_complete((handle)->coll_team,         \
+                                       (handle)->coll_nbytes,       \
+                                       __dart_stats_timer.start);   \
+      } else {                                                      \
+        DART_STATS_WAIT_TEAM((handle)->team);                       \
+      }                                                             \
+    }                                                               \
+  } while (0)
+
+/**
+ * Account the completion of \c handle in a test operation if it refers to
+ * a non-blocking collective operation. No time is accounted.
+ */
+#define DART_STATS_COLL_TEST(handle)                                \
+  do {                                                              \
+    if (dart__unlikely(dart__mpi__stats_enabled) &&                 \
+        (handle)->coll_team != DART_UNDEFINED_TEAM_ID) {            \
+      dart__mpi__stats_coll_complete((handle)->coll_team,           \
+                                     (handle)->coll_nbytes, 0);     \
+    }                                                               \
+  } while (0)
+
+#endif /* DART__MPI__STATS_PRIV_H__ */
@@ -0,0 +1,84 @@
+/**
+ * \file dash/dart/mpi/dart_symheap.h
+ *
+ * Allocator for symmetric heaps from which collective allocations of a
+ * team are carved out.
+ *
+ * The allocator only manages offsets into the heap. As collective
+ * allocations are performed by all units of a team in the same order and
+ * with the same size, all units compute identical offsets without
+ * communication.
+ */
+#ifndef DART__MPI__DART_SYMHEAP_H__
+#define DART__MPI__DART_SYMHEAP_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * Name of the environment variable specifying the per-unit size of the
+ * symmetric heap reserved for every team, e.g. \c 64M.
+ */
+#define DART_SYMHEAP_SIZE_ENVSTR     "DART_SYMHEAP_SIZE"
+
+/**
+ * Alignment of allocations in the symmetric heap, in bytes.
+ */
+#define DART_SYMHEAP_ALIGN_BYTES     64
+
+/**
+ * Offset of an allocation that cannot be served from the heap.
+ */
+#define DART_SYMHEAP_INVALID_OFFSET  ((uint64_t)(-1))
+
+// forward declaration
+struct dart_symheap;
+
+/**
+ * Per-unit size of the symmetric heap reserved on the first collective
+ * allocation of a team, 0 if disabled.
+ * Set from \c DART_SYMHEAP_SIZE_ENVSTR in \c dart_init.
+ */
+extern size_t dart__mpi__symheap_size DART_INTERNAL;
+
+/**
+ * Create a new symmetric heap allocator managing \c size bytes.
+ *
+ * \return The new allocator or \c NULL if its state cannot be allocated.
+ */
+struct dart_symheap *
+dart_symheap_new(size_t size) DART_INTERNAL;
+
+/**
+ * Delete the given symmetric heap allocator instance.
+ */
+void
+dart_symheap_delete(struct dart_symheap * heap) DART_INTERNAL;
+
+/**
+ * Allocate \c nbytes from the heap using first-fit.
+ *
+ * On success, \c offset is set to the offset of the allocation relative
+ * to the beginning of the heap, otherwise to
+ * \c DART_SYMHEAP_INVALID_OFFSET.
+ *
+ * \return \c DART_ERR_NOTFOUND if the heap is exhausted,
+ *         \c DART_ERR_OTHER if the heap's block list cannot be extended.
+ */
+dart_ret_t
+dart_symheap_alloc(
+  struct dart_symheap * heap,
+  size_t                nbytes,
+  uint64_t            * offset) DART_INTERNAL;
+
+/**
+ * Return the allocation starting at \c offset to the heap.
+ * Adjacent free blocks are coalesced.
+ */
+dart_ret_t
+dart_symheap_free(struct dart_symheap * heap, uint64_t offset) DART_INTERNAL;
+
+#endif /* DART__MPI__DART_SYMHEAP_H__ */
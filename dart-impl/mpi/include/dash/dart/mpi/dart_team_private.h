@@ -143,6 +143,7 @@
 #include <dash/dart/mpi/dart_mem.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_stats.h>
 
 extern dart_team_t dart_next_availteamid DART_INTERNAL;
 
@@ -167,6 +168,17 @@ typedef struct dart_team_data {
 
   dart_segmentdata_t segdata;
 
+  /**
+   * @brief Symmetric heap from which collective allocations on this team
+   * are served, NULL if no heap has been reserved.
+   */
+  struct dart_symheap *symheap;
+
+  /**
+   * @brief ID of the segment backing the symmetric heap.
+   */
+  dart_segid_t symheap_segid;
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /**
    * @brief Store the sub-communicator with regard to certain node, where the units can
@@ -192,6 +204,18 @@ typedef struct dart_team_data {
 
   dart_team_t teamid;
 
+  /**
+   * @brief Communication statistics of the calling unit per target unit,
+   * allocated with the team.
+   */
+  dart_stats_target_t *stats_target;
+
+  /**
+   * @brief Communication statistics of the calling unit not related to a
+   * single target unit.
+   */
+  dart_stats_t stats;
+
 } dart_team_data_t;
 
 /* @brief Initiate the free-team-list and allocated-team-list.
@@ -231,6 +255,17 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid) DART_INTERNAL;
 dart_team_data_t *
 dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
 
+/*
+ * Agree on the maximum of a status code of all units in the team, e.g. on
+ * failures of local allocations before entering collective operations
+ * that must not be left by single units.
+ * The call synchronizes the team.
+ */
+dart_ret_t dart__mpi__team_agree_max(
+  const dart_team_data_t * team_data,
+  int                      local_status,
+  int                    * team_status) DART_INTERNAL;
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
  * Allocate shared memory communicator for the given \c team_data.
@@ -14,14 +14,17 @@
 #include <dash/dart/if/dart_communication.h>
 
 #include <dash/dart/mpi/dart_communication_priv.h>
+#include <dash/dart/mpi/dart_handle_pool.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_mem.h>
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_stats_priv.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
+#include <dash/dart/base/trace.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -73,31 +76,59 @@
   CHECK_EQUAL_BASETYPE(_src_type, _dst_type);                                 \
   CHECK_NUM_ELEM(_src_type, _dst_type, _num_elem);
 
+/**
+ * Maximum size in bytes of temporary space allocated on the stack,
+ * sufficient for the requests of 64 handles.
+ */
+#define DART_ALLOC_TMP_STACK_MAX 1024
+
 /**
  * Temporary space allocation:
- *   - on the stack for allocations <=64B
+ *   - on the stack for allocations <=DART_ALLOC_TMP_STACK_MAX
  *   - on the heap otherwise
  * Mainly meant to be used in dart_waitall* and dart_testall*
  */
-#define ALLOC_TMP(__size) ((__size)<=64) ? alloca((__size)) : malloc((__size))
+#define ALLOC_TMP(__size) \
+  ((__size)<=DART_ALLOC_TMP_STACK_MAX) ? alloca((__size)) : malloc((__size))
 /**
- * Temporary space release: calls free() for allocations >64B
+ * Temporary space release: calls free() for allocations
+ * >DART_ALLOC_TMP_STACK_MAX
  */
-#define FREE_TMP(__size, __ptr)        \
-  do {                                 \
-    if ((__size) > 64)                 \
-      free(__ptr);                     \
+#define FREE_TMP(__size, __ptr)                \
+  do {                                         \
+    if ((__size) > DART_ALLOC_TMP_STACK_MAX)   \
+      free(__ptr);                             \
   } while (0)
 
-/** DART handle type for non-blocking one-sided operations. */
-struct dart_handle_struct
+size_t dart__mpi__accumulate_indexed_chunk = DART_ACCUMULATE_INDEXED_CHUNK;
+
+/**
+ * Number of bytes in \c nelem elements of \c dtype for tracing.
+ * Only evaluated if a trace callback is registered.
+ */
+static inline size_t dart__mpi__trace_nbytes(
+  size_t          nelem,
+  dart_datatype_t dtype)
+{
+  int size = dart__mpi__datatype_sizeof(dart__mpi__datatype_base(dtype));
+  return (size > 0) ? nelem * size : 0;
+}
+
+static size_t dart__mpi__trace_nbytes_v(
+  const size_t    * nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
 {
-  MPI_Request reqs[2];   // a large transfer might consist of two operations
-  MPI_Win     win;
-  dart_unit_t dest;
-  uint8_t     num_reqs;
-  bool        needs_flush;
-};
+  size_t nunits = 0;
+  size_t total  = 0;
+  if (nelem == NULL || dart_team_size(teamid, &nunits) != DART_OK) {
+    return 0;
+  }
+  for (size_t u = 0; u < nunits; ++u) {
+    total += nelem[u];
+  }
+  return dart__mpi__trace_nbytes(total, dtype);
+}
 
 /**
  * Help to check for return of MPI call.
@@ -313,24 +344,24 @@ dart__mpi__get_complex(
   }
 
   DART_LOG_TRACE("dart_get:  MPI_Rget (dest %p, size %zu)", dest_ptr, nelem);
-  CHECK_MPI_RET(
-    dart__mpi__get(dest_ptr,
-            dst_num_elem,
-            dst_mpi_type,
-            team_unit_id.id,
-            offset,
-            src_num_elem,
-            src_mpi_type,
-            win,
-            reqs, num_reqs),
-    "MPI_Rget");
-  // clean-up strided data types
+  int mpi_ret = dart__mpi__get(dest_ptr,
+                  dst_num_elem,
+                  dst_mpi_type,
+                  team_unit_id.id,
+                  offset,
+                  src_num_elem,
+                  src_mpi_type,
+                  win,
+                  reqs, num_reqs);
+  // clean-up strided data types before checking the result to release
+  // their references in the type cache on every path
   if (dart__mpi__datatype_isstrided(src_type)) {
     dart__mpi__destroy_strided_mpi(&src_mpi_type);
   }
   if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
     dart__mpi__destroy_strided_mpi(&dst_mpi_type);
   }
+  CHECK_MPI_RET(mpi_ret, "MPI_Rget");
   return DART_OK;
 }
 
@@ -458,25 +489,25 @@ dart__mpi__put_complex(
     "dart_put:  MPI_Put (src %p, size %zu, src_type %p, dst_type %p)",
     src_ptr, nelem, src_mpi_type, dst_mpi_type);
 
-  CHECK_MPI_RET(
-    dart__mpi__put(src_ptr,
-            src_num_elem,
-            src_mpi_type,
-            team_unit_id.id,
-            offset,
-            dst_num_elem,
-            dst_mpi_type,
-            win,
-            reqs, num_reqs),
-    "MPI_Put");
-
-  // clean-up strided data types
+  int mpi_ret = dart__mpi__put(src_ptr,
+                  src_num_elem,
+                  src_mpi_type,
+                  team_unit_id.id,
+                  offset,
+                  dst_num_elem,
+                  dst_mpi_type,
+                  win,
+                  reqs, num_reqs);
+
+  // clean-up strided data types before checking the result to release
+  // their references in the type cache on every path
   if (dart__mpi__datatype_isstrided(src_type)) {
     dart__mpi__destroy_strided_mpi(&src_mpi_type);
   }
   if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
     dart__mpi__destroy_strided_mpi(&dst_mpi_type);
   }
+  CHECK_MPI_RET(mpi_ret, "MPI_Put");
   return DART_OK;
 }
 
@@ -491,6 +522,7 @@ dart_ret_t dart_get(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_TRACE_SCOPE(DART_TRACE_GET, dart__mpi__trace_nbytes(nelem, src_type));
   uint64_t         offset       = gptr.addr_or_offs.offset;
   int16_t          seg_id       = gptr.segid;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -514,6 +546,11 @@ dart_ret_t dart_get(
     return DART_ERR_INVAL;
   }
 
+  DART_STATS_RMA(DART_STATS_GET, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, src_type),
+                 dart__mpi__datatype_isbasic(src_type) &&
+                   dart__mpi__datatype_isbasic(dst_type));
+
   dart_ret_t ret = DART_OK;
 
   // leave complex data type handling to MPI
@@ -540,6 +577,7 @@ dart_ret_t dart_put(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_TRACE_SCOPE(DART_TRACE_PUT, dart__mpi__trace_nbytes(nelem, src_type));
   uint64_t         offset       = gptr.addr_or_offs.offset;
   int16_t          seg_id       = gptr.segid;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -563,6 +601,11 @@ dart_ret_t dart_put(
     return DART_ERR_INVAL;
   }
 
+  DART_STATS_RMA(DART_STATS_PUT, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, src_type),
+                 dart__mpi__datatype_isbasic(src_type) &&
+                   dart__mpi__datatype_isbasic(dst_type));
+
   dart_ret_t ret = DART_OK;
 
   if (dart__mpi__datatype_isbasic(src_type) &&
@@ -589,6 +632,7 @@ dart_ret_t dart_accumulate(
   dart_datatype_t  dtype,
   dart_operation_t op)
 {
+  DART_TRACE_SCOPE(DART_TRACE_ACCUMULATE, dart__mpi__trace_nbytes(nelem, dtype));
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t    offset = gptr.addr_or_offs.offset;
   int16_t     seg_id = gptr.segid;
@@ -617,6 +661,10 @@ dart_ret_t dart_accumulate(
     return DART_ERR_INVAL;
   }
 
+  DART_STATS_RMA(DART_STATS_ACC, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, dtype),
+                 false);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -675,6 +723,7 @@ dart_ret_t dart_accumulate_blocking_local(
   dart_datatype_t  dtype,
   dart_operation_t op)
 {
+  DART_TRACE_SCOPE(DART_TRACE_ACCUMULATE, dart__mpi__trace_nbytes(nelem, dtype));
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t    offset = gptr.addr_or_offs.offset;
   int16_t     seg_id = gptr.segid;
@@ -702,6 +751,10 @@ dart_ret_t dart_accumulate_blocking_local(
     return DART_ERR_INVAL;
   }
 
+  DART_STATS_RMA(DART_STATS_ACC, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, dtype),
+                 false);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -759,6 +812,122 @@ dart_ret_t dart_accumulate_blocking_local(
   return DART_OK;
 }
 
+dart_ret_t dart_accumulate_indexed(
+  dart_gptr_t      gptr,
+  const void     * values,
+  const uint64_t * offsets,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op)
+{
+  DART_TRACE_SCOPE(DART_TRACE_ACCUMULATE, dart__mpi__trace_nbytes(nelem, dtype));
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t    offset = gptr.addr_or_offs.offset;
+  int16_t     seg_id = gptr.segid;
+  dart_team_t teamid = gptr.teamid;
+
+  CHECK_IS_BASICTYPE(dtype);
+  MPI_Op      mpi_op = dart__mpi__op(op);
+
+  if (nelem == 0) {
+    return DART_OK;
+  }
+  if (dart__unlikely(nelem > INT_MAX)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  DART_LOG_DEBUG("dart_accumulate_indexed() nelem:%zu dtype:%ld op:%d "
+                 "unit:%d", nelem, dtype, op, team_unit_id.id);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_indexed ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART_STATS_RMA(DART_STATS_ACC, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, dtype),
+                 false);
+
+  MPI_Win win = seginfo->win;
+  offset     += dart_segment_disp(seginfo, team_unit_id);
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  size_t       elem_size = dart__mpi__datatype_sizeof(dtype);
+
+  // Updates are issued in chunks of bounded size, see
+  // DART_ACCUMULATE_INDEXED_CHUNK_ENVSTR.
+  size_t max_chunk = dart__mpi__accumulate_indexed_chunk;
+  if (max_chunk == 0 || max_chunk > nelem) {
+    max_chunk = nelem;
+  }
+  MPI_Aint    *displs    = ALLOC_TMP(max_chunk * sizeof(MPI_Aint));
+  const char  *src_ptr   = (const char*) values;
+  dart_ret_t   ret       = DART_OK;
+
+  for (size_t first = 0; first < nelem; first += max_chunk) {
+    size_t n = (nelem - first < max_chunk) ? nelem - first : max_chunk;
+    // byte displacements of the target elements
+    for (size_t i = 0; i < n; ++i) {
+      displs[i] = (MPI_Aint)(offsets[first + i] * elem_size);
+    }
+    MPI_Datatype target_type;
+    if (MPI_Type_create_hindexed_block(
+          n, 1, displs, mpi_dtype, &target_type) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_accumulate_indexed ! "
+                     "MPI_Type_create_hindexed_block failed!");
+      ret = DART_ERR_OTHER;
+      break;
+    }
+    if (MPI_Type_commit(&target_type) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_accumulate_indexed ! MPI_Type_commit failed!");
+      MPI_Type_free(&target_type);
+      ret = DART_ERR_OTHER;
+      break;
+    }
+
+    DART_LOG_TRACE("dart_accumulate_indexed:  MPI_Accumulate (src %p, "
+                   "size %zu)", src_ptr, n);
+    int mpi_ret = MPI_Accumulate(
+                    src_ptr,
+                    n,
+                    mpi_dtype,
+                    team_unit_id.id,
+                    offset,
+                    1,
+                    target_type,
+                    mpi_op,
+                    win);
+    // the datatype is only released once pending operations completed
+    MPI_Type_free(&target_type);
+    if (mpi_ret != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_accumulate_indexed ! MPI_Accumulate failed!");
+      ret = DART_ERR_OTHER;
+      break;
+    }
+    src_ptr += n * elem_size;
+  }
+  FREE_TMP(max_chunk * sizeof(MPI_Aint), displs);
+
+  if (ret != DART_OK) {
+    return ret;
+  }
+  DART_LOG_DEBUG("dart_accumulate_indexed > finished");
+  return DART_OK;
+}
+
 
 dart_ret_t dart_fetch_and_op(
   dart_gptr_t      gptr,
@@ -767,6 +936,7 @@ dart_ret_t dart_fetch_and_op(
   dart_datatype_t  dtype,
   dart_operation_t op)
 {
+  DART_TRACE_SCOPE(DART_TRACE_FETCH_AND_OP, dart__mpi__trace_nbytes(1, dtype));
   MPI_Datatype mpi_dtype;
   MPI_Op       mpi_op;
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -794,6 +964,10 @@ dart_ret_t dart_fetch_and_op(
 
   CHECK_UNITID_RANGE(team_unit_id, team_data);
 
+  DART_STATS_RMA(DART_STATS_ACC, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(1, dtype),
+                 false);
+
   DART_LOG_DEBUG("dart_fetch_and_op() dtype:%ld op:%d unit:%d "
                  "offset:%"PRIu64" segid:%d",
                  dtype, op, team_unit_id.id,
@@ -825,6 +999,7 @@ dart_ret_t dart_compare_and_swap(
   void           * result,
   dart_datatype_t  dtype)
 {
+  DART_TRACE_SCOPE(DART_TRACE_COMPARE_AND_SWAP, dart__mpi__trace_nbytes(1, dtype));
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t    offset = gptr.addr_or_offs.offset;
   int16_t     seg_id = gptr.segid;
@@ -857,6 +1032,10 @@ dart_ret_t dart_compare_and_swap(
     return DART_ERR_INVAL;
   }
 
+  DART_STATS_RMA(DART_STATS_ACC, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(1, dtype),
+                 false);
+
   MPI_Win win  = seginfo->win;
   offset      += dart_segment_disp(seginfo, team_unit_id);
 
@@ -876,20 +1055,25 @@ dart_ret_t dart_compare_and_swap(
 
 /* -- Non-blocking dart one-sided operations -- */
 
-dart_ret_t dart_get_handle(
-  void          * dest,
-  dart_gptr_t     gptr,
-  size_t          nelem,
-  dart_datatype_t src_type,
-  dart_datatype_t dst_type,
-  dart_handle_t * handleptr)
+/**
+ * Issue a get operation, requests are appended to \c reqs.
+ */
+static dart_ret_t dart__mpi__get_nb(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  MPI_Request     * reqs,
+  uint8_t         * num_reqs,
+  MPI_Win         * win)
 {
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t         offset = gptr.addr_or_offs.offset;
   int16_t          seg_id = gptr.segid;
   dart_team_t      teamid = gptr.teamid;
 
-  *handleptr = DART_HANDLE_NULL;
+  *num_reqs = 0;
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (dart__unlikely(team_data == NULL)) {
@@ -907,61 +1091,52 @@ dart_ret_t dart_get_handle(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win win  = seginfo->win;
-
-  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
-  handle->dest         = team_unit_id.id;
-  handle->win          = win;
-  handle->needs_flush  = false;
+  DART_STATS_RMA(DART_STATS_GET, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, src_type),
+                 dart__mpi__datatype_isbasic(src_type) &&
+                   dart__mpi__datatype_isbasic(dst_type));
 
+  *win = seginfo->win;
 
   DART_LOG_DEBUG("dart_get_handle() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
                  team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
-  DART_LOG_TRACE("dart_get_handle:  allocated handle:%p", (void *)(handle));
-
-  dart_ret_t ret = DART_OK;
 
   // leave complex data type handling to MPI
   if (dart__mpi__datatype_isbasic(src_type) &&
       dart__mpi__datatype_isbasic(dst_type)) {
     // fast-path for basic types
     CHECK_EQUAL_BASETYPE(src_type, dst_type);
-    ret = dart__mpi__get_basic(team_data, team_unit_id, seginfo, dest,
-                               offset, nelem, src_type,
-                               handle->reqs, &handle->num_reqs);
-  } else {
-    // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
-                                 offset, nelem, src_type, dst_type,
-                                 handle->reqs, &handle->num_reqs);
-  }
-
-  if (handle->num_reqs == 0) {
-    free(handle);
-    handle = DART_HANDLE_NULL;
+    return dart__mpi__get_basic(team_data, team_unit_id, seginfo, dest,
+                                offset, nelem, src_type,
+                                reqs, num_reqs);
   }
-
-  *handleptr = handle;
-
-  DART_LOG_TRACE("dart_get_handle > handle(%p) dest:%d",
-                 (void*)(handle), team_unit_id.id);
-  return ret;
+  // slow path for derived types
+  return dart__mpi__get_complex(team_unit_id, seginfo, dest,
+                                offset, nelem, src_type, dst_type,
+                                reqs, num_reqs);
 }
 
-dart_ret_t dart_put_handle(
+/**
+ * Issue a put operation, requests are appended to \c reqs.
+ */
+static dart_ret_t dart__mpi__put_nb(
   dart_gptr_t       gptr,
   const void      * src,
   size_t            nelem,
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type,
-  dart_handle_t   * handleptr)
+  MPI_Request     * reqs,
+  uint8_t         * num_reqs,
+  bool            * needs_flush,
+  MPI_Win         * win)
 {
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t     offset   = gptr.addr_or_offs.offset;
   int16_t      seg_id   = gptr.segid;
   dart_team_t  teamid   = gptr.teamid;
 
-  *handleptr = DART_HANDLE_NULL;
+  *num_reqs    = 0;
+  *needs_flush = false;
 
   CHECK_EQUAL_BASETYPE(src_type, dst_type);
 
@@ -981,43 +1156,111 @@ dart_ret_t dart_put_handle(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win win  = seginfo->win;
-
-  // chunk up the put
-  dart_handle_t handle   = calloc(1, sizeof(struct dart_handle_struct));
-  handle->dest           = team_unit_id.id;
-  handle->win            = win;
-  handle->needs_flush    = true;
+  DART_STATS_RMA(DART_STATS_PUT, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, src_type),
+                 dart__mpi__datatype_isbasic(src_type) &&
+                   dart__mpi__datatype_isbasic(dst_type));
 
-  dart_ret_t ret = DART_OK;
+  *win = seginfo->win;
 
   if (dart__mpi__datatype_isbasic(src_type) &&
       dart__mpi__datatype_isbasic(dst_type)) {
     // fast path for basic data types
-    CHECK_EQUAL_BASETYPE(src_type, dst_type);
-    ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
-                               offset, nelem, src_type,
-                               handle->reqs,
-                               &handle->num_reqs,
-                               &handle->needs_flush);
-  } else {
-    // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
-                                 offset, nelem, src_type, dst_type,
-                                 handle->reqs,
-                                 &handle->num_reqs,
-                                 &handle->needs_flush);
-  }
+    return dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
+                                offset, nelem, src_type,
+                                reqs, num_reqs, needs_flush);
+  }
+  // slow path for complex data types
+  return dart__mpi__put_complex(team_unit_id, seginfo, src,
+                                offset, nelem, src_type, dst_type,
+                                reqs, num_reqs, needs_flush);
+}
 
-  if (handle->num_reqs == 0) {
-    free(handle);
-    handle = DART_HANDLE_NULL;
+dart_ret_t dart_get_handle(
+  void          * dest,
+  dart_gptr_t     gptr,
+  size_t          nelem,
+  dart_datatype_t src_type,
+  dart_datatype_t dst_type,
+  dart_handle_t * handleptr)
+{
+  DART_TRACE_SCOPE(DART_TRACE_GET_HANDLE, dart__mpi__trace_nbytes(nelem, src_type));
+  MPI_Request reqs[2];
+  uint8_t     num_reqs = 0;
+  MPI_Win     win      = MPI_WIN_NULL;
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_ret_t ret = dart__mpi__get_nb(dest, gptr, nelem, src_type, dst_type,
+                                     reqs, &num_reqs, &win);
+
+  // local and shared memory transfers are complete, no handle required
+  if (num_reqs > 0) {
+    dart_handle_t handle = dart__mpi__handle_alloc();
+    if (handle == DART_HANDLE_NULL) {
+      DART_LOG_ERROR("dart_get_handle ! failed to allocate handle");
+      // complete the transfer, it cannot be tracked without a handle
+      MPI_Waitall(num_reqs, reqs, MPI_STATUSES_IGNORE);
+      return DART_ERR_OTHER;
+    }
+    handle->dest         = gptr.unitid;
+    handle->win          = win;
+    handle->team         = gptr.teamid;
+    handle->needs_flush  = false;
+    handle->num_reqs     = num_reqs;
+    handle->reqs[0]      = reqs[0];
+    handle->reqs[1]      = (num_reqs > 1) ? reqs[1] : MPI_REQUEST_NULL;
+    *handleptr           = handle;
   }
 
-  *handleptr = handle;
+  DART_LOG_TRACE("dart_get_handle > handle(%p) dest:%d",
+                 (void*)(*handleptr), gptr.unitid);
+  return ret;
+}
+
+dart_ret_t dart_put_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_handle_t   * handleptr)
+{
+  DART_TRACE_SCOPE(DART_TRACE_PUT_HANDLE, dart__mpi__trace_nbytes(nelem, src_type));
+  MPI_Request reqs[2];
+  uint8_t     num_reqs    = 0;
+  bool        needs_flush = false;
+  MPI_Win     win         = MPI_WIN_NULL;
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_ret_t ret = dart__mpi__put_nb(gptr, src, nelem, src_type, dst_type,
+                                     reqs, &num_reqs, &needs_flush, &win);
+
+  // local and shared memory transfers are complete, no handle required
+  if (num_reqs > 0) {
+    dart_handle_t handle = dart__mpi__handle_alloc();
+    if (handle == DART_HANDLE_NULL) {
+      DART_LOG_ERROR("dart_put_handle ! failed to allocate handle");
+      // complete the transfer, it cannot be tracked without a handle
+      MPI_Waitall(num_reqs, reqs, MPI_STATUSES_IGNORE);
+      if (needs_flush) {
+        MPI_Win_flush(gptr.unitid, win);
+      }
+      return DART_ERR_OTHER;
+    }
+    handle->dest         = gptr.unitid;
+    handle->win          = win;
+    handle->team         = gptr.teamid;
+    handle->needs_flush  = needs_flush;
+    handle->num_reqs     = num_reqs;
+    handle->reqs[0]      = reqs[0];
+    handle->reqs[1]      = (num_reqs > 1) ? reqs[1] : MPI_REQUEST_NULL;
+    *handleptr           = handle;
+  }
 
   DART_LOG_TRACE("dart_put_handle > handle(%p) dest:%d",
-                 (void*)(handle), team_unit_id.id);
+                 (void*)(*handleptr), gptr.unitid);
 
   return ret;
 }
@@ -1034,6 +1277,7 @@ dart_ret_t dart_put_blocking(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_TRACE_SCOPE(DART_TRACE_PUT_BLOCKING, dart__mpi__trace_nbytes(nelem, src_type));
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t          offset       = gptr.addr_or_offs.offset;
   int16_t           seg_id       = gptr.segid;
@@ -1057,6 +1301,11 @@ dart_ret_t dart_put_blocking(
     return DART_ERR_INVAL;
   }
 
+  DART_STATS_RMA(DART_STATS_PUT, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, src_type),
+                 dart__mpi__datatype_isbasic(src_type) &&
+                   dart__mpi__datatype_isbasic(dst_type));
+
   DART_LOG_DEBUG("dart_put_blocking() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
                  team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
 
@@ -1098,6 +1347,7 @@ dart_ret_t dart_get_blocking(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type)
 {
+  DART_TRACE_SCOPE(DART_TRACE_GET_BLOCKING, dart__mpi__trace_nbytes(nelem, src_type));
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t          offset       = gptr.addr_or_offs.offset;
   int16_t           seg_id       = gptr.segid;
@@ -1126,6 +1376,11 @@ dart_ret_t dart_get_blocking(
     return DART_ERR_INVAL;
   }
 
+  DART_STATS_RMA(DART_STATS_GET, team_data, team_unit_id, seginfo,
+                 dart__mpi__trace_nbytes(nelem, src_type),
+                 dart__mpi__datatype_isbasic(src_type) &&
+                   dart__mpi__datatype_isbasic(dst_type));
+
   dart_ret_t ret = DART_OK;
 
   MPI_Request reqs[2]  = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
@@ -1160,6 +1415,10 @@ dart_ret_t dart_get_blocking(
 dart_ret_t dart_flush(
   dart_gptr_t gptr)
 {
+  DART_TRACE_SCOPE(DART_TRACE_FLUSH, 0);
+  DART_STATS_TIMED_SCOPE(DART_STATS_FLUSH, gptr.teamid,
+                         DART_TEAM_UNIT_ID(gptr.unitid),
+                         0);
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   int16_t          seg_id       = gptr.segid;
   dart_team_t      teamid       = gptr.teamid;
@@ -1207,6 +1466,10 @@ dart_ret_t dart_flush(
 dart_ret_t dart_flush_all(
   dart_gptr_t gptr)
 {
+  DART_TRACE_SCOPE(DART_TRACE_FLUSH, 0);
+  DART_STATS_TIMED_SCOPE(DART_STATS_FLUSH, gptr.teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         0);
   int16_t     seg_id = gptr.segid;
   dart_team_t teamid = gptr.teamid;
 
@@ -1252,6 +1515,10 @@ dart_ret_t dart_flush_all(
 dart_ret_t dart_flush_local(
   dart_gptr_t gptr)
 {
+  DART_TRACE_SCOPE(DART_TRACE_FLUSH_LOCAL, 0);
+  DART_STATS_TIMED_SCOPE(DART_STATS_FLUSH, gptr.teamid,
+                         DART_TEAM_UNIT_ID(gptr.unitid),
+                         0);
   int16_t     seg_id = gptr.segid;
   dart_team_t teamid = gptr.teamid;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
@@ -1297,6 +1564,10 @@ dart_ret_t dart_flush_local(
 dart_ret_t dart_flush_local_all(
   dart_gptr_t gptr)
 {
+  DART_TRACE_SCOPE(DART_TRACE_FLUSH_LOCAL, 0);
+  DART_STATS_TIMED_SCOPE(DART_STATS_FLUSH, gptr.teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         0);
   int16_t     seg_id = gptr.segid;
   dart_team_t teamid = gptr.teamid;
   DART_LOG_DEBUG("dart_flush_local_all() gptr: "
@@ -1338,6 +1609,8 @@ dart_ret_t dart_flush_local_all(
 dart_ret_t dart_wait_local(
   dart_handle_t * handleptr)
 {
+  DART_TRACE_SCOPE(DART_TRACE_WAIT_LOCAL, 0);
+  DART_STATS_WAIT_SCOPE();
   DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handleptr));
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
     dart_handle_t handle = *handleptr;
@@ -1357,7 +1630,8 @@ dart_ret_t dart_wait_local(
     } else {
       DART_LOG_TRACE("dart_wait_local:     handle->num_reqs == 0");
     }
-    free(handle);
+    DART_STATS_WAIT_HANDLE(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait_local > finished");
@@ -1367,6 +1641,8 @@ dart_ret_t dart_wait_local(
 dart_ret_t dart_wait(
   dart_handle_t * handleptr)
 {
+  DART_TRACE_SCOPE(DART_TRACE_WAIT, 0);
+  DART_STATS_WAIT_SCOPE();
   DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handleptr));
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
     dart_handle_t handle = *handleptr;
@@ -1390,8 +1666,9 @@ dart_ret_t dart_wait(
     } else {
       DART_LOG_TRACE("dart_wait:     handle->num_reqs == 0");
     }
+    DART_STATS_WAIT_HANDLE(handle);
     /* Free handle resource */
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
   }
   DART_LOG_DEBUG("dart_wait > finished");
@@ -1402,6 +1679,8 @@ dart_ret_t dart_waitall_local(
   dart_handle_t handles[],
   size_t        num_handles)
 {
+  DART_TRACE_SCOPE(DART_TRACE_WAIT_LOCAL, 0);
+  DART_STATS_WAIT_SCOPE();
   dart_ret_t ret = DART_OK;
 
   DART_LOG_DEBUG("dart_waitall_local()");
@@ -1457,8 +1736,9 @@ dart_ret_t dart_waitall_local(
       if (handles[i] != DART_HANDLE_NULL) {
         DART_LOG_TRACE("dart_waitall_local: free handle[%zu] %p",
                        i, (void*)(handles[i]));
+        DART_STATS_WAIT_HANDLE(handles[i]);
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_free(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
@@ -1493,6 +1773,8 @@ dart_ret_t dart_waitall(
   dart_handle_t handles[],
   size_t        n)
 {
+  DART_TRACE_SCOPE(DART_TRACE_WAIT, 0);
+  DART_STATS_WAIT_SCOPE();
   DART_LOG_DEBUG("dart_waitall()");
   if (n == 0) {
     DART_LOG_DEBUG("dart_waitall > number of handles = 0");
@@ -1576,8 +1858,9 @@ dart_ret_t dart_waitall(
         /* Free handle resource */
         DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
                        i, (void*)(handles[i]));
+        DART_STATS_WAIT_HANDLE(handles[i]);
         // free the handle
-        free(handles[i]);
+        dart__mpi__handle_free(handles[i]);
         handles[i] = DART_HANDLE_NULL;
       }
     }
@@ -1642,8 +1925,9 @@ dart_ret_t dart_test_local(
     "MPI_Testall");
 
   if (flag) {
+    DART_STATS_COLL_TEST(handle);
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1679,8 +1963,9 @@ dart_ret_t dart_test(
         "MPI_Win_flush"
       );
     }
+    DART_STATS_COLL_TEST(handle);
     // deallocate handle
-    free(handle);
+    dart__mpi__handle_free(handle);
     *handleptr = DART_HANDLE_NULL;
     *is_finished = 1;
   }
@@ -1726,8 +2011,9 @@ dart_ret_t dart_testall_local(
     if (flag) {
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
+          DART_STATS_COLL_TEST(handles[i]);
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_free(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1787,8 +2073,9 @@ dart_ret_t dart_testall(
 
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
+          DART_STATS_COLL_TEST(handles[i]);
           // free the handle
-          free(handles[i]);
+          dart__mpi__handle_free(handles[i]);
           handles[i] = DART_HANDLE_NULL;
         }
       }
@@ -1805,12 +2092,227 @@ dart_ret_t dart_handle_free(
   dart_handle_t * handleptr)
 {
   if (handleptr != NULL && *handleptr != DART_HANDLE_NULL) {
-    free(*handleptr);
+    dart__mpi__handle_free(*handleptr);
     *handleptr = DART_HANDLE_NULL;
   }
   return DART_OK;
 }
 
+/* -- Non-blocking dart one-sided operations using handle groups -- */
+
+/* requests and windows are stored in the implementation-defined members
+ * of dart_handle_group_t */
+typedef char dart__mpi__handle_group_req_fits[
+               (sizeof(MPI_Request) <= sizeof(uint64_t)) ? 1 : -1];
+typedef char dart__mpi__handle_group_win_fits[
+               (sizeof(MPI_Win) <= sizeof(uint64_t)) ? 1 : -1];
+
+static inline MPI_Request * dart__mpi__group_reqs(dart_handle_group_t *group)
+{
+  return (MPI_Request *)group->reqs;
+}
+
+static inline MPI_Win * dart__mpi__group_wins(dart_handle_group_t *group)
+{
+  return (MPI_Win *)group->wins;
+}
+
+static dart_ret_t dart__mpi__group_complete(
+  dart_handle_group_t * group,
+  bool                  remote)
+{
+  if (group->num_reqs > 0) {
+    DART_LOG_DEBUG("dart_handle_group: MPI_Waitall, %d requests",
+                   group->num_reqs);
+    if (MPI_Waitall(group->num_reqs, dart__mpi__group_reqs(group),
+                    MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_handle_group: MPI_Waitall failed");
+      return DART_ERR_OTHER;
+    }
+    group->num_reqs = 0;
+  }
+  if (remote) {
+    MPI_Win *wins = dart__mpi__group_wins(group);
+    for (uint16_t w = 0; w < group->num_wins; ++w) {
+      DART_LOG_DEBUG("dart_handle_group: MPI_Win_flush_all");
+      if (MPI_Win_flush_all(wins[w]) != MPI_SUCCESS) {
+        DART_LOG_ERROR("dart_handle_group: MPI_Win_flush_all failed");
+        return DART_ERR_OTHER;
+      }
+    }
+    group->num_wins = 0;
+  }
+  if (group->num_reqs == 0 && group->num_wins == 0) {
+    group->team = DART_UNDEFINED_TEAM_ID;
+  }
+  return DART_OK;
+}
+
+/* Window of the segment referenced by gptr. */
+static MPI_Win dart__mpi__gptr_win(dart_gptr_t gptr)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    return MPI_WIN_NULL;
+  }
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), gptr.segid);
+  return (seginfo != NULL) ? seginfo->win : MPI_WIN_NULL;
+}
+
+/**
+ * Make room for the requests of a single operation in the group, completes
+ * the group if it is full.
+ * For put operations, \c gptr is the target used to check whether the
+ * window of the operation can be added to the group.
+ */
+static dart_ret_t dart__mpi__group_reserve(
+  dart_handle_group_t * group,
+  const dart_gptr_t   * gptr)
+{
+  bool full = (group->num_reqs + 2 > DART_HANDLE_GROUP_MAX_REQS);
+  if (gptr != NULL && !full &&
+      group->num_wins == DART_HANDLE_GROUP_MAX_WINS) {
+    MPI_Win  win  = dart__mpi__gptr_win(*gptr);
+    MPI_Win *wins = dart__mpi__group_wins(group);
+    full = true;
+    for (uint16_t w = 0; w < group->num_wins; ++w) {
+      if (wins[w] == win) {
+        full = false;
+        break;
+      }
+    }
+  }
+  if (full) {
+    DART_LOG_TRACE("dart_handle_group: group full, completing operations");
+    return dart__mpi__group_complete(group, true);
+  }
+  return DART_OK;
+}
+
+static void dart__mpi__group_add_win(
+  dart_handle_group_t * group,
+  MPI_Win               win)
+{
+  MPI_Win *wins = dart__mpi__group_wins(group);
+  for (uint16_t w = 0; w < group->num_wins; ++w) {
+    if (wins[w] == win) {
+      return;
+    }
+  }
+  DART_ASSERT(group->num_wins < DART_HANDLE_GROUP_MAX_WINS);
+  wins[group->num_wins++] = win;
+}
+
+dart_ret_t dart_handle_group_init(
+  dart_handle_group_t * group)
+{
+  if (dart__unlikely(group == NULL)) {
+    DART_LOG_ERROR("dart_handle_group_init ! group must not be NULL");
+    return DART_ERR_INVAL;
+  }
+  group->num_reqs = 0;
+  group->num_wins = 0;
+  group->team     = DART_UNDEFINED_TEAM_ID;
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_group_get(
+  void                * dest,
+  dart_gptr_t           gptr,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t * group)
+{
+  DART_TRACE_SCOPE(DART_TRACE_GET_HANDLE, dart__mpi__trace_nbytes(nelem, src_type));
+  dart_ret_t ret = dart__mpi__group_reserve(group, NULL);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  uint8_t num_reqs = 0;
+  MPI_Win win;
+  ret = dart__mpi__get_nb(dest, gptr, nelem, src_type, dst_type,
+                          dart__mpi__group_reqs(group) + group->num_reqs,
+                          &num_reqs, &win);
+  group->num_reqs += num_reqs;
+  if (num_reqs > 0 && group->team == DART_UNDEFINED_TEAM_ID) {
+    group->team = gptr.teamid;
+  }
+  return ret;
+}
+
+dart_ret_t dart_handle_group_put(
+  dart_gptr_t           gptr,
+  const void          * src,
+  size_t                nelem,
+  dart_datatype_t       src_type,
+  dart_datatype_t       dst_type,
+  dart_handle_group_t * group)
+{
+  DART_TRACE_SCOPE(DART_TRACE_PUT_HANDLE, dart__mpi__trace_nbytes(nelem, src_type));
+  dart_ret_t ret = dart__mpi__group_reserve(group, &gptr);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  uint8_t num_reqs    = 0;
+  bool    needs_flush = false;
+  MPI_Win win;
+  ret = dart__mpi__put_nb(gptr, src, nelem, src_type, dst_type,
+                          dart__mpi__group_reqs(group) + group->num_reqs,
+                          &num_reqs, &needs_flush, &win);
+  group->num_reqs += num_reqs;
+  if (ret == DART_OK && needs_flush) {
+    dart__mpi__group_add_win(group, win);
+  }
+  if ((num_reqs > 0 || needs_flush) &&
+      group->team == DART_UNDEFINED_TEAM_ID) {
+    group->team = gptr.teamid;
+  }
+  return ret;
+}
+
+dart_ret_t dart_handle_group_wait(
+  dart_handle_group_t * group)
+{
+  DART_TRACE_SCOPE(DART_TRACE_WAIT, 0);
+  DART_STATS_WAIT_SCOPE();
+  DART_STATS_WAIT_TEAM(group->team);
+  return dart__mpi__group_complete(group, true);
+}
+
+dart_ret_t dart_handle_group_wait_local(
+  dart_handle_group_t * group)
+{
+  DART_TRACE_SCOPE(DART_TRACE_WAIT_LOCAL, 0);
+  DART_STATS_WAIT_SCOPE();
+  DART_STATS_WAIT_TEAM(group->team);
+  return dart__mpi__group_complete(group, false);
+}
+
+dart_ret_t dart_handle_group_test(
+  dart_handle_group_t * group,
+  int32_t             * is_finished)
+{
+  int flag = 1;
+  if (group->num_reqs > 0) {
+    CHECK_MPI_RET(
+      dart__mpi__testall(group->num_reqs, dart__mpi__group_reqs(group),
+                         &flag),
+      "MPI_Testall");
+  }
+  *is_finished = 0;
+  if (flag) {
+    group->num_reqs = 0;
+    dart_ret_t ret = dart__mpi__group_complete(group, true);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    *is_finished = 1;
+  }
+  return DART_OK;
+}
+
 /* -- Dart collective operations -- */
 
 static int _dart_barrier_count = 0;
@@ -1818,6 +2320,10 @@ static int _dart_barrier_count = 0;
 dart_ret_t dart_barrier(
   dart_team_t teamid)
 {
+  DART_TRACE_SCOPE(DART_TRACE_BARRIER, 0);
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         0);
   DART_LOG_DEBUG("dart_barrier() barrier count: %d", _dart_barrier_count);
 
   if (dart__unlikely(teamid == DART_UNDEFINED_TEAM_ID)) {
@@ -1848,6 +2354,10 @@ dart_ret_t dart_bcast(
   dart_team_unit_t    root,
   dart_team_t         teamid)
 {
+  DART_TRACE_SCOPE(DART_TRACE_BCAST, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
   DART_LOG_TRACE("dart_bcast() root:%d team:%d nelem:%"PRIu64"",
                  root.id, teamid, nelem);
 
@@ -1895,6 +2405,10 @@ dart_ret_t dart_scatter(
   dart_team_unit_t    root,
   dart_team_t         teamid)
 {
+  DART_TRACE_SCOPE(DART_TRACE_SCATTER, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
   CHECK_IS_BASICTYPE(dtype);
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
@@ -1956,6 +2470,10 @@ dart_ret_t dart_gather(
   dart_team_unit_t     root,
   dart_team_t          teamid)
 {
+  DART_TRACE_SCOPE(DART_TRACE_GATHER, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
   DART_LOG_TRACE("dart_gather() team:%d nelem:%"PRIu64"",
                  teamid, nelem);
 
@@ -2019,6 +2537,10 @@ dart_ret_t dart_allgather(
   dart_datatype_t   dtype,
   dart_team_t       teamid)
 {
+  DART_TRACE_SCOPE(DART_TRACE_ALLGATHER, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
   DART_LOG_TRACE("dart_allgather() team:%d nelem:%"PRIu64"",
                  teamid, nelem);
 
@@ -2086,6 +2608,10 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid)
 {
+  DART_TRACE_SCOPE(DART_TRACE_ALLGATHER, dart__mpi__trace_nbytes(nsendelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nsendelem, dtype));
   DART_LOG_TRACE("dart_allgatherv() team:%d nsendelem:%"PRIu64"",
                  teamid, nsendelem);
 
@@ -2153,7 +2679,336 @@ dart_ret_t dart_allgatherv(
   return DART_OK;
 }
 
-dart_ret_t dart_allreduce(
+/**
+ * Create an MPI type describing \c nelem values of type \c dtype at
+ * element displacement \c displ in a buffer.
+ * Values are split into chunks of \c MAX_CONTIG_ELEMENTS values and a
+ * remainder so the number of elements and their displacement may exceed
+ * \c INT_MAX.
+ */
+static int dart__mpi__create_chunked_type(
+  size_t            nelem,
+  size_t            displ,
+  dart_datatype_t   dtype,
+  MPI_Datatype    * mpi_type)
+{
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+  const size_t dtype_size = dart__mpi__datatype_sizeof(dtype);
+
+  int          blocklens[2];
+  MPI_Aint     displs[2];
+  MPI_Datatype types[2];
+  int          nblocks = 0;
+  if (nchunks > 0) {
+    blocklens[nblocks] = nchunks;
+    displs[nblocks]    = displ * dtype_size;
+    types[nblocks]     = dart__mpi__datatype_maxtype(dtype);
+    ++nblocks;
+  }
+  if (remainder > 0) {
+    blocklens[nblocks] = remainder;
+    displs[nblocks]    = (displ + nchunks * MAX_CONTIG_ELEMENTS)
+                         * dtype_size;
+    types[nblocks]     = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+    ++nblocks;
+  }
+  int ret = MPI_Type_create_struct(
+              nblocks, blocklens, displs, types, mpi_type);
+  if (ret != MPI_SUCCESS) {
+    return ret;
+  }
+  return MPI_Type_commit(mpi_type);
+}
+
+/**
+ * All-to-all exchange of blocks exceeding \c INT_MAX elements or
+ * displacements.
+ * Every block is described by a dedicated MPI type with displacements
+ * of type \c MPI_Aint and exchanged in a single \c MPI_Alltoallw.
+ *
+ * Count and displacement arrays are \c NULL if the caller failed to
+ * allocate them. Local failures are agreed on by all units of the team
+ * before the exchange, which is then skipped at all units.
+ */
+static dart_ret_t dart__mpi__alltoall_chunked(
+  const void        * sendbuf,
+  const size_t      * nsendelem,
+  const size_t      * senddispls,
+  dart_datatype_t     dtype,
+  void              * recvbuf,
+  const size_t      * nrecvelem,
+  const size_t      * recvdispls,
+  dart_team_data_t  * team_data)
+{
+  int           comm_size  = team_data->size;
+  bool          in_place   = (sendbuf == MPI_IN_PLACE);
+  int          *sendcounts = malloc(sizeof(int) * comm_size);
+  int          *recvcounts = malloc(sizeof(int) * comm_size);
+  int          *displs     = malloc(sizeof(int) * comm_size);
+  MPI_Datatype *sendtypes  = malloc(sizeof(MPI_Datatype) * comm_size);
+  MPI_Datatype *recvtypes  = malloc(sizeof(MPI_Datatype) * comm_size);
+  MPI_Datatype  mpi_dtype  = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  int           failed     = (sendcounts == NULL || recvcounts == NULL ||
+                              displs     == NULL || sendtypes  == NULL ||
+                              recvtypes  == NULL ||
+                              nrecvelem  == NULL || recvdispls == NULL ||
+                              (!in_place &&
+                               (nsendelem == NULL || senddispls == NULL)));
+
+  if (!failed) {
+    // Displacements are encoded in the block types, every non-empty block
+    // consists of a single element of its type:
+    for (int i = 0; i < comm_size; i++) {
+      sendcounts[i] = 0;
+      recvcounts[i] = 0;
+      displs[i]     = 0;
+      sendtypes[i]  = mpi_dtype;
+      recvtypes[i]  = mpi_dtype;
+    }
+    for (int i = 0; i < comm_size && !failed; i++) {
+      if (!in_place && nsendelem[i] > 0) {
+        if (dart__mpi__create_chunked_type(
+              nsendelem[i], senddispls[i], dtype, &sendtypes[i])
+            != MPI_SUCCESS) {
+          sendtypes[i] = mpi_dtype;
+          failed       = 1;
+        }
+        sendcounts[i] = 1;
+      }
+      if (nrecvelem[i] > 0) {
+        if (dart__mpi__create_chunked_type(
+              nrecvelem[i], recvdispls[i], dtype, &recvtypes[i])
+            != MPI_SUCCESS) {
+          recvtypes[i] = mpi_dtype;
+          failed       = 1;
+        }
+        recvcounts[i] = 1;
+      }
+    }
+  }
+
+  // Either all or no units enter the exchange:
+  int        team_failed;
+  dart_ret_t ret = dart__mpi__team_agree_max(team_data, failed, &team_failed);
+  if (ret == DART_OK && team_failed) {
+    DART_LOG_ERROR("dart__mpi__alltoall_chunked ! "
+                   "Failed to create block types");
+    ret = DART_ERR_OTHER;
+  }
+  if (ret == DART_OK &&
+      MPI_Alltoallw(
+        sendbuf,
+        sendcounts,
+        displs,
+        sendtypes,
+        recvbuf,
+        recvcounts,
+        displs,
+        recvtypes,
+        team_data->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__alltoall_chunked ! MPI_Alltoallw failed");
+    ret = DART_ERR_OTHER;
+  }
+
+  if (sendtypes != NULL && recvtypes != NULL) {
+    for (int i = 0; i < comm_size; i++) {
+      if (sendtypes[i] != mpi_dtype) {
+        MPI_Type_free(&sendtypes[i]);
+      }
+      if (recvtypes[i] != mpi_dtype) {
+        MPI_Type_free(&recvtypes[i]);
+      }
+    }
+  }
+  free(sendcounts);
+  free(recvcounts);
+  free(displs);
+  free(sendtypes);
+  free(recvtypes);
+  return ret;
+}
+
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  DART_TRACE_SCOPE(DART_TRACE_ALLTOALL, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  // A NULL send buffer is a valid input for zero send counts, only
+  // identical send and receive buffers denote an in-place transfer:
+  if (NULL != sendbuf && sendbuf == recvbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  if (nelem <= MAX_CONTIG_ELEMENTS) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+    CHECK_MPI_RET(
+      MPI_Alltoall(
+          sendbuf,
+          nelem,
+          mpi_dtype,
+          recvbuf,
+          nelem,
+          mpi_dtype,
+          team_data->comm),
+      "MPI_Alltoall");
+  } else {
+    // chunk up the blocks of every unit
+    int     comm_size = team_data->size;
+    size_t *counts    = malloc(sizeof(size_t) * comm_size);
+    size_t *displs    = malloc(sizeof(size_t) * comm_size);
+    if (counts != NULL && displs != NULL) {
+      for (int i = 0; i < comm_size; i++) {
+        counts[i] = nelem;
+        displs[i] = i * nelem;
+      }
+    } else {
+      // the chunked exchange is skipped at all units
+      free(counts);
+      free(displs);
+      counts = NULL;
+      displs = NULL;
+    }
+    dart_ret_t ret = dart__mpi__alltoall_chunked(
+                       sendbuf, counts, displs, dtype,
+                       recvbuf, counts, displs, team_data);
+    free(counts);
+    free(displs);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart_alltoall ! team:%d nelem:%"PRIu64" failed",
+                     teamid, nelem);
+      return ret;
+    }
+  }
+
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  // nsendelem is not referenced in in-place transfers
+  const size_t * ncontrib = (NULL != sendbuf && sendbuf == recvbuf)
+                              ? nrecvelem
+                              : nsendelem;
+  DART_TRACE_SCOPE(DART_TRACE_ALLTOALL,
+                   dart__mpi__trace_nbytes_v(ncontrib, dtype, teamid));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, teamid,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes_v(ncontrib, dtype, teamid));
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  // A NULL send buffer is a valid input for zero send counts, only
+  // identical send and receive buffers denote an in-place transfer:
+  if (NULL != sendbuf && sendbuf == recvbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  bool in_place  = (sendbuf == MPI_IN_PLACE);
+  int  comm_size = team_data->size;
+
+  // convert counts and displacements, fall back to chunked transfers if
+  // any of them exceeds INT_MAX at any unit
+  enum {
+    ALLTOALLV_CONTIG  = 0,
+    ALLTOALLV_CHUNKED = 1,
+    ALLTOALLV_FAILED  = 2
+  };
+  int   mode        = ALLTOALLV_CONTIG;
+  int  *isendcounts = malloc(sizeof(int) * comm_size);
+  int  *isenddispls = malloc(sizeof(int) * comm_size);
+  int  *irecvcounts = malloc(sizeof(int) * comm_size);
+  int  *irecvdispls = malloc(sizeof(int) * comm_size);
+  if (isendcounts == NULL || isenddispls == NULL ||
+      irecvcounts == NULL || irecvdispls == NULL) {
+    mode = ALLTOALLV_FAILED;
+  }
+  for (int i = 0; i < comm_size && mode == ALLTOALLV_CONTIG; i++) {
+    if ((!in_place &&
+         (nsendelem[i]  > MAX_CONTIG_ELEMENTS ||
+          senddispls[i] > MAX_CONTIG_ELEMENTS)) ||
+        nrecvelem[i]  > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i] > MAX_CONTIG_ELEMENTS)
+    {
+      mode = ALLTOALLV_CHUNKED;
+      break;
+    }
+    isendcounts[i] = in_place ? 0 : nsendelem[i];
+    isenddispls[i] = in_place ? 0 : senddispls[i];
+    irecvcounts[i] = nrecvelem[i];
+    irecvdispls[i] = recvdispls[i];
+  }
+
+  // MPI_Alltoallv and MPI_Alltoallw do not match, all units have to use
+  // the same exchange:
+  int        team_mode;
+  dart_ret_t ret = dart__mpi__team_agree_max(team_data, mode, &team_mode);
+  if (ret != DART_OK || team_mode == ALLTOALLV_FAILED) {
+    ret = DART_ERR_OTHER;
+  } else if (team_mode == ALLTOALLV_CHUNKED) {
+    ret = dart__mpi__alltoall_chunked(
+            sendbuf, nsendelem, senddispls, dtype,
+            recvbuf, nrecvelem, recvdispls, team_data);
+  } else {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+    if (MPI_Alltoallv(
+             sendbuf,
+             isendcounts,
+             isenddispls,
+             mpi_dtype,
+             recvbuf,
+             irecvcounts,
+             irecvdispls,
+             mpi_dtype,
+             team_data->comm) != MPI_SUCCESS) {
+      ret = DART_ERR_OTHER;
+    }
+  }
+  free(isendcounts);
+  free(isenddispls);
+  free(irecvcounts);
+  free(irecvdispls);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    return ret;
+  }
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_allreduce(
   const void       * sendbuf,
   void             * recvbuf,
   size_t             nelem,
@@ -2161,6 +3016,10 @@ dart_ret_t dart_allreduce(
   dart_operation_t   op,
   dart_team_t        team)
 {
+  DART_TRACE_SCOPE(DART_TRACE_ALLREDUCE, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, team,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
 
   CHECK_IS_BASICTYPE(dtype);
 
@@ -2202,6 +3061,10 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team)
 {
+  DART_TRACE_SCOPE(DART_TRACE_REDUCE, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, team,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
   MPI_Comm     comm;
   CHECK_IS_BASICTYPE(dtype);
   MPI_Op       mpi_op    = dart__mpi__op(op);
@@ -2236,6 +3099,343 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+dart_ret_t dart_scan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  DART_TRACE_SCOPE(DART_TRACE_SCAN, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, team,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
+  CHECK_IS_BASICTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_scan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_scan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_MPI_RET(
+    MPI_Scan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm),
+    "MPI_Scan");
+  return DART_OK;
+}
+
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  DART_TRACE_SCOPE(DART_TRACE_EXSCAN, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_STATS_TIMED_SCOPE(DART_STATS_COLLECTIVE, team,
+                         DART_UNDEFINED_TEAM_UNIT_ID,
+                         dart__mpi__trace_nbytes(nelem, dtype));
+  CHECK_IS_BASICTYPE(dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_exscan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_MPI_RET(
+    MPI_Exscan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm),
+    "MPI_Exscan");
+  return DART_OK;
+}
+
+/* -- Non-blocking collective operations -- */
+
+/**
+ * Allocate a handle for a non-blocking collective operation.
+ * Collective handles do not refer to a window and never require a flush,
+ * so they are completed by the same wait and test functions as handles
+ * of one-sided operations.
+ */
+static dart_handle_t dart__mpi__coll_handle_create(void)
+{
+  // handles from the pool are reset
+  dart_handle_t handle = dart__mpi__handle_alloc();
+  if (handle == DART_HANDLE_NULL) {
+    DART_LOG_ERROR("dart__mpi__coll_handle_create ! "
+                   "failed to allocate handle");
+  }
+  return handle;
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_TRACE_SCOPE(DART_TRACE_IBARRIER, 0);
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle_create();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Ibarrier(team_data->comm, &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibarrier ! MPI_Ibarrier failed");
+    dart__mpi__handle_free(handle);
+    return DART_ERR_OTHER;
+  }
+  handle->num_reqs  = 1;
+  handle->coll_team = teamid;
+  *handleptr        = handle;
+
+  DART_LOG_DEBUG("dart_ibarrier > team:%d handle:%p",
+                 teamid, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_TRACE_SCOPE(DART_TRACE_IBCAST, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  // chunk up the bcast if necessary, every chunk is a separate request
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  dart_handle_t handle = dart__mpi__coll_handle_create();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+
+  if (nchunks > 0) {
+    if (MPI_Ibcast(src_ptr, nchunks,
+                   dart__mpi__datatype_maxtype(dtype),
+                   root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      dart__mpi__handle_free(handle);
+      return DART_ERR_OTHER;
+    }
+    handle->num_reqs++;
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS *
+               dart__mpi__datatype_sizeof(dtype);
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+    if (MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      // the first chunk cannot be cancelled
+      MPI_Waitall(handle->num_reqs, handle->reqs, MPI_STATUSES_IGNORE);
+      dart__mpi__handle_free(handle);
+      return DART_ERR_OTHER;
+    }
+    handle->num_reqs++;
+  }
+
+  if (handle->num_reqs == 0) {
+    dart__mpi__handle_free(handle);
+    handle = DART_HANDLE_NULL;
+  } else {
+    handle->coll_team   = teamid;
+    handle->coll_nbytes = dart__mpi__trace_nbytes(nelem, dtype);
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ibcast > root:%d team:%d nelem:%zu handle:%p",
+                 root.id, teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        teamid,
+  dart_handle_t    * handleptr)
+{
+  DART_TRACE_SCOPE(DART_TRACE_IALLREDUCE, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_LOG_TRACE("dart_iallreduce() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle_create();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Iallreduce(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm,
+           &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallreduce ! MPI_Iallreduce failed");
+    dart__mpi__handle_free(handle);
+    return DART_ERR_OTHER;
+  }
+  handle->num_reqs    = 1;
+  handle->coll_team   = teamid;
+  handle->coll_nbytes = dart__mpi__trace_nbytes(nelem, dtype);
+  *handleptr          = handle;
+
+  DART_LOG_TRACE("dart_iallreduce > team:%d handle:%p",
+                 teamid, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_TRACE_SCOPE(DART_TRACE_IALLGATHER, dart__mpi__trace_nbytes(nelem, dtype));
+  DART_LOG_TRACE("dart_iallgather() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallgather ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallgather ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype  mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  dart_handle_t handle    = dart__mpi__coll_handle_create();
+  if (handle == DART_HANDLE_NULL) {
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Iallgather(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           team_data->comm,
+           &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallgather ! MPI_Iallgather failed");
+    dart__mpi__handle_free(handle);
+    return DART_ERR_OTHER;
+  }
+  handle->num_reqs    = 1;
+  handle->coll_team   = teamid;
+  handle->coll_nbytes = dart__mpi__trace_nbytes(nelem, dtype);
+  *handleptr          = handle;
+
+  DART_LOG_TRACE("dart_iallgather > team:%d handle:%p",
+                 teamid, (void*)handle);
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t               nelem,
@@ -2243,6 +3443,7 @@ dart_ret_t dart_send(
   int                  tag,
   dart_global_unit_t   unit)
 {
+  DART_TRACE_SCOPE(DART_TRACE_SEND, dart__mpi__trace_nbytes(nelem, dtype));
   MPI_Comm comm;
   CHECK_IS_BASICTYPE(dtype);
   MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
@@ -2285,6 +3486,7 @@ dart_ret_t dart_recv(
   int                   tag,
   dart_global_unit_t    unit)
 {
+  DART_TRACE_SCOPE(DART_TRACE_RECV, dart__mpi__trace_nbytes(nelem, dtype));
   MPI_Comm comm;
   CHECK_IS_BASICTYPE(dtype);
   MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
@@ -2333,6 +3535,7 @@ dart_ret_t dart_sendrecv(
   int                  recv_tag,
   dart_global_unit_t   src)
 {
+  DART_TRACE_SCOPE(DART_TRACE_SENDRECV, dart__mpi__trace_nbytes(send_nelem, send_dtype));
   MPI_Comm comm;
   CHECK_IS_BASICTYPE(send_dtype);
   CHECK_IS_BASICTYPE(recv_dtype);
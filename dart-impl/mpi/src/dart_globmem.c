@@ -21,6 +21,8 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_symheap.h>
+#include <dash/dart/mpi/dart_localpool.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -132,12 +134,13 @@ dart_ret_t dart_memalloc(
   dart_myid(&unitid);
   gptr->unitid  = unitid.id;
   gptr->flags   = 0;
-  gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
-  gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
-  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
+  /* For local allocation, the segid is marked as '0' or as
+   * DART_SEGMENT_LOCAL_EXT if served from an extension of the pool. */
+  if (dart_localpool_alloc(
+        nbytes, &gptr->segid, &gptr->addr_or_offs.offset) != DART_OK) {
     DART_LOG_ERROR("dart_memalloc: Out of bounds "
-                   "(dart_buddy_alloc %zu bytes): global memory exhausted",
+                   "(dart_localpool_alloc %zu bytes): global memory exhausted",
                    nbytes);
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
@@ -149,13 +152,15 @@ dart_ret_t dart_memalloc(
 
 dart_ret_t dart_memfree (dart_gptr_t gptr)
 {
-  if (gptr.segid != DART_SEGMENT_LOCAL || gptr.teamid != DART_TEAM_ALL) {
+  if ((gptr.segid != DART_SEGMENT_LOCAL &&
+       gptr.segid != DART_SEGMENT_LOCAL_EXT) ||
+      gptr.teamid != DART_TEAM_ALL) {
     DART_LOG_ERROR("dart_memfree: invalid segment id:%d or team id:%d",
                    gptr.segid, gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  if (dart_localpool_free(gptr.segid, gptr.addr_or_offs.offset) != DART_OK) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
@@ -351,6 +356,7 @@ dart_team_memalloc_aligned_dynamic(
   segment->win     = team_data->window;
   segment->selfbaseptr = sub_mem;
   segment->is_dynamic  = true;
+  segment->is_symheap  = false;
 
 
   /* -- Updating infos on gptr -- */
@@ -429,6 +435,7 @@ dart_team_memalloc_aligned_full(
   segment->shmwin      = MPI_WIN_NULL;
   segment->win         = win;
   segment->is_dynamic  = false;
+  segment->is_symheap  = false;
 
 
   gptr->segid  = segment->segid;
@@ -440,14 +447,13 @@ dart_team_memalloc_aligned_full(
   return DART_OK;
 }
 
-dart_ret_t
-dart_team_memalloc_aligned(
+static dart_ret_t
+dart_team_memalloc_aligned_window(
   dart_team_t       teamid,
   size_t            nelem,
   dart_datatype_t   dtype,
   dart_gptr_t     * gptr)
 {
-  CHECK_IS_BASICTYPE(dtype);
 #ifdef DART_MPI_ENABLE_DYNAMIC_WINDOWS
   return dart_team_memalloc_aligned_dynamic(teamid, nelem, dtype, gptr);
 #else
@@ -455,6 +461,260 @@ dart_team_memalloc_aligned(
 #endif
 }
 
+static dart_ret_t
+dart_team_symheap_reserve(
+  dart_team_data_t * team_data,
+  size_t             nbytes)
+{
+  dart_gptr_t heap_gptr;
+  dart_ret_t  ret = dart_team_memalloc_aligned_window(
+                      team_data->teamid, nbytes, DART_TYPE_BYTE, &heap_gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_team_symheap_reserve ! "
+                   "Failed to allocate heap of %zu bytes on team %d",
+                   nbytes, team_data->teamid);
+    return ret;
+  }
+  struct dart_symheap *heap = dart_symheap_new(nbytes);
+  // all units release the window if the heap state could not be allocated
+  // on any unit
+  int team_failed;
+  if (dart__mpi__team_agree_max(team_data, heap == NULL, &team_failed)
+        != DART_OK || team_failed) {
+    DART_LOG_ERROR("dart_team_symheap_reserve ! "
+                   "Failed to create heap of %zu bytes on team %d",
+                   nbytes, team_data->teamid);
+    if (heap != NULL) {
+      dart_symheap_delete(heap);
+    }
+    dart_team_memfree(heap_gptr);
+    return DART_ERR_OTHER;
+  }
+  team_data->symheap       = heap;
+  team_data->symheap_segid = heap_gptr.segid;
+  DART_LOG_DEBUG("dart_team_symheap_reserve: bytes:%zu segid:%i team:%d",
+                 nbytes, heap_gptr.segid, team_data->teamid);
+  return DART_OK;
+}
+
+/*
+ * Register the allocation at \c offset of the heap in \c segment.
+ */
+static dart_ret_t
+dart_team_symheap_segment_init(
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * heapseg,
+  dart_segment_info_t * segment,
+  uint64_t              offset,
+  size_t                nbytes)
+{
+  // re-use previously allocated memory
+  if (segment->disp == NULL) {
+    segment->disp = malloc(team_data->size * sizeof(MPI_Aint));
+    if (segment->disp == NULL) {
+      return DART_ERR_OTHER;
+    }
+  }
+  for (int u = 0; u < team_data->size; ++u) {
+    segment->disp[u] = dart_segment_disp(heapseg, DART_TEAM_UNIT_ID(u))
+                       + offset;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (heapseg->baseptr != NULL) {
+    if (segment->baseptr == NULL) {
+      segment->baseptr = calloc(team_data->sharedmem_nodesize,
+                                sizeof(char *));
+      if (segment->baseptr == NULL) {
+        return DART_ERR_OTHER;
+      }
+    }
+    for (int i = 0; i < team_data->sharedmem_nodesize; ++i) {
+      segment->baseptr[i] = heapseg->baseptr[i] + offset;
+    }
+  } else
+#endif
+  if (segment->baseptr != NULL) {
+    free(segment->baseptr);
+    segment->baseptr = NULL;
+  }
+
+  segment->size        = nbytes;
+  segment->flags       = 0;
+  segment->selfbaseptr = heapseg->selfbaseptr + offset;
+  segment->shmwin      = heapseg->shmwin;
+  segment->win         = heapseg->win;
+  segment->is_dynamic  = heapseg->is_dynamic;
+  segment->is_symheap  = true;
+  return DART_OK;
+}
+
+/**
+ * Serve a collective allocation from the team's symmetric heap.
+ * The allocation is registered as a segment of its own that shares the
+ * window of the heap, so that global pointers to the allocation start at
+ * offset 0 at every unit.
+ *
+ * Local failures and the allocation size are agreed on by all units of
+ * the team, the call either succeeds or fails at all units.
+ *
+ * \return \c DART_ERR_NOTFOUND if the heap has no free range of the
+ *         requested size, \c DART_ERR_INVAL if units requested different
+ *         sizes, as their offsets in the heap would diverge.
+ */
+static dart_ret_t
+dart_team_memalloc_aligned_symheap(
+  dart_team_data_t * team_data,
+  size_t             nbytes,
+  dart_gptr_t      * gptr)
+{
+  enum {
+    SYMHEAP_ALLOC_OK       = 0,
+    SYMHEAP_ALLOC_NOTFOUND = 1,
+    SYMHEAP_ALLOC_FAILED   = 2,
+    SYMHEAP_ALLOC_MISMATCH = 3
+  };
+  dart_segment_info_t *segment = NULL;
+  uint64_t             offset;
+  dart_ret_t ret = dart_symheap_alloc(team_data->symheap, nbytes, &offset);
+  if (ret == DART_OK) {
+    dart_segment_info_t *heapseg = dart_segment_get_info(
+                                     &team_data->segdata,
+                                     team_data->symheap_segid);
+    segment = dart_segment_alloc(&team_data->segdata, DART_SEGMENT_ALLOC);
+    ret     = (heapseg == NULL || segment == NULL)
+              ? DART_ERR_OTHER
+              : dart_team_symheap_segment_init(
+                  team_data, heapseg, segment, offset, nbytes);
+  }
+
+  // Allocating a window synchronizes the team and callers rely on this,
+  // e.g. by accessing remote memory right after the allocation. Agreeing
+  // on the result synchronizes the team and ensures that either all or no
+  // units fall back to windows of their own.
+  // The minimum and maximum of the requested sizes are agreed on in the
+  // same reduction, units requesting different sizes would place the
+  // allocation at different offsets of the heap.
+  uint64_t agree[3] = {
+    (ret == DART_OK)
+      ? SYMHEAP_ALLOC_OK
+      : ((ret == DART_ERR_NOTFOUND)
+         ? SYMHEAP_ALLOC_NOTFOUND
+         : SYMHEAP_ALLOC_FAILED),
+    (uint64_t)nbytes,
+    ~(uint64_t)nbytes
+  };
+  int team_status;
+  if (MPI_Allreduce(
+        MPI_IN_PLACE, agree, 3, MPI_UINT64_T, MPI_MAX,
+        team_data->comm) != MPI_SUCCESS) {
+    team_status = SYMHEAP_ALLOC_FAILED;
+  } else if (agree[1] != ~agree[2]) {
+    team_status = SYMHEAP_ALLOC_MISMATCH;
+  } else {
+    team_status = (int)agree[0];
+  }
+  if (team_status != SYMHEAP_ALLOC_OK) {
+    if (segment != NULL) {
+      dart_segment_free(&team_data->segdata, segment->segid);
+    }
+    if (offset != DART_SYMHEAP_INVALID_OFFSET) {
+      dart_symheap_free(team_data->symheap, offset);
+    }
+    if (team_status == SYMHEAP_ALLOC_NOTFOUND) {
+      return DART_ERR_NOTFOUND;
+    }
+    if (team_status == SYMHEAP_ALLOC_MISMATCH) {
+      DART_LOG_ERROR("dart_team_memalloc_aligned_symheap ! "
+                     "Units of team %d requested different sizes, "
+                     "local size: %zu bytes",
+                     team_data->teamid, nbytes);
+      return DART_ERR_INVAL;
+    }
+    DART_LOG_ERROR("dart_team_memalloc_aligned_symheap ! "
+                   "Failed to allocate %zu bytes on team %d",
+                   nbytes, team_data->teamid);
+    return DART_ERR_OTHER;
+  }
+
+  gptr->segid  = segment->segid;
+  gptr->unitid = 0;
+  gptr->teamid = team_data->teamid;
+  gptr->flags  = 0;
+  gptr->addr_or_offs.offset = 0;
+
+  DART_LOG_DEBUG("dart_team_memalloc_aligned_symheap: bytes:%zu "
+                 "heap offset:%"PRIu64" segid:%i across team %d",
+                 nbytes, offset, segment->segid, team_data->teamid);
+  return DART_OK;
+}
+
+dart_ret_t
+dart_team_memheap_reserve(
+  dart_team_t       teamid,
+  size_t            nbytes)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_memheap_reserve ! Unknown team %i", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (team_data->symheap != NULL) {
+    DART_LOG_ERROR("dart_team_memheap_reserve ! "
+                   "Team %i already has a symmetric heap", teamid);
+    return DART_ERR_INVAL;
+  }
+  return dart_team_symheap_reserve(team_data, nbytes);
+}
+
+dart_ret_t
+dart_team_memalloc_aligned(
+  dart_team_t       teamid,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_gptr_t     * gptr)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_team_memalloc_aligned ! Unknown team %i", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (team_data->symheap == NULL && dart__mpi__symheap_size > 0) {
+    // reserve the heap on the first allocation on the team
+    dart_ret_t ret = dart_team_symheap_reserve(
+                       team_data, dart__mpi__symheap_size);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  if (team_data->symheap != NULL) {
+    size_t nbytes = nelem * dart__mpi__datatype_sizeof(dtype);
+    dart_ret_t ret = dart_team_memalloc_aligned_symheap(
+                       team_data, nbytes, gptr);
+    if (ret != DART_ERR_NOTFOUND) {
+      return ret;
+    }
+    // heap exhausted, allocate a window of its own
+  }
+  return dart_team_memalloc_aligned_window(teamid, nelem, dtype, gptr);
+}
+
+dart_ret_t
+dart__mpi__symheap_release(dart_team_data_t *team_data)
+{
+  if (team_data->symheap == NULL) {
+    return DART_OK;
+  }
+  dart_gptr_t heap_gptr = DART_GPTR_NULL;
+  heap_gptr.segid  = team_data->symheap_segid;
+  heap_gptr.teamid = team_data->teamid;
+  heap_gptr.unitid = 0;
+  dart_ret_t ret   = dart_team_memfree(heap_gptr);
+  dart_symheap_delete(team_data->symheap);
+  team_data->symheap = NULL;
+  return ret;
+}
+
 dart_ret_t dart_team_memfree(
   dart_gptr_t gptr)
 {
@@ -481,7 +741,19 @@ dart_ret_t dart_team_memfree(
     return DART_ERR_INVAL;
   }
 
-  if (seginfo->is_dynamic) {
+  if (seginfo->is_symheap) {
+    dart_segment_info_t *heapseg = dart_segment_get_info(
+                                     &team_data->segdata,
+                                     team_data->symheap_segid);
+    if (team_data->symheap == NULL || heapseg == NULL ||
+        dart_symheap_free(
+          team_data->symheap,
+          seginfo->selfbaseptr - heapseg->selfbaseptr) != DART_OK) {
+      DART_LOG_ERROR("dart_team_memfree ! "
+                     "Invalid heap segment %i on team %i", segid, teamid);
+      return DART_ERR_INVAL;
+    }
+  } else if (seginfo->is_dynamic) {
     MPI_Win win = team_data->window;
     if (dart_segment_get_selfbaseptr(
           &team_data->segdata, segid, &sub_mem) != DART_OK) {
@@ -0,0 +1,185 @@
+/**
+ * \file dart_handle_pool.c
+ *
+ * Slab-allocated pool of handles with per-thread free lists.
+ */
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/atomic.h>
+#include <dash/dart/base/mutex.h>
+
+#include <dash/dart/mpi/dart_handle_pool.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+typedef struct dart_handle_slab {
+  struct dart_handle_slab   * next;
+  struct dart_handle_struct   handles[DART_HANDLE_POOL_SLAB_SIZE];
+} dart_handle_slab_t;
+
+typedef struct {
+  /* handles in the cache belong to the pool of this generation */
+  int32_t        generation;
+  int            count;
+  dart_handle_t  head;
+} dart_handle_cache_t;
+
+static dart_handle_slab_t * slabs       = NULL;
+/* free handles returned by threads exceeding their cache depth */
+static dart_handle_t        shared_head = DART_HANDLE_NULL;
+static dart_mutex_t         pool_mutex  = DART_MUTEX_INITIALIZER;
+/* incremented on every release of the pool to invalidate thread caches */
+static int32_t              generation  = 0;
+
+static int64_t              num_slabs   = 0;
+static int64_t              num_refills = 0;
+/* handles allocated and not yet returned to the pool */
+static int64_t              num_handles = 0;
+
+/* Cached handles are not returned to the pool when a thread exits. */
+static __thread dart_handle_cache_t tcache;
+
+
+static inline dart_handle_cache_t * thread_cache()
+{
+  // the generation is only written in dart__mpi__handle_pool_fini, a
+  // plain load keeps its cache line shared among threads
+  int32_t gen = DART_LOAD_ACQUIRE32(&generation);
+  if (dart__unlikely(tcache.generation != gen)) {
+    // the pool has been released, drop stale entries
+    memset(&tcache, 0, sizeof(tcache));
+    tcache.generation = gen;
+  }
+  return &tcache;
+}
+
+/* Move up to one slab of handles from the shared free list to the thread
+ * cache, allocate a new slab if the shared free list is empty. */
+static void refill(dart_handle_cache_t * cache)
+{
+  dart__base__mutex_lock(&pool_mutex);
+  ++num_refills;
+  if (shared_head != DART_HANDLE_NULL) {
+    dart_handle_t tail = shared_head;
+    int           n    = 1;
+    while (n < DART_HANDLE_POOL_SLAB_SIZE && tail->next != DART_HANDLE_NULL) {
+      tail = tail->next;
+      ++n;
+    }
+    cache->head  = shared_head;
+    cache->count = n;
+    shared_head  = tail->next;
+    tail->next   = DART_HANDLE_NULL;
+    dart__base__mutex_unlock(&pool_mutex);
+    return;
+  }
+
+  dart_handle_slab_t * slab = malloc(sizeof(dart_handle_slab_t));
+  if (slab == NULL) {
+    dart__base__mutex_unlock(&pool_mutex);
+    DART_LOG_ERROR("dart_handle_pool: failed to allocate slab of %d handles",
+                   DART_HANDLE_POOL_SLAB_SIZE);
+    return;
+  }
+  slab->next = slabs;
+  slabs      = slab;
+  ++num_slabs;
+  dart__base__mutex_unlock(&pool_mutex);
+
+  for (int i = 0; i < DART_HANDLE_POOL_SLAB_SIZE - 1; ++i) {
+    slab->handles[i].next = &slab->handles[i + 1];
+  }
+  slab->handles[DART_HANDLE_POOL_SLAB_SIZE - 1].next = DART_HANDLE_NULL;
+  cache->head  = &slab->handles[0];
+  cache->count = DART_HANDLE_POOL_SLAB_SIZE;
+}
+
+dart_handle_t dart__mpi__handle_alloc()
+{
+  dart_handle_cache_t * cache = thread_cache();
+  if (dart__unlikely(cache->head == DART_HANDLE_NULL)) {
+    refill(cache);
+    if (cache->head == DART_HANDLE_NULL) {
+      return DART_HANDLE_NULL;
+    }
+  }
+  dart_handle_t handle = cache->head;
+  cache->head          = handle->next;
+  --cache->count;
+  DART_FETCH_AND_INC64(&num_handles);
+
+  handle->reqs[0]      = MPI_REQUEST_NULL;
+  handle->reqs[1]      = MPI_REQUEST_NULL;
+  handle->win          = MPI_WIN_NULL;
+  handle->dest         = DART_UNDEFINED_UNIT_ID;
+  handle->num_reqs     = 0;
+  handle->needs_flush  = false;
+  handle->team         = DART_UNDEFINED_TEAM_ID;
+  handle->coll_team    = DART_UNDEFINED_TEAM_ID;
+  handle->coll_nbytes  = 0;
+  handle->next         = DART_HANDLE_NULL;
+  handle->generation   = cache->generation;
+  return handle;
+}
+
+void dart__mpi__handle_free(dart_handle_t handle)
+{
+  if (handle == DART_HANDLE_NULL) {
+    return;
+  }
+  dart_handle_cache_t * cache = thread_cache();
+  if (dart__unlikely(handle->generation != cache->generation)) {
+    // allocated before the pool was released, its slab is not in use
+    DART_LOG_WARN("dart_handle_pool: dropping handle %p of released pool",
+                  (void*)handle);
+    return;
+  }
+  DART_FETCH_AND_DEC64(&num_handles);
+  if (dart__unlikely(cache->count >= DART_HANDLE_POOL_CACHE_DEPTH)) {
+    // return the cached handles to the shared free list
+    dart_handle_t tail = cache->head;
+    while (tail->next != DART_HANDLE_NULL) {
+      tail = tail->next;
+    }
+    dart__base__mutex_lock(&pool_mutex);
+    tail->next  = shared_head;
+    shared_head = cache->head;
+    dart__base__mutex_unlock(&pool_mutex);
+    cache->head  = DART_HANDLE_NULL;
+    cache->count = 0;
+  }
+  handle->next = cache->head;
+  cache->head  = handle;
+  ++cache->count;
+}
+
+dart_ret_t dart__mpi__handle_pool_fini()
+{
+  dart__base__mutex_lock(&pool_mutex);
+  int64_t outstanding = DART_FETCH64(&num_handles);
+  DART_LOG_DEBUG("dart_handle_pool_fini: slabs:%"PRId64" refills:%"PRId64
+                 " outstanding:%"PRId64,
+                 num_slabs, num_refills, outstanding);
+  if (outstanding > 0) {
+    // outstanding handles may still be freed, keep their memory valid
+    DART_LOG_WARN("dart_handle_pool_fini: %"PRId64" handles not freed, "
+                  "leaking %"PRId64" slabs", outstanding, num_slabs);
+  } else {
+    while (slabs != NULL) {
+      dart_handle_slab_t * next = slabs->next;
+      free(slabs);
+      slabs = next;
+    }
+  }
+  slabs       = NULL;
+  shared_head = DART_HANDLE_NULL;
+  num_slabs   = 0;
+  num_refills = 0;
+  num_handles = 0;
+  DART_FETCH_AND_INC32(&generation);
+  dart__base__mutex_unlock(&pool_mutex);
+  return DART_OK;
+}
@@ -14,13 +14,18 @@
 
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_localpool.h>
+#include <dash/dart/mpi/dart_handle_pool.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_symheap.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_stats_priv.h>
 
-#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
+#include <dash/dart/base/env.h>
+#include <dash/dart/base/trace.h>
 
 /* Point to the base address of memory region for local allocation. */
 static int _init_by_dart = 0;
@@ -29,7 +34,7 @@ static int _dart_initialized = 0;
 static
 dart_ret_t create_local_alloc(dart_team_data_t *team_data)
 {
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
+  size_t local_alloc_size = dart_localpool_size_from_env();
   MPI_Win dart_sharedmem_win_local_alloc;
   char* *dart_sharedmem_local_baseptr_set = NULL;
 
@@ -40,15 +45,15 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   MPI_Comm sharedmem_comm = team_data->sharedmem_comm;
 
   if (sharedmem_comm != MPI_COMM_NULL) {
-    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%d)",
-                   DART_LOCAL_ALLOC_SIZE);
+    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%zu)",
+                   local_alloc_size);
     MPI_Info win_info;
     MPI_Info_create(&win_info);
     MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
     /* Reserve a free shared memory block for non-collective
      * global memory allocation. */
     int ret = MPI_Win_allocate_shared(
-                DART_LOCAL_ALLOC_SIZE,
+                local_alloc_size,
                 sizeof(char),
                 win_info,
                 sharedmem_comm,
@@ -92,7 +97,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   }
 #else
   MPI_Alloc_mem(
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     MPI_INFO_NULL,
     &dart_mempool_localalloc);
 #endif
@@ -103,7 +108,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
    * Return in dart_win_local_alloc. */
   MPI_Win_create(
     dart_mempool_localalloc,
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     sizeof(char),
     MPI_INFO_NULL,
     DART_COMM_WORLD,
@@ -121,7 +126,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
                                 &team_data->segdata, DART_SEGMENT_LOCAL_ALLOC);
   segment->flags       = 1;
   segment->segid       = 0;
-  segment->size        = DART_LOCAL_ALLOC_SIZE;
+  segment->size        = local_alloc_size;
   segment->baseptr     = dart_sharedmem_local_baseptr_set;
   segment->win         = dart_win_local_alloc;
   segment->shmwin      = dart_sharedmem_win_local_alloc;
@@ -130,7 +135,9 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   segment->disp        = calloc(team_data->size, sizeof(MPI_Aint));
   segment->is_dynamic       = false;
 
-  return DART_OK;
+  /* the pool is extended through the dynamic window of DART_TEAM_ALL */
+  return dart_localpool_init(
+           dart_mempool_localalloc, local_alloc_size, team_data->window);
 }
 
 static
@@ -156,6 +163,17 @@ dart_ret_t do_init()
     return DART_ERR_OTHER;
   }
 
+  dart__mpi__symheap_size = dart__base__env__size(
+                              DART_SYMHEAP_SIZE_ENVSTR, 0);
+
+  dart__mpi__accumulate_indexed_chunk = dart__base__env__size(
+                                          DART_ACCUMULATE_INDEXED_CHUNK_ENVSTR,
+                                          DART_ACCUMULATE_INDEXED_CHUNK);
+
+  if (dart__base__env__bool(DART_STATS_ENVSTR, false)) {
+    dart__mpi__stats_enabled = true;
+  }
+
   dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
 
   /* Create a global translation table for all
@@ -168,11 +186,8 @@ dart_ret_t do_init()
 
   MPI_Comm_rank(team_data->comm, &team_data->unitid);
   MPI_Comm_size(team_data->comm, &team_data->size);
-
-  ret = create_local_alloc(team_data);
-  if (ret != DART_OK) {
-    return ret;
-  }
+  team_data->stats_target = calloc(team_data->size,
+                                   sizeof(dart_stats_target_t));
 
   /* Create a dynamic win object for all the dart collective
    * allocation based on MPI_COMM_WORLD. Return in win. */
@@ -186,6 +201,11 @@ dart_ret_t do_init()
    * collective allocation function through win. */
   MPI_Win_lock_all(0, win);
 
+  ret = create_local_alloc(team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
@@ -289,6 +309,8 @@ dart_ret_t dart_exit()
     return DART_ERR_OTHER;
   }
 
+  dart__mpi__symheap_release(team_data);
+
   dart_segment_info_t *seginfo = dart_segment_get_info(&team_data->segdata, 0);
 
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
@@ -313,10 +335,10 @@ dart_ret_t dart_exit()
     MPI_Free_mem(dart_mempool_localalloc);
   }
 #endif
+  dart_localpool_fini();
   MPI_Win_free(&team_data->window);
 
   dart_segment_fini(&team_data->segdata);
-  dart_buddy_delete(dart_localpool);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 //  free(team_data->sharedmem_tab);
 //  free(dart_sharedmem_local_baseptr_set);
@@ -326,6 +348,9 @@ dart_ret_t dart_exit()
 
   MPI_Comm_free(&dart_comm_world);
 
+  dart__mpi__handle_pool_fini();
+  dart__base__trace_finalize();
+
   dart__mpi__datatype_fini();
 
   if (_init_by_dart) {
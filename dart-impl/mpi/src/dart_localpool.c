@@ -0,0 +1,442 @@
+/**
+ * \file dart_localpool.c
+ *
+ * Growable pool serving non-collective allocations with per-thread caches
+ * of small size classes.
+ */
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/assert.h>
+#include <dash/dart/base/atomic.h>
+#include <dash/dart/base/mutex.h>
+#include <dash/dart/base/env.h>
+
+#include <dash/dart/if/dart_team_group.h>
+
+#include <dash/dart/mpi/dart_localpool.h>
+#include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/* Smallest size class, a cache line so that cached allocations of
+ * different threads do not share cache lines. Allocations of all sizes
+ * are aligned to this size, the size class map of a block has one entry
+ * per this many bytes. */
+#define DART_LOCALPOOL_MIN_CLASS_BITS 6
+/* Number of allocations and frees of a thread that are counted before
+ * they are added to the pool statistics */
+#define DART_LOCALPOOL_STATS_BATCH 64
+/* Largest block supported by the buddy allocator, which computes sizes
+ * and offsets in int */
+#define DART_LOCALPOOL_MAX_BLOCK_SIZE (((size_t)1) << 31)
+/* Flag in the size class map of allocations held in a thread cache */
+#define DART_LOCALPOOL_CACHED 0x80
+
+typedef struct {
+  char              * base;
+  size_t              size;
+  struct dart_buddy * buddy;
+  /* size class + 1 of every cacheable allocation by offset, 0 otherwise,
+   * with DART_LOCALPOOL_CACHED set while the allocation is cached */
+  uint8_t           * sizeclass;
+  dart_segid_t        segid;
+} dart_localpool_block_t;
+
+typedef struct {
+  int                 block;
+  uint64_t            offset;
+} dart_localpool_cache_entry_t;
+
+typedef struct {
+  /* blocks in the cache belong to the pool of this generation */
+  int32_t                      generation;
+  /* operations not yet added to the pool statistics */
+  int                          num_ops;
+  int64_t                      num_alloc;
+  int64_t                      num_free;
+  int64_t                      num_cache_hits;
+  int                          count[DART_LOCAL_ALLOC_CACHE_CLASSES];
+  dart_localpool_cache_entry_t entries[DART_LOCAL_ALLOC_CACHE_CLASSES]
+                                      [DART_LOCAL_ALLOC_CACHE_DEPTH];
+} dart_localpool_cache_t;
+
+static dart_localpool_block_t blocks[DART_LOCAL_ALLOC_MAX_BLOCKS];
+static int32_t                num_blocks  = 0;
+static dart_mutex_t           grow_mutex  = DART_MUTEX_INITIALIZER;
+static MPI_Win                ext_win     = MPI_WIN_NULL;
+/* incremented on every initialization to invalidate thread caches */
+static int32_t                generation  = 0;
+
+/* statistics of all threads, updated in batches of
+ * DART_LOCALPOOL_STATS_BATCH operations per thread */
+static int64_t                num_alloc      = 0;
+static int64_t                num_free       = 0;
+static int64_t                num_cache_hits = 0;
+
+/* Cached allocations are not returned to the pool when a thread exits. */
+static __thread dart_localpool_cache_t tcache;
+
+
+static inline size_t next_pow2(size_t x)
+{
+  size_t pow2 = 1;
+  while (pow2 < x) {
+    pow2 <<= 1;
+  }
+  return pow2;
+}
+
+static inline int size_class(size_t nbytes)
+{
+  int    cls  = 0;
+  size_t size = ((size_t)1) << DART_LOCALPOOL_MIN_CLASS_BITS;
+  while (size < nbytes) {
+    size <<= 1;
+    ++cls;
+  }
+  return cls;
+}
+
+static inline dart_localpool_cache_t * thread_cache()
+{
+  // the generation is only written in dart_localpool_init, a plain load
+  // keeps its cache line shared among threads
+  int32_t gen = DART_LOAD_ACQUIRE32(&generation);
+  if (dart__unlikely(tcache.generation != gen)) {
+    // the pool has been re-initialized, drop stale entries
+    memset(&tcache, 0, sizeof(tcache));
+    tcache.generation = gen;
+  }
+  return &tcache;
+}
+
+static inline void flush_stats(dart_localpool_cache_t * cache)
+{
+  DART_FETCH_AND_ADD64(&num_alloc,      cache->num_alloc);
+  DART_FETCH_AND_ADD64(&num_free,       cache->num_free);
+  DART_FETCH_AND_ADD64(&num_cache_hits, cache->num_cache_hits);
+  cache->num_alloc      = 0;
+  cache->num_free       = 0;
+  cache->num_cache_hits = 0;
+  cache->num_ops        = 0;
+}
+
+static inline void count_op(dart_localpool_cache_t * cache)
+{
+  if (dart__unlikely(++cache->num_ops >= DART_LOCALPOOL_STATS_BATCH)) {
+    flush_stats(cache);
+  }
+}
+
+/* Set up the allocator state of a block, the block is left empty if
+ * the state cannot be allocated. */
+static dart_ret_t init_block(
+  dart_localpool_block_t * block,
+  char                   * base,
+  size_t                   size,
+  dart_segid_t             segid)
+{
+  struct dart_buddy *buddy     = dart_buddy_new(size);
+  uint8_t           *sizeclass = calloc(
+                                   size >> DART_LOCALPOOL_MIN_CLASS_BITS,
+                                   sizeof(uint8_t));
+  if (buddy == NULL || sizeclass == NULL) {
+    DART_LOG_ERROR("dart_localpool: failed to allocate state of block "
+                   "of %zu bytes", size);
+    if (buddy != NULL) {
+      dart_buddy_delete(buddy);
+    }
+    free(sizeclass);
+    return DART_ERR_OTHER;
+  }
+  block->base      = base;
+  block->size      = size;
+  block->buddy     = buddy;
+  block->sizeclass = sizeclass;
+  block->segid     = segid;
+  return DART_OK;
+}
+
+static void fini_block(dart_localpool_block_t * block)
+{
+  dart_buddy_delete(block->buddy);
+  free(block->sizeclass);
+  block->buddy     = NULL;
+  block->sizeclass = NULL;
+}
+
+size_t dart_localpool_size_from_env()
+{
+  size_t size = dart__base__env__size(
+                  DART_LOCAL_ALLOC_SIZE_ENVSTR, DART_LOCAL_ALLOC_SIZE);
+  if (size < 4096) {
+    size = 4096;
+  }
+  if (size > DART_LOCALPOOL_MAX_BLOCK_SIZE) {
+    DART_LOG_WARN("dart_localpool: limiting %s to %zu bytes",
+                  DART_LOCAL_ALLOC_SIZE_ENVSTR,
+                  DART_LOCALPOOL_MAX_BLOCK_SIZE);
+    size = DART_LOCALPOOL_MAX_BLOCK_SIZE;
+  }
+  return next_pow2(size);
+}
+
+dart_ret_t dart_localpool_init(
+  char    * base,
+  size_t    size,
+  MPI_Win   win)
+{
+  DART_ASSERT(num_blocks == 0);
+  dart_ret_t ret = init_block(&blocks[0], base, size, DART_SEGMENT_LOCAL);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  ext_win = win;
+
+  /* extension blocks are addressed by absolute address in the dynamic
+   * window of DART_TEAM_ALL */
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                   &team_data->segdata,
+                                   DART_SEGMENT_LOCAL_EXT_ALLOC);
+  segment->flags       = 0;
+  segment->size        = 0;
+  segment->baseptr     = NULL;
+  segment->selfbaseptr = NULL;
+  segment->disp        = NULL;
+  segment->win         = win;
+  segment->shmwin      = MPI_WIN_NULL;
+  segment->is_dynamic  = true;
+  segment->is_symheap  = false;
+
+  DART_FETCH_AND_INC32(&generation);
+  DART_FETCH_AND_INC32(&num_blocks);
+  DART_LOG_DEBUG("dart_localpool_init: initial block of %zu bytes", size);
+  return DART_OK;
+}
+
+dart_ret_t dart_localpool_fini()
+{
+  int32_t nblocks = DART_FETCH_AND_ADD32(&num_blocks, 0);
+  for (int i = 0; i < nblocks; ++i) {
+    if (i > 0) {
+      MPI_Win_detach(ext_win, blocks[i].base);
+      MPI_Free_mem(blocks[i].base);
+    }
+    fini_block(&blocks[i]);
+  }
+  DART_LOG_DEBUG("dart_localpool_fini: blocks:%d allocs:%"PRId64" "
+                 "frees:%"PRId64" cache hits:%"PRId64,
+                 nblocks, num_alloc, num_free, num_cache_hits);
+  num_blocks     = 0;
+  num_alloc      = 0;
+  num_free       = 0;
+  num_cache_hits = 0;
+  ext_win        = MPI_WIN_NULL;
+  return DART_OK;
+}
+
+static bool alloc_from_block(
+  int        b,
+  size_t     nbytes,
+  int        cls,
+  uint64_t * offset)
+{
+  dart_localpool_block_t *block = &blocks[b];
+  size_t off = dart_buddy_alloc(block->buddy, nbytes);
+  if (off == (size_t)(-1)) {
+    return false;
+  }
+  // blocks are owned by the caller, no synchronization required
+  block->sizeclass[off >> DART_LOCALPOOL_MIN_CLASS_BITS] =
+    (cls < DART_LOCAL_ALLOC_CACHE_CLASSES) ? cls + 1 : 0;
+  *offset = off;
+  return true;
+}
+
+/* Add an extension block that can hold at least nbytes, called with
+ * grow_mutex held. */
+static bool grow(size_t nbytes)
+{
+  if (num_blocks == DART_LOCAL_ALLOC_MAX_BLOCKS) {
+    DART_LOG_ERROR("dart_localpool: maximum number of %d blocks reached",
+                   DART_LOCAL_ALLOC_MAX_BLOCKS);
+    return false;
+  }
+  size_t size = blocks[0].size;
+  if (size < nbytes) {
+    size = next_pow2(nbytes);
+  }
+  if (size > DART_LOCALPOOL_MAX_BLOCK_SIZE) {
+    DART_LOG_ERROR("dart_localpool: allocation of %zu bytes exceeds "
+                   "maximum block size", nbytes);
+    return false;
+  }
+  char *base;
+  if (MPI_Alloc_mem(size, MPI_INFO_NULL, &base) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_localpool: MPI_Alloc_mem(%zu) failed", size);
+    return false;
+  }
+  if (MPI_Win_attach(ext_win, base, size) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_localpool: MPI_Win_attach(%zu) failed", size);
+    MPI_Free_mem(base);
+    return false;
+  }
+  if (init_block(&blocks[num_blocks], base, size, DART_SEGMENT_LOCAL_EXT)
+        != DART_OK) {
+    MPI_Win_detach(ext_win, base);
+    MPI_Free_mem(base);
+    return false;
+  }
+  // publish the block after it has been set up
+  DART_FETCH_AND_INC32(&num_blocks);
+  DART_LOG_DEBUG("dart_localpool: added block %d of %zu bytes at %p",
+                 num_blocks - 1, size, base);
+  return true;
+}
+
+static inline uint64_t to_segment_offset(int b, uint64_t offset)
+{
+  return (blocks[b].segid == DART_SEGMENT_LOCAL)
+           ? offset
+           : (uint64_t)(uintptr_t)(blocks[b].base + offset);
+}
+
+dart_ret_t dart_localpool_alloc(
+  size_t     nbytes,
+  int16_t  * segid,
+  uint64_t * offset)
+{
+  int cls = size_class(nbytes);
+  dart_localpool_cache_t *cache = thread_cache();
+  ++cache->num_alloc;
+  count_op(cache);
+
+  if (cls < DART_LOCAL_ALLOC_CACHE_CLASSES) {
+    if (cache->count[cls] > 0) {
+      dart_localpool_cache_entry_t *entry =
+        &cache->entries[cls][--cache->count[cls]];
+      ++cache->num_cache_hits;
+      blocks[entry->block].sizeclass[
+        entry->offset >> DART_LOCALPOOL_MIN_CLASS_BITS] &=
+          ~DART_LOCALPOOL_CACHED;
+      *segid  = blocks[entry->block].segid;
+      *offset = to_segment_offset(entry->block, entry->offset);
+      return DART_OK;
+    }
+    // serve the entire size class to make the allocation cacheable
+    nbytes = ((size_t)1) << (cls + DART_LOCALPOOL_MIN_CLASS_BITS);
+  }
+  // allocations larger than the cached size classes are aligned to a
+  // multiple of the smallest class by the buddy allocator
+
+  uint64_t off;
+  int32_t  nblocks = DART_FETCH_AND_ADD32(&num_blocks, 0);
+  for (int b = 0; b < nblocks; ++b) {
+    if (alloc_from_block(b, nbytes, cls, &off)) {
+      *segid  = blocks[b].segid;
+      *offset = to_segment_offset(b, off);
+      return DART_OK;
+    }
+  }
+
+  dart__base__mutex_lock(&grow_mutex);
+  // blocks may have been added concurrently
+  for (int b = nblocks; b < num_blocks; ++b) {
+    if (alloc_from_block(b, nbytes, cls, &off)) {
+      dart__base__mutex_unlock(&grow_mutex);
+      *segid  = blocks[b].segid;
+      *offset = to_segment_offset(b, off);
+      return DART_OK;
+    }
+  }
+  if (grow(nbytes)) {
+    int b = num_blocks - 1;
+    if (alloc_from_block(b, nbytes, cls, &off)) {
+      dart__base__mutex_unlock(&grow_mutex);
+      *segid  = blocks[b].segid;
+      *offset = to_segment_offset(b, off);
+      return DART_OK;
+    }
+  }
+  dart__base__mutex_unlock(&grow_mutex);
+  return DART_ERR_OTHER;
+}
+
+dart_ret_t dart_localpool_free(
+  int16_t    segid,
+  uint64_t   offset)
+{
+  int     b       = -1;
+  int32_t nblocks = DART_FETCH_AND_ADD32(&num_blocks, 0);
+  if (segid == DART_SEGMENT_LOCAL) {
+    b = 0;
+  } else if (segid == DART_SEGMENT_LOCAL_EXT) {
+    for (int i = 1; i < nblocks; ++i) {
+      uint64_t base = (uint64_t)(uintptr_t)blocks[i].base;
+      if (offset >= base && offset < base + blocks[i].size) {
+        b       = i;
+        offset -= base;
+        break;
+      }
+    }
+  }
+  if (b < 0 || offset >= blocks[b].size) {
+    return DART_ERR_INVAL;
+  }
+  dart_localpool_cache_t *cache = thread_cache();
+  ++cache->num_free;
+  count_op(cache);
+
+  dart_localpool_block_t *block = &blocks[b];
+  uint8_t *cls = &block->sizeclass[offset >> DART_LOCALPOOL_MIN_CLASS_BITS];
+  if (*cls & DART_LOCALPOOL_CACHED) {
+    DART_LOG_ERROR("dart_localpool_free: double free of offset %"PRIu64" "
+                   "in block %d", offset, b);
+    return DART_ERR_INVAL;
+  }
+  if (*cls > 0) {
+    int c = *cls - 1;
+    if (cache->count[c] < DART_LOCAL_ALLOC_CACHE_DEPTH) {
+      dart_localpool_cache_entry_t *entry =
+        &cache->entries[c][cache->count[c]++];
+      entry->block  = b;
+      entry->offset = offset;
+      *cls |= DART_LOCALPOOL_CACHED;
+      return DART_OK;
+    }
+    *cls = 0;
+  }
+  if (dart_buddy_free(block->buddy, offset) == -1) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_memalloc_stats(
+  dart_memalloc_stats_t * stats)
+{
+  if (stats == NULL) {
+    return DART_ERR_INVAL;
+  }
+  int32_t nblocks       = DART_FETCH_AND_ADD32(&num_blocks, 0);
+  stats->num_blocks     = nblocks;
+  stats->size           = 0;
+  stats->used           = 0;
+  for (int b = 0; b < nblocks; ++b) {
+    stats->size += blocks[b].size;
+    stats->used += dart_buddy_used(blocks[b].buddy);
+  }
+  // operations of other threads are added in batches, only those of the
+  // calling thread are exact
+  flush_stats(thread_cache());
+  stats->num_alloc      = DART_FETCH_AND_ADD64(&num_alloc, 0);
+  stats->num_free       = DART_FETCH_AND_ADD64(&num_free, 0);
+  stats->num_cache_hits = DART_FETCH_AND_ADD64(&num_cache_hits, 0);
+  return DART_OK;
+}
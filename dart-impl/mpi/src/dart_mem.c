@@ -32,12 +32,12 @@ enum {
 struct dart_buddy {
   dart_mutex_t mutex;
   int level;
+  size_t used;
   uint8_t tree[1];
 };
 
 /* Help to do memory management work for local allocation/free */
 char* dart_mempool_localalloc;
-struct dart_buddy  *  dart_localpool;
 
 static inline int
 num_level(size_t size)
@@ -67,7 +67,12 @@ dart_buddy_new(size_t size)
   unsigned int lsize  = (((unsigned int) 1) << level);
 	struct dart_buddy * self =
     malloc(sizeof(struct dart_buddy) + sizeof(uint8_t) * (lsize * 2 - 2));
+  if (self == NULL) {
+    DART_LOG_ERROR("Failed to allocate buddy allocator of level %u", level);
+    return NULL;
+  }
 	self->level = level;
+	self->used  = 0;
 	memset(self->tree, NODE_UNUSED, lsize * 2 - 1);
 	dart__base__mutex_init(&self->mutex);
 	return self;
@@ -118,9 +123,12 @@ _mark_parent(struct dart_buddy * self, int index) {
 
 size_t
 dart_buddy_alloc(struct dart_buddy * self, size_t s) {
+  // sizes are computed in int, reject requests exceeding the pool
+  if (s > (((size_t)1) << (self->level + DART_MEM_ALIGN_BITS)))
+    return -1;
   // honor the alignment
   int size = (s >> DART_MEM_ALIGN_BITS);
-  if ((size<<DART_MEM_ALIGN_BITS) < s) ++size;
+  if ((((size_t)size) << DART_MEM_ALIGN_BITS) < s) ++size;
   size = (int)next_pow_of_2(size);
 	int length = 1 << self->level;
 
@@ -137,6 +145,7 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
 			if (self->tree[index] == NODE_UNUSED) {
 				self->tree[index] = NODE_USED;
 				_mark_parent(self, index);
+				self->used += ((size_t)length) << DART_MEM_ALIGN_BITS;
 			  dart__base__mutex_unlock(&self->mutex);
 				return _index_offset(index, level, self->level);
 			}
@@ -222,6 +231,7 @@ int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
 				return -1;
 			}
 			_combine(self, index);
+			self->used -= ((size_t)length) << DART_MEM_ALIGN_BITS;
 		  dart__base__mutex_unlock(&self->mutex);
 			return 0;
 		case NODE_UNUSED:
@@ -246,6 +256,14 @@ int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
 	return -1;
 }
 
+size_t dart_buddy_used(struct dart_buddy * self)
+{
+  dart__base__mutex_lock(&self->mutex);
+  size_t used = self->used;
+  dart__base__mutex_unlock(&self->mutex);
+  return used;
+}
+
 int buddy_size(struct dart_buddy * self, uint64_t offset)
 {
 	uint64_t left   = 0;
@@ -4,11 +4,14 @@
  * Provide functionality for creating derived data types in DART.
  *
  * Currently implemented: strided types based on basic types.
+ * Committed MPI types of strided transfers are cached for reuse.
  */
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_initialization.h>
 #include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+#include <dash/dart/base/env.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 
 #include <stdlib.h>
@@ -18,6 +21,45 @@
 
 #define DART_TYPE_NAMELEN 256
 
+/**
+ * Environment variable to set the maximum number of committed MPI vector
+ * types kept for reuse in strided transfers, 0 disables the cache.
+ */
+#define DART_MPI_TYPE_CACHE_SIZE_ENVSTR "DART_MPI_TYPE_CACHE_SIZE"
+
+/**
+ * Default number of entries in the strided type cache.
+ */
+#ifndef DART_MPI_TYPE_CACHE_SIZE
+#define DART_MPI_TYPE_CACHE_SIZE 64
+#endif
+
+/**
+ * Entry of the strided type cache, keyed by
+ * (base type, stride, block length, number of blocks).
+ * Entries with \c refcount > 0 are used by an ongoing transfer and may
+ * not be evicted.
+ */
+typedef struct {
+  dart_datatype_t base_type;
+  int             stride;
+  size_t          blocklen;
+  size_t          num_blocks;
+  MPI_Datatype    mpi_type;
+  uint64_t        last_use;
+  int             refcount;
+  bool            valid;
+} dart_type_cache_entry_t;
+
+static struct {
+  dart_mutex_t            mutex;
+  uint64_t                clock;
+  size_t                  hits;
+  size_t                  misses;
+  size_t                  num_entries;
+  dart_type_cache_entry_t *entries;
+} type_cache;
+
 static const char* __dart_base_type_names[DART_TYPE_LAST+1] = {
   "UNDEFINED",
   "BYTE",
@@ -103,6 +145,24 @@ dart__mpi__datatype_init()
   init_basic_datatype(DART_TYPE_DOUBLE,       MPI_DOUBLE);
   init_basic_datatype(DART_TYPE_LONG_DOUBLE,  MPI_LONG_DOUBLE);
 
+  memset(&type_cache, 0, sizeof(type_cache));
+  type_cache.num_entries = dart__base__env__size(
+                             DART_MPI_TYPE_CACHE_SIZE_ENVSTR,
+                             DART_MPI_TYPE_CACHE_SIZE);
+  if (type_cache.num_entries > 0) {
+    type_cache.entries = calloc(type_cache.num_entries,
+                                sizeof(dart_type_cache_entry_t));
+    if (type_cache.entries == NULL) {
+      DART_LOG_WARN("dart__mpi__datatype_init: failed to allocate type "
+                    "cache with %zu entries, caching disabled",
+                    type_cache.num_entries);
+      type_cache.num_entries = 0;
+    }
+  }
+  DART_LOG_DEBUG("dart__mpi__datatype_init: type cache entries:%zu",
+                 type_cache.num_entries);
+  dart__base__mutex_init(&type_cache.mutex);
+
   return DART_OK;
 }
 
@@ -177,13 +237,12 @@ dart_type_create_strided(
 }
 
 
-MPI_Datatype
-dart__mpi__create_strided_mpi(
-  dart_datatype_t dart_type,
-  size_t          num_blocks)
+static MPI_Datatype
+create_vector_mpi(
+  dart_datatype_struct_t * dts,
+  size_t                   num_blocks)
 {
   MPI_Datatype new_mpi_dtype;
-  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
   MPI_Type_vector(
     num_blocks,             // the number of blocks
     dts->num_elem,          // the number of elements per block
@@ -194,12 +253,99 @@ dart__mpi__create_strided_mpi(
   return new_mpi_dtype;
 }
 
+MPI_Datatype
+dart__mpi__create_strided_mpi(
+  dart_datatype_t dart_type,
+  size_t          num_blocks)
+{
+  dart_datatype_struct_t  *dts    = dart__mpi__datatype_struct(dart_type);
+  dart_type_cache_entry_t *victim = NULL;
+  MPI_Datatype             result;
+
+  dart__base__mutex_lock(&type_cache.mutex);
+  ++type_cache.clock;
+  for (size_t i = 0; i < type_cache.num_entries; ++i) {
+    dart_type_cache_entry_t *entry = &type_cache.entries[i];
+    if (!entry->valid) {
+      if (victim == NULL || victim->valid) {
+        victim = entry;
+      }
+      continue;
+    }
+    if (entry->base_type  == dts->base_type       &&
+        entry->stride     == dts->strided.stride  &&
+        entry->blocklen   == dts->num_elem        &&
+        entry->num_blocks == num_blocks) {
+      ++entry->refcount;
+      entry->last_use = type_cache.clock;
+      ++type_cache.hits;
+      result = entry->mpi_type;
+      dart__base__mutex_unlock(&type_cache.mutex);
+      return result;
+    }
+    // least recently used entry not referenced by an ongoing transfer
+    if (entry->refcount == 0 &&
+        (victim == NULL ||
+         (victim->valid && entry->last_use < victim->last_use))) {
+      victim = entry;
+    }
+  }
+  ++type_cache.misses;
+
+  result = create_vector_mpi(dts, num_blocks);
+
+  if (victim != NULL) {
+    if (victim->valid) {
+      DART_LOG_TRACE("dart__mpi__create_strided_mpi: evicting cached type "
+                     "(stride:%i blocklen:%zu num_blocks:%zu)",
+                     victim->stride, victim->blocklen, victim->num_blocks);
+      MPI_Type_free(&victim->mpi_type);
+    }
+    victim->base_type  = dts->base_type;
+    victim->stride     = dts->strided.stride;
+    victim->blocklen   = dts->num_elem;
+    victim->num_blocks = num_blocks;
+    victim->mpi_type   = result;
+    victim->last_use   = type_cache.clock;
+    victim->refcount   = 1;
+    victim->valid      = true;
+  }
+  // otherwise all entries are in use and the type is released in
+  // dart__mpi__destroy_strided_mpi
+  dart__base__mutex_unlock(&type_cache.mutex);
+  return result;
+}
+
 void
 dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
 {
+  dart__base__mutex_lock(&type_cache.mutex);
+  for (size_t i = 0; i < type_cache.num_entries; ++i) {
+    dart_type_cache_entry_t *entry = &type_cache.entries[i];
+    if (entry->valid && entry->mpi_type == *mpi_type) {
+      --entry->refcount;
+      dart__base__mutex_unlock(&type_cache.mutex);
+      *mpi_type = MPI_DATATYPE_NULL;
+      return;
+    }
+  }
+  dart__base__mutex_unlock(&type_cache.mutex);
+  // not cached
   MPI_Type_free(mpi_type);
 }
 
+dart_ret_t
+dart_type_cache_stats(
+  size_t * hits,
+  size_t * misses)
+{
+  dart__base__mutex_lock(&type_cache.mutex);
+  if (hits   != NULL) *hits   = type_cache.hits;
+  if (misses != NULL) *misses = type_cache.misses;
+  dart__base__mutex_unlock(&type_cache.mutex);
+  return DART_OK;
+}
+
 dart_ret_t
 dart_type_create_indexed(
   dart_datatype_t   basetype,
@@ -316,6 +462,20 @@ static void destroy_basic_type(dart_datatype_t dart_type_id)
 dart_ret_t
 dart__mpi__datatype_fini()
 {
+  for (size_t i = 0; i < type_cache.num_entries; ++i) {
+    dart_type_cache_entry_t *entry = &type_cache.entries[i];
+    if (entry->valid) {
+      MPI_Type_free(&entry->mpi_type);
+      entry->valid = false;
+    }
+  }
+  free(type_cache.entries);
+  type_cache.entries     = NULL;
+  type_cache.num_entries = 0;
+  DART_LOG_DEBUG("dart__mpi__datatype_fini: type cache hits:%zu misses:%zu",
+                 type_cache.hits, type_cache.misses);
+  dart__base__mutex_destroy(&type_cache.mutex);
+
   destroy_basic_type(DART_TYPE_BYTE);
   destroy_basic_type(DART_TYPE_SHORT);
   destroy_basic_type(DART_TYPE_INT);
@@ -101,6 +101,10 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
     segid = DART_SEGMENT_LOCAL;
     elem = calloc(1, sizeof(dart_seghash_elem_t));
     elem->data.segid = segid;
+  } else if (type == DART_SEGMENT_LOCAL_EXT_ALLOC) {
+    segid = DART_SEGMENT_LOCAL_EXT;
+    elem = calloc(1, sizeof(dart_seghash_elem_t));
+    elem->data.segid = segid;
   } else if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
       elem  = segdata->mem_freelist;
@@ -0,0 +1,179 @@
+/**
+ * \file dart_stats.c
+ *
+ * Communication statistics counters.
+ */
+#include <dash/dart/if/dart_stats.h>
+#include <dash/dart/if/dart_types.h>
+
+#include <dash/dart/base/logging.h>
+
+#include <dash/dart/mpi/dart_stats_priv.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+bool dart__mpi__stats_enabled = false;
+
+void dart__mpi__stats_timer_end(
+  dart__mpi__stats_timer_t * timer)
+{
+  if (dart__likely(timer->start == 0)) {
+    return;
+  }
+  if (timer->team == DART_UNDEFINED_TEAM_ID) {
+    return;
+  }
+  uint64_t elapsed = dart__mpi__stats_now() - timer->start;
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(timer->team);
+  if (team_data == NULL) {
+    return;
+  }
+  switch (timer->kind) {
+    case DART_STATS_FLUSH:
+      if (timer->target.id >= 0 && timer->target.id < team_data->size &&
+          team_data->stats_target != NULL) {
+        dart_stats_target_t *stats =
+          &team_data->stats_target[timer->target.id];
+        dart__mpi__stats_add(&stats->flush_ops, 1);
+        dart__mpi__stats_add(&stats->flush_ns,  elapsed);
+      } else {
+        dart__mpi__stats_add(&team_data->stats.total.flush_ops, 1);
+        dart__mpi__stats_add(&team_data->stats.total.flush_ns,  elapsed);
+      }
+      break;
+    case DART_STATS_WAIT:
+      dart__mpi__stats_add(&team_data->stats.wait_ops, 1);
+      dart__mpi__stats_add(&team_data->stats.wait_ns,  elapsed);
+      break;
+    case DART_STATS_COLLECTIVE:
+      dart__mpi__stats_add(&team_data->stats.coll_ops,   1);
+      dart__mpi__stats_add(&team_data->stats.coll_bytes, timer->nbytes);
+      dart__mpi__stats_add(&team_data->stats.coll_ns,    elapsed);
+      break;
+  }
+}
+
+void dart__mpi__stats_coll_complete(
+  dart_team_t team,
+  size_t      nbytes,
+  uint64_t    start)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (team_data == NULL) {
+    return;
+  }
+  dart__mpi__stats_add(&team_data->stats.coll_ops,   1);
+  dart__mpi__stats_add(&team_data->stats.coll_bytes, nbytes);
+  if (start != 0) {
+    dart__mpi__stats_add(&team_data->stats.coll_ns,
+                         dart__mpi__stats_now() - start);
+  }
+}
+
+dart_ret_t dart_stats_enable(bool enable)
+{
+  DART_LOG_DEBUG("dart_stats_enable(%d)", enable);
+  dart__mpi__stats_enabled = enable;
+  return DART_OK;
+}
+
+bool dart_stats_enabled()
+{
+  return dart__mpi__stats_enabled;
+}
+
+static void dart__mpi__stats_load(
+  const dart_stats_target_t * src,
+  dart_stats_target_t       * dst)
+{
+  dst->put_ops   = __atomic_load_n(&src->put_ops,   __ATOMIC_RELAXED);
+  dst->put_bytes = __atomic_load_n(&src->put_bytes, __ATOMIC_RELAXED);
+  dst->get_ops   = __atomic_load_n(&src->get_ops,   __ATOMIC_RELAXED);
+  dst->get_bytes = __atomic_load_n(&src->get_bytes, __ATOMIC_RELAXED);
+  dst->acc_ops   = __atomic_load_n(&src->acc_ops,   __ATOMIC_RELAXED);
+  dst->acc_bytes = __atomic_load_n(&src->acc_bytes, __ATOMIC_RELAXED);
+  dst->local_ops = __atomic_load_n(&src->local_ops, __ATOMIC_RELAXED);
+  dst->shmem_ops = __atomic_load_n(&src->shmem_ops, __ATOMIC_RELAXED);
+  dst->mpi_ops   = __atomic_load_n(&src->mpi_ops,   __ATOMIC_RELAXED);
+  dst->flush_ops = __atomic_load_n(&src->flush_ops, __ATOMIC_RELAXED);
+  dst->flush_ns  = __atomic_load_n(&src->flush_ns,  __ATOMIC_RELAXED);
+}
+
+dart_ret_t dart_stats_get(
+  dart_team_t    team,
+  dart_stats_t * stats)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (team_data == NULL || stats == NULL) {
+    DART_LOG_ERROR("dart_stats_get ! invalid team %d or stats", team);
+    return DART_ERR_INVAL;
+  }
+  dart__mpi__stats_load(&team_data->stats.total, &stats->total);
+  stats->wait_ops   = __atomic_load_n(&team_data->stats.wait_ops,
+                                      __ATOMIC_RELAXED);
+  stats->wait_ns    = __atomic_load_n(&team_data->stats.wait_ns,
+                                      __ATOMIC_RELAXED);
+  stats->coll_ops   = __atomic_load_n(&team_data->stats.coll_ops,
+                                      __ATOMIC_RELAXED);
+  stats->coll_bytes = __atomic_load_n(&team_data->stats.coll_bytes,
+                                      __ATOMIC_RELAXED);
+  stats->coll_ns    = __atomic_load_n(&team_data->stats.coll_ns,
+                                      __ATOMIC_RELAXED);
+  if (team_data->stats_target == NULL) {
+    return DART_OK;
+  }
+  for (int u = 0; u < team_data->size; ++u) {
+    dart_stats_target_t t;
+    dart__mpi__stats_load(&team_data->stats_target[u], &t);
+    stats->total.put_ops   += t.put_ops;
+    stats->total.put_bytes += t.put_bytes;
+    stats->total.get_ops   += t.get_ops;
+    stats->total.get_bytes += t.get_bytes;
+    stats->total.acc_ops   += t.acc_ops;
+    stats->total.acc_bytes += t.acc_bytes;
+    stats->total.local_ops += t.local_ops;
+    stats->total.shmem_ops += t.shmem_ops;
+    stats->total.mpi_ops   += t.mpi_ops;
+    stats->total.flush_ops += t.flush_ops;
+    stats->total.flush_ns  += t.flush_ns;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_stats_get_target(
+  dart_team_t           team,
+  dart_team_unit_t      target,
+  dart_stats_target_t * stats)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (team_data == NULL || stats == NULL ||
+      target.id < 0 || target.id >= team_data->size) {
+    DART_LOG_ERROR("dart_stats_get_target ! invalid team %d or unit %d",
+                   team, target.id);
+    return DART_ERR_INVAL;
+  }
+  if (team_data->stats_target == NULL) {
+    memset(stats, 0, sizeof(dart_stats_target_t));
+    return DART_OK;
+  }
+  dart__mpi__stats_load(&team_data->stats_target[target.id], stats);
+  return DART_OK;
+}
+
+dart_ret_t dart_stats_reset(
+  dart_team_t team)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_stats_reset ! invalid team %d", team);
+    return DART_ERR_INVAL;
+  }
+  memset(&team_data->stats, 0, sizeof(dart_stats_t));
+  if (team_data->stats_target != NULL) {
+    memset(team_data->stats_target, 0,
+           team_data->size * sizeof(dart_stats_target_t));
+  }
+  return DART_OK;
+}
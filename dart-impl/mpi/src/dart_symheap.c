@@ -0,0 +1,154 @@
+/**
+ * \file dart_symheap.c
+ *
+ * First-fit allocator for symmetric heaps of teams.
+ */
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/assert.h>
+#include <dash/dart/base/mutex.h>
+
+#include <dash/dart/mpi/dart_symheap.h>
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+typedef struct dart_symheap_block dart_symheap_block_t;
+
+/* Block of the heap, blocks are kept in a list ordered by offset that
+ * spans the entire heap. */
+struct dart_symheap_block {
+  dart_symheap_block_t * next;
+  uint64_t               offset;
+  size_t                 size;
+  bool                   used;
+};
+
+struct dart_symheap {
+  dart_mutex_t           mutex;
+  size_t                 size;
+  dart_symheap_block_t * blocks;
+};
+
+size_t dart__mpi__symheap_size = 0;
+
+struct dart_symheap *
+dart_symheap_new(size_t size)
+{
+  struct dart_symheap *heap = malloc(sizeof(struct dart_symheap));
+  if (heap == NULL) {
+    DART_LOG_ERROR("dart_symheap_new ! Failed to allocate heap state");
+    return NULL;
+  }
+  heap->size   = size;
+  heap->blocks = malloc(sizeof(dart_symheap_block_t));
+  if (heap->blocks == NULL) {
+    DART_LOG_ERROR("dart_symheap_new ! Failed to allocate heap state");
+    free(heap);
+    return NULL;
+  }
+  heap->blocks->next   = NULL;
+  heap->blocks->offset = 0;
+  heap->blocks->size   = size;
+  heap->blocks->used   = false;
+  dart__base__mutex_init(&heap->mutex);
+  return heap;
+}
+
+void
+dart_symheap_delete(struct dart_symheap * heap)
+{
+  dart_symheap_block_t *block = heap->blocks;
+  while (block != NULL) {
+    dart_symheap_block_t *tmp = block;
+    block = block->next;
+    free(tmp);
+  }
+  dart__base__mutex_destroy(&heap->mutex);
+  free(heap);
+}
+
+dart_ret_t
+dart_symheap_alloc(
+  struct dart_symheap * heap,
+  size_t                nbytes,
+  uint64_t            * offset)
+{
+  *offset = DART_SYMHEAP_INVALID_OFFSET;
+
+  // zero-size allocations still require a unique offset
+  size_t size = (nbytes + DART_SYMHEAP_ALIGN_BYTES - 1)
+                  / DART_SYMHEAP_ALIGN_BYTES * DART_SYMHEAP_ALIGN_BYTES;
+  if (size == 0) {
+    size = DART_SYMHEAP_ALIGN_BYTES;
+  }
+
+  dart__base__mutex_lock(&heap->mutex);
+  for (dart_symheap_block_t *block = heap->blocks;
+       block != NULL;
+       block = block->next) {
+    if (block->used || block->size < size) {
+      continue;
+    }
+    if (block->size > size) {
+      // split off the remainder
+      dart_symheap_block_t *rest = malloc(sizeof(dart_symheap_block_t));
+      if (rest == NULL) {
+        dart__base__mutex_unlock(&heap->mutex);
+        DART_LOG_ERROR("dart_symheap_alloc ! Failed to split block");
+        return DART_ERR_OTHER;
+      }
+      rest->next    = block->next;
+      rest->offset  = block->offset + size;
+      rest->size    = block->size - size;
+      rest->used    = false;
+      block->next   = rest;
+      block->size   = size;
+    }
+    block->used = true;
+    *offset     = block->offset;
+    dart__base__mutex_unlock(&heap->mutex);
+    DART_LOG_TRACE("dart_symheap_alloc: nbytes:%zu offset:%"PRIu64,
+                   nbytes, *offset);
+    return DART_OK;
+  }
+  dart__base__mutex_unlock(&heap->mutex);
+  DART_LOG_DEBUG("dart_symheap_alloc: heap of %zu bytes exhausted "
+                 "(nbytes:%zu)", heap->size, nbytes);
+  return DART_ERR_NOTFOUND;
+}
+
+dart_ret_t
+dart_symheap_free(struct dart_symheap * heap, uint64_t offset)
+{
+  dart__base__mutex_lock(&heap->mutex);
+  dart_symheap_block_t *pred  = NULL;
+  dart_symheap_block_t *block = heap->blocks;
+  while (block != NULL && block->offset < offset) {
+    pred  = block;
+    block = block->next;
+  }
+  if (block == NULL || block->offset != offset || !block->used) {
+    dart__base__mutex_unlock(&heap->mutex);
+    DART_LOG_ERROR("dart_symheap_free ! Invalid offset %"PRIu64, offset);
+    return DART_ERR_INVAL;
+  }
+  block->used = false;
+  // coalesce with successor
+  dart_symheap_block_t *next = block->next;
+  if (next != NULL && !next->used) {
+    block->size += next->size;
+    block->next  = next->next;
+    free(next);
+  }
+  // coalesce with predecessor
+  if (pred != NULL && !pred->used) {
+    pred->size += block->size;
+    pred->next  = block->next;
+    free(block);
+  }
+  dart__base__mutex_unlock(&heap->mutex);
+  DART_LOG_TRACE("dart_symheap_free: offset:%"PRIu64, offset);
+  return DART_OK;
+}
@@ -7,6 +7,8 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
 #include <dash/dart/base/mutex.h>
+#include <dash/dart/base/atomic.h>
+#include <dash/dart/base/env.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -21,8 +23,72 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <inttypes.h>
 #include <unistd.h>
 #include <malloc.h>
+#include <time.h>
+#include <float.h>
+
+/**
+ * Name of the environment variable limiting the number of units in the
+ * cohort of a cohort lock.
+ */
+#define DART_LOCK_COHORT_SIZE_ENVSTR "DART_LOCK_COHORT_SIZE"
+
+/**
+ * Maximum number of consecutive hand-overs of a cohort lock within a
+ * cohort before the global lock is released to other cohorts.
+ */
+#ifndef DART_LOCK_COHORT_MAX_PASSES
+#define DART_LOCK_COHORT_MAX_PASSES 64
+#endif
+
+/**
+ * Initial and maximum delay in microseconds between attempts to acquire
+ * a contended lock in timed and reader-writer lock acquisition.
+ */
+#ifndef DART_LOCK_BACKOFF_MIN_US
+#define DART_LOCK_BACKOFF_MIN_US 1
+#endif
+#ifndef DART_LOCK_BACKOFF_MAX_US
+#define DART_LOCK_BACKOFF_MAX_US 1024
+#endif
+
+/**
+ * State of a cohort lock, allocated once per unit. The cohort-local lock
+ * and the queue entry of a cohort are stored in the slot of the cohort
+ * leader, the tail of the global queue in the slot of unit 0.
+ */
+typedef struct dart_lock_cohort_slot
+{
+  /** Next ticket of the cohort-local ticket lock. */
+  int32_t ticket;
+  /** Ticket currently holding the cohort-local lock. */
+  int32_t serving;
+  /** Whether the cohort-local lock is passed with the global lock. */
+  int32_t global_held;
+  /** Number of consecutive hand-overs within the cohort. */
+  int32_t passes;
+  /** Leader of the successor cohort in the global queue or -1. */
+  int32_t next;
+  /** Set by the predecessor cohort when passing the global lock. */
+  int32_t granted;
+  /** Leader of the cohort at the tail of the global queue or -1. */
+  int32_t tail;
+} dart_lock_cohort_slot_t;
+
+typedef struct dart_lock_cohort
+{
+  /** Team-allocated slots, one per unit. */
+  dart_gptr_t               gptr;
+  /** State of the cohort in the slot of the cohort leader. */
+  dart_lock_cohort_slot_t * state;
+  /** Team unit ID of the cohort leader, identifies the cohort. */
+  dart_team_unit_t          leader;
+  /** Ticket of this unit in the cohort-local lock. */
+  int32_t                   ticket;
+} dart_lock_cohort_t;
 
 
 struct dart_lock_struct
@@ -44,6 +110,8 @@ struct dart_lock_struct
   dart_team_t teamid;
   /** Whether this unit has acquired the lock. */
   int32_t is_acquired;
+  /** State of a cohort lock, NULL for a queue lock. */
+  dart_lock_cohort_t * cohort;
 };
 
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
@@ -118,6 +186,7 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   (*lock)->gptr_list   = gptr_list;
   (*lock)->teamid      = teamid;
   (*lock)->is_acquired = 0;
+  (*lock)->cohort      = NULL;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
@@ -127,6 +196,383 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   return DART_OK;
 }
 
+/* -- Cohort lock -- */
+
+static inline dart_segment_info_t * cohort_seginfo(
+  dart_team_data_t   * team_data,
+  dart_lock_cohort_t * cohort)
+{
+  return dart_segment_get_info(&(team_data->segdata), cohort->gptr.segid);
+}
+
+/* Displacement of a field in the slot of unit in the window. */
+static inline MPI_Aint cohort_disp(
+  const dart_segment_info_t * seginfo,
+  const dart_lock_cohort_t  * cohort,
+  dart_unit_t                 unit,
+  size_t                      field)
+{
+  return dart_segment_disp(seginfo, DART_TEAM_UNIT_ID(unit)) +
+         cohort->gptr.addr_or_offs.offset + field;
+}
+
+/*
+ * Slot of unit if it is accessible in shared memory, NULL otherwise.
+ * Cohorts spanning several units require atomic operations on shared
+ * memory, each unit forms a cohort of its own without them.
+ */
+static dart_lock_cohort_slot_t * cohort_slot_shared(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo,
+  const dart_lock_cohort_t  * cohort,
+  dart_unit_t                 unit)
+{
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS) && \
+    defined(DART_HAVE_SYNC_BUILTINS)
+  if (seginfo->baseptr != NULL && team_data->sharedmem_tab != NULL &&
+      team_data->sharedmem_tab[unit].id >= 0) {
+    return (dart_lock_cohort_slot_t *)(
+             seginfo->baseptr[team_data->sharedmem_tab[unit].id] +
+             cohort->gptr.addr_or_offs.offset);
+  }
+#endif // !DART_MPI_DISABLE_SHARED_WINDOWS && DART_HAVE_SYNC_BUILTINS
+  return NULL;
+}
+
+static inline void cohort_atomic_store(int32_t * ptr, int32_t value)
+{
+  DART_STORE_RELEASE32(ptr, value);
+}
+
+/* Set a field in the slot of unit, through shared memory if possible. */
+static void cohort_set(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo,
+  const dart_lock_cohort_t  * cohort,
+  dart_unit_t                 unit,
+  size_t                      field,
+  int32_t                     value)
+{
+  dart_lock_cohort_slot_t *slot = cohort_slot_shared(
+                                    team_data, seginfo, cohort, unit);
+  if (slot != NULL) {
+    cohort_atomic_store((int32_t *)((char *)slot + field), value);
+    return;
+  }
+  DART_ASSERT_RETURNS(
+    MPI_Accumulate(
+      &value, 1, MPI_INT32_T,
+      unit, cohort_disp(seginfo, cohort, unit, field), 1, MPI_INT32_T,
+      MPI_REPLACE, seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit, seginfo->win),
+    MPI_SUCCESS);
+}
+
+/* Trigger progress while spinning on shared memory. */
+static inline void cohort_progress(
+  const dart_team_data_t * team_data,
+  MPI_Win                  win)
+{
+  int flag;
+  MPI_Win_sync(win);
+  MPI_Iprobe(
+    MPI_ANY_SOURCE, MPI_ANY_TAG,
+    team_data->comm, &flag, MPI_STATUS_IGNORE);
+}
+
+/* Enqueue the cohort in the global queue and wait for the global lock. */
+static void cohort_global_acquire(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo,
+  dart_lock_cohort_t        * cohort)
+{
+  dart_lock_cohort_slot_t *state  = cohort->state;
+  int32_t                  leader = cohort->leader.id;
+  int32_t                  predecessor;
+
+  cohort_atomic_store(&state->next, -1);
+  cohort_atomic_store(&state->granted, 0);
+  MPI_Win_sync(seginfo->win);
+
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &leader, &predecessor, MPI_INT32_T,
+      0, cohort_disp(seginfo, cohort, 0,
+                     offsetof(dart_lock_cohort_slot_t, tail)),
+      MPI_REPLACE, seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(0, seginfo->win),
+    MPI_SUCCESS);
+
+  DART_LOG_TRACE("dart_lock_acquire: cohort %d predecessor: %d",
+                 leader, predecessor);
+  if (predecessor != -1) {
+    cohort_set(team_data, seginfo, cohort, predecessor,
+               offsetof(dart_lock_cohort_slot_t, next), leader);
+    while (DART_LOAD_ACQUIRE32(&state->granted) == 0) {
+      cohort_progress(team_data, seginfo->win);
+    }
+  }
+}
+
+/* Pass the global lock to the next cohort in the queue, if any. */
+static void cohort_global_release(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo,
+  dart_lock_cohort_t        * cohort)
+{
+  dart_lock_cohort_slot_t *state  = cohort->state;
+  int32_t                  leader = cohort->leader.id;
+  int32_t                  reset  = -1;
+  int32_t                  result;
+
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &reset, &leader, &result, MPI_INT32_T,
+      0, cohort_disp(seginfo, cohort, 0,
+                     offsetof(dart_lock_cohort_slot_t, tail)),
+      seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(0, seginfo->win),
+    MPI_SUCCESS);
+
+  if (result != leader) {
+    /* Wait for the successor cohort to enqueue itself. */
+    int32_t next;
+    while ((next = DART_LOAD_ACQUIRE32(&state->next)) == -1) {
+      cohort_progress(team_data, seginfo->win);
+    }
+    DART_LOG_TRACE("dart_lock_release: cohort %d passing to cohort %d",
+                   leader, next);
+    cohort_set(team_data, seginfo, cohort, next,
+               offsetof(dart_lock_cohort_slot_t, granted), 1);
+  }
+}
+
+static dart_ret_t cohort_acquire(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data)
+{
+  dart_lock_cohort_t      *cohort  = lock->cohort;
+  dart_lock_cohort_slot_t *state   = cohort->state;
+  dart_segment_info_t     *seginfo = cohort_seginfo(team_data, cohort);
+  if (seginfo == NULL) {
+    DART_LOG_ERROR("dart_lock_acquire ! Unknown segment of cohort lock");
+    return DART_ERR_INVAL;
+  }
+
+  cohort->ticket = DART_FETCH_AND_ADD32(&state->ticket, 1);
+  while (DART_LOAD_ACQUIRE32(&state->serving) != cohort->ticket) {
+    cohort_progress(team_data, seginfo->win);
+  }
+  if (DART_LOAD_ACQUIRE32(&state->global_held) == 0) {
+    cohort_global_acquire(team_data, seginfo, cohort);
+    cohort_atomic_store(&state->passes, 0);
+  }
+  return DART_OK;
+}
+
+static dart_ret_t cohort_try_acquire(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data,
+  int32_t          * is_acquired)
+{
+  dart_lock_cohort_t      *cohort  = lock->cohort;
+  dart_lock_cohort_slot_t *state   = cohort->state;
+  dart_segment_info_t     *seginfo = cohort_seginfo(team_data, cohort);
+  if (seginfo == NULL) {
+    DART_LOG_ERROR("dart_lock_try_acquire ! Unknown segment of cohort lock");
+    return DART_ERR_INVAL;
+  }
+
+  *is_acquired = 0;
+  /* Take a ticket only if the cohort-local lock is free. */
+  int32_t serving = DART_LOAD_ACQUIRE32(&state->serving);
+  if (DART_COMPARE_AND_SWAP32(&state->ticket, serving, serving + 1)
+        != serving) {
+    return DART_OK;
+  }
+  cohort->ticket = serving;
+  if (DART_LOAD_ACQUIRE32(&state->global_held) != 0) {
+    *is_acquired = 1;
+    return DART_OK;
+  }
+
+  int32_t leader  = cohort->leader.id;
+  int32_t compare = -1;
+  int32_t result;
+  cohort_atomic_store(&state->next, -1);
+  cohort_atomic_store(&state->granted, 0);
+  MPI_Win_sync(seginfo->win);
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &leader, &compare, &result, MPI_INT32_T,
+      0, cohort_disp(seginfo, cohort, 0,
+                     offsetof(dart_lock_cohort_slot_t, tail)),
+      seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(0, seginfo->win),
+    MPI_SUCCESS);
+
+  if (result == -1) {
+    cohort_atomic_store(&state->passes, 0);
+    *is_acquired = 1;
+  } else {
+    /* Global lock held by another cohort, pass on the cohort-local lock. */
+    cohort_atomic_store(&state->serving, serving + 1);
+  }
+  return DART_OK;
+}
+
+static dart_ret_t cohort_release(
+  dart_lock_t        lock,
+  dart_team_data_t * team_data)
+{
+  dart_lock_cohort_t      *cohort  = lock->cohort;
+  dart_lock_cohort_slot_t *state   = cohort->state;
+  dart_segment_info_t     *seginfo = cohort_seginfo(team_data, cohort);
+  if (seginfo == NULL) {
+    DART_LOG_ERROR("dart_lock_release ! Unknown segment of cohort lock");
+    return DART_ERR_INVAL;
+  }
+
+  /* Number of units of the cohort waiting for the cohort-local lock. */
+  int32_t waiting = (int32_t)((uint32_t)DART_LOAD_ACQUIRE32(&state->ticket) -
+                              (uint32_t)cohort->ticket - 1u);
+  int32_t passes  = DART_LOAD_ACQUIRE32(&state->passes);
+  if (waiting > 0 && passes < DART_LOCK_COHORT_MAX_PASSES) {
+    /* Keep the global lock within the cohort. */
+    cohort_atomic_store(&state->passes, passes + 1);
+    cohort_atomic_store(&state->global_held, 1);
+  } else {
+    cohort_atomic_store(&state->global_held, 0);
+    cohort_global_release(team_data, seginfo, cohort);
+  }
+  cohort_atomic_store(&state->serving, cohort->ticket + 1);
+  return DART_OK;
+}
+
+/*
+ * Allocation failures of lock state are local to a unit, all units of the
+ * team have to agree on them before entering collective operations.
+ */
+static dart_ret_t lock_alloc_agree(
+  const dart_team_data_t * team_data,
+  int                      failed)
+{
+  int any_failed;
+  if (dart__mpi__team_agree_max(team_data, failed != 0, &any_failed)
+        != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+  return (any_failed) ? DART_ERR_OTHER : DART_OK;
+}
+
+dart_ret_t dart_team_cohort_lock_init(dart_team_t teamid, dart_lock_t* lock)
+{
+  dart_gptr_t      gptr;
+  dart_team_unit_t unitid;
+
+  *lock = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_myid(teamid, &unitid);
+
+  dart_lock_cohort_t *cohort   = malloc(sizeof(dart_lock_cohort_t));
+  dart_lock_t         new_lock = malloc(sizeof(struct dart_lock_struct));
+  dart_ret_t ret = lock_alloc_agree(
+                     team_data, cohort == NULL || new_lock == NULL);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate lock state!", __FUNCTION__);
+    free(cohort);
+    free(new_lock);
+    return ret;
+  }
+
+  ret = dart_team_memalloc_aligned(
+          teamid, sizeof(dart_lock_cohort_slot_t),
+          DART_TYPE_BYTE, &gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    free(cohort);
+    free(new_lock);
+    return ret;
+  }
+
+  cohort->gptr   = gptr;
+  cohort->ticket = 0;
+  cohort->leader = unitid;
+
+  dart_segment_info_t *seginfo = cohort_seginfo(team_data, cohort);
+
+  dart_lock_cohort_slot_t *slot;
+  dart_gptr_setunit(&gptr, unitid);
+  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr, (void*)&slot), DART_OK);
+  slot->ticket      = 0;
+  slot->serving     = 0;
+  slot->global_held = 0;
+  slot->passes      = 0;
+  slot->next        = -1;
+  slot->granted     = 0;
+  slot->tail        = -1;
+  MPI_Win_sync(seginfo->win);
+  cohort->state     = slot;
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (cohort_slot_shared(team_data, seginfo, cohort, unitid.id) != NULL) {
+    /* The leader is the first unit of the cohort on the node. */
+    size_t max_size = dart__base__env__size(DART_LOCK_COHORT_SIZE_ENVSTR, 0);
+    int    local_id = team_data->sharedmem_tab[unitid.id].id;
+    int    leader_local_id = (max_size > 0)
+                             ? (int)((local_id / max_size) * max_size)
+                             : 0;
+    for (int u = 0; u < team_data->size; ++u) {
+      if (team_data->sharedmem_tab[u].id == leader_local_id) {
+        cohort->leader = DART_TEAM_UNIT_ID(u);
+        break;
+      }
+    }
+    cohort->state = cohort_slot_shared(
+                      team_data, seginfo, cohort, cohort->leader.id);
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+  /* All slots have to be initialized before the lock is used. */
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize lock initialization!",
+                   __FUNCTION__);
+    dart_team_memfree(cohort->gptr);
+    free(cohort);
+    free(new_lock);
+    return ret;
+  }
+
+  new_lock->gptr_tail   = DART_GPTR_NULL;
+  new_lock->gptr_list   = DART_GPTR_NULL;
+  new_lock->teamid      = teamid;
+  new_lock->is_acquired = 0;
+  new_lock->cohort      = cohort;
+  DART_ASSERT_RETURNS(
+    dart__base__mutex_init_recursive(&new_lock->mutex),
+    DART_OK);
+  *lock = new_lock;
+
+  DART_LOG_DEBUG("dart_team_cohort_lock_init: unit %d in cohort %d",
+                 unitid.id, cohort->leader.id);
+
+  return DART_OK;
+}
+
 dart_ret_t dart_lock_acquire(dart_lock_t lock)
 {
   /* lock the local mutex and keep it until the global lock is released */
@@ -147,6 +593,18 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
+  if (lock->cohort != NULL) {
+    dart_ret_t ret = cohort_acquire(lock, team_data);
+    if (ret != DART_OK) {
+      DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+      return ret;
+    }
+    DART_LOG_DEBUG("dart_lock_acquire: cohort lock acquired in team %d",
+                   lock->teamid);
+    lock->is_acquired = 1;
+    return DART_OK;
+  }
+
   dart_gptr_t gptr_tail = lock->gptr_tail;
   dart_gptr_t gptr_list = lock->gptr_list;
 
@@ -241,6 +699,22 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_ERR_INVAL;
   }
 
+  if (lock->cohort != NULL) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+    dart_ret_t ret = (team_data != NULL)
+                     ? cohort_try_acquire(lock, team_data, is_acquired)
+                     : DART_ERR_INVAL;
+    if (ret == DART_OK && *is_acquired) {
+      lock->is_acquired = 1;
+    } else {
+      DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    }
+    DART_LOG_DEBUG("dart_lock_try_acquire: cohort trylock %s in team %d",
+                   (*is_acquired) ? "succeeded" : "failed",
+                   lock->teamid);
+    return ret;
+  }
+
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
 
@@ -285,6 +759,77 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
   return DART_OK;
 }
 
+/* Monotonic time in microseconds used for lock timeouts. */
+static inline double dart_lock_timestamp_us()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((ts.tv_sec * 1E6)
+            + (ts.tv_nsec / 1E3));
+}
+
+/*
+ * Back off before the next attempt to acquire a contended lock: trigger
+ * progress so that the release of the current holder can complete, then
+ * sleep for the current delay but not past the deadline, and double the
+ * delay of the next attempt.
+ */
+static void dart_lock_backoff(
+  dart_team_t   teamid,
+  double        deadline,
+  double      * delay_us)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data != NULL) {
+    int flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG,
+      team_data->comm, &flag, MPI_STATUS_IGNORE);
+  }
+  double wait_us = deadline - dart_lock_timestamp_us();
+  if (wait_us > *delay_us) {
+    wait_us = *delay_us;
+  }
+  if (wait_us > 0) {
+    struct timespec ts;
+    ts.tv_sec  = (time_t)(wait_us / 1E6);
+    ts.tv_nsec = (long)((wait_us - ts.tv_sec * 1E6) * 1E3);
+    nanosleep(&ts, NULL);
+  }
+  *delay_us *= 2;
+  if (*delay_us > DART_LOCK_BACKOFF_MAX_US) {
+    *delay_us = DART_LOCK_BACKOFF_MAX_US;
+  }
+}
+
+/*
+ * Units do not enqueue in the lock queue but retry with exponential
+ * backoff, as an abandoned queue entry would block the release of its
+ * predecessor. Hence timed acquisition is not fair.
+ */
+dart_ret_t dart_lock_try_acquire_for(
+  dart_lock_t   lock,
+  uint64_t      timeout_us,
+  int32_t     * is_acquired)
+{
+  double deadline = dart_lock_timestamp_us() + (double)timeout_us;
+  double delay_us = DART_LOCK_BACKOFF_MIN_US;
+  while (1) {
+    dart_ret_t ret = dart_lock_try_acquire(lock, is_acquired);
+    if (ret != DART_OK || *is_acquired) {
+      return ret;
+    }
+    if (dart_lock_timestamp_us() >= deadline) {
+      break;
+    }
+    dart_lock_backoff(lock->teamid, deadline, &delay_us);
+  }
+
+  DART_LOG_DEBUG("dart_lock_try_acquire_for: timeout after %"PRIu64" us "
+                 "in team %d", timeout_us, lock->teamid);
+  return DART_OK;
+}
+
 dart_ret_t dart_lock_release(dart_lock_t lock)
 {
   if (lock->is_acquired == 0) {
@@ -298,6 +843,18 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
 
+  if (lock->cohort != NULL) {
+    dart_ret_t ret = cohort_release(lock, team_data);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    lock->is_acquired = 0;
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    DART_LOG_DEBUG("dart_lock_release: release cohort lock in team %d",
+                   lock->teamid);
+    return DART_OK;
+  }
+
   uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
   dart_unit_t   tail        = gptr_tail.unitid;
   int32_t     * addr;
@@ -385,6 +942,22 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 
   dart_team_myid(teamid, &unitid);
 
+  if ((*lock)->cohort != NULL) {
+    ret = dart_team_memfree((*lock)->cohort->gptr);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("Failed to free global mmeory");
+      return ret;
+    }
+    free((*lock)->cohort);
+    (*lock)->cohort = NULL;
+    (*lock)->teamid = DART_TEAM_NULL;
+    dart__base__mutex_destroy(&(*lock)->mutex);
+    DART_LOG_DEBUG("dart_team_lock_free: cohort lock done in team %d",
+                   teamid);
+    free(*lock);
+    *lock = NULL;
+    return DART_OK;
+  }
 
   /* Unit 0 is the process holding the gptr_tail by default. */
   if (unitid.id == 0) {
@@ -412,3 +985,449 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 
 
 
+
+/* -- Reader-writer lock -- */
+
+/**
+ * Layout of the slot allocated per unit for a reader-writer lock. The
+ * writer flag is only used in the slot of unit 0, the reader counter and
+ * the replicated writer flag of a node in the slot of its first unit.
+ */
+typedef struct dart_rwlock_slot
+{
+  /** Non-zero while a writer holds or waits for the lock. */
+  int32_t writer;
+  /** Number of readers on the node holding the lock. */
+  int32_t readers;
+  /** Copy of the writer flag checked by readers on the node. */
+  int32_t blocked;
+} dart_rwlock_slot_t;
+
+struct dart_rwlock_struct
+{
+  /** Team-allocated slots, one per unit. */
+  dart_gptr_t        gptr;
+  /** Team this lock is used for. */
+  dart_team_t        teamid;
+  /** Unit holding the reader counter of this unit's node. */
+  dart_team_unit_t   node_leader;
+  /** Units holding the reader counters of all nodes. */
+  dart_team_unit_t * leaders;
+  /** Number of nodes in the team. */
+  int                num_leaders;
+  /** Window of the slots. */
+  MPI_Win            win;
+  /**
+   * Writer flag of this unit's node in shared memory, NULL if it is only
+   * accessible through RMA.
+   */
+  int32_t          * node_blocked;
+  /** Whether this unit holds the lock exclusively. */
+  int32_t            is_acquired;
+  /** Number of shared acquisitions held by this unit. */
+  int32_t            num_shared;
+};
+
+static inline dart_gptr_t rwlock_field_gptr(
+  const dart_rwlock_t lock,
+  dart_team_unit_t    unit,
+  size_t              field)
+{
+  dart_gptr_t gptr = lock->gptr;
+  dart_gptr_setunit(&gptr, unit);
+  gptr.addr_or_offs.offset += field;
+  return gptr;
+}
+
+static inline dart_gptr_t rwlock_writer_gptr(const dart_rwlock_t lock)
+{
+  return rwlock_field_gptr(
+           lock, DART_TEAM_UNIT_ID(0), offsetof(dart_rwlock_slot_t, writer));
+}
+
+static inline dart_gptr_t rwlock_readers_gptr(
+  const dart_rwlock_t lock,
+  dart_team_unit_t    unit)
+{
+  return rwlock_field_gptr(
+           lock, unit, offsetof(dart_rwlock_slot_t, readers));
+}
+
+static inline dart_gptr_t rwlock_blocked_gptr(
+  const dart_rwlock_t lock,
+  dart_team_unit_t    unit)
+{
+  return rwlock_field_gptr(
+           lock, unit, offsetof(dart_rwlock_slot_t, blocked));
+}
+
+/* Atomically apply op with value to the counter at gptr. */
+static dart_ret_t rwlock_fetch_and_op(
+  dart_gptr_t       gptr,
+  int32_t           value,
+  dart_operation_t  op,
+  int32_t         * result)
+{
+  dart_ret_t ret = dart_fetch_and_op(
+                     gptr, &value, result, DART_TYPE_INT, op);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  return dart_flush(gptr);
+}
+
+/* Set the copies of the writer flag of all nodes. */
+static dart_ret_t rwlock_set_blocked(
+  dart_rwlock_t lock,
+  int32_t       value)
+{
+  for (int l = 0; l < lock->num_leaders; ++l) {
+    dart_ret_t ret = dart_accumulate(
+                       rwlock_blocked_gptr(lock, lock->leaders[l]),
+                       &value, 1, DART_TYPE_INT, DART_OP_REPLACE);
+    if (ret != DART_OK) return ret;
+  }
+  return dart_flush_all(lock->gptr);
+}
+
+/* Read the writer flag of this unit's node. */
+static dart_ret_t rwlock_get_blocked(
+  dart_rwlock_t   lock,
+  int32_t       * blocked)
+{
+  if (lock->node_blocked != NULL) {
+    MPI_Win_sync(lock->win);
+    *blocked = DART_LOAD_ACQUIRE32(lock->node_blocked);
+    return DART_OK;
+  }
+  return rwlock_fetch_and_op(
+           rwlock_blocked_gptr(lock, lock->node_leader),
+           0, DART_OP_NO_OP, blocked);
+}
+
+/*
+ * Set the writer flag and its copies on all nodes and wait for the
+ * reader counters of all nodes to drain, backing off between attempts.
+ * Gives up after the first attempt if blocking is zero or once the
+ * deadline has passed.
+ */
+static dart_ret_t rwlock_acquire(
+  dart_rwlock_t   lock,
+  int             blocking,
+  double          deadline,
+  int32_t       * is_acquired)
+{
+  dart_gptr_t writer_gptr = rwlock_writer_gptr(lock);
+  int32_t     one         = 1;
+  int32_t     zero        = 0;
+  int32_t     result;
+  double      delay_us    = DART_LOCK_BACKOFF_MIN_US;
+  dart_ret_t  ret;
+
+  *is_acquired = 0;
+  do {
+    ret = dart_compare_and_swap(
+            writer_gptr, &one, &zero, &result, DART_TYPE_INT);
+    if (ret != DART_OK) return ret;
+    ret = dart_flush(writer_gptr);
+    if (ret != DART_OK) return ret;
+    if (result == 0) break;
+    if (!blocking || dart_lock_timestamp_us() >= deadline) {
+      return DART_OK;
+    }
+    dart_lock_backoff(lock->teamid, deadline, &delay_us);
+  } while (1);
+
+  ret = rwlock_set_blocked(lock, 1);
+  if (ret != DART_OK) return ret;
+
+  /* Readers that registered before the flag was set are still active. */
+  for (int l = 0; l < lock->num_leaders; ++l) {
+    dart_gptr_t readers_gptr = rwlock_readers_gptr(lock, lock->leaders[l]);
+    delay_us = DART_LOCK_BACKOFF_MIN_US;
+    do {
+      ret = rwlock_fetch_and_op(readers_gptr, 0, DART_OP_NO_OP, &result);
+      if (ret != DART_OK) return ret;
+      if (result == 0) break;
+      if (!blocking || dart_lock_timestamp_us() >= deadline) {
+        DART_LOG_DEBUG("dart_rwlock_acquire: readers remaining on unit %d",
+                       lock->leaders[l].id);
+        ret = rwlock_set_blocked(lock, 0);
+        if (ret != DART_OK) return ret;
+        return rwlock_fetch_and_op(
+                 writer_gptr, 0, DART_OP_REPLACE, &result);
+      }
+      dart_lock_backoff(lock->teamid, deadline, &delay_us);
+    } while (1);
+  }
+
+  DART_STORE_RELEASE32(&lock->is_acquired, 1);
+  *is_acquired = 1;
+  return DART_OK;
+}
+
+/*
+ * Register in the reader counter of the node and check that no writer
+ * is active, back off with exponential delay and retry otherwise. Only
+ * accesses the slot of the node's first unit.
+ */
+static dart_ret_t rwlock_acquire_shared(
+  dart_rwlock_t   lock,
+  int             blocking,
+  double          deadline,
+  int32_t       * is_acquired)
+{
+  dart_gptr_t readers_gptr = rwlock_readers_gptr(lock, lock->node_leader);
+  int32_t     blocked;
+  int32_t     result;
+  double      delay_us     = DART_LOCK_BACKOFF_MIN_US;
+  dart_ret_t  ret;
+
+  *is_acquired = 0;
+  while (1) {
+    ret = rwlock_get_blocked(lock, &blocked);
+    if (ret != DART_OK) return ret;
+    if (blocked == 0) {
+      ret = rwlock_fetch_and_op(readers_gptr, 1, DART_OP_SUM, &result);
+      if (ret != DART_OK) return ret;
+      ret = rwlock_get_blocked(lock, &blocked);
+      if (ret != DART_OK) return ret;
+      if (blocked == 0) {
+        DART_FETCH_AND_INC32(&lock->num_shared);
+        *is_acquired = 1;
+        return DART_OK;
+      }
+      /* A writer arrived in between, let it pass. */
+      ret = rwlock_fetch_and_op(readers_gptr, -1, DART_OP_SUM, &result);
+      if (ret != DART_OK) return ret;
+    }
+    if (!blocking || dart_lock_timestamp_us() >= deadline) {
+      break;
+    }
+    dart_lock_backoff(lock->teamid, deadline, &delay_us);
+  }
+
+  return DART_OK;
+}
+
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid, dart_rwlock_t* lock)
+{
+  dart_gptr_t      gptr;
+  dart_team_unit_t unitid;
+
+  *lock = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_myid(teamid, &unitid);
+
+  dart_rwlock_t     new_lock     = malloc(sizeof(struct dart_rwlock_struct));
+  dart_team_unit_t *leaders      = malloc(
+                                     team_data->size *
+                                     sizeof(dart_team_unit_t));
+  int32_t          *node_leaders = malloc(team_data->size * sizeof(int32_t));
+  dart_ret_t ret = lock_alloc_agree(
+                     team_data,
+                     new_lock == NULL || leaders == NULL ||
+                     node_leaders == NULL);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate lock state!", __FUNCTION__);
+    free(new_lock);
+    free(leaders);
+    free(node_leaders);
+    return ret;
+  }
+
+  ret = dart_team_memalloc_aligned(
+          teamid, sizeof(dart_rwlock_slot_t),
+          DART_TYPE_BYTE, &gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    free(new_lock);
+    free(leaders);
+    free(node_leaders);
+    return ret;
+  }
+
+  dart_rwlock_slot_t *slot;
+  dart_gptr_setunit(&gptr, unitid);
+  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr, (void*)&slot), DART_OK);
+  slot->writer  = 0;
+  slot->readers = 0;
+  slot->blocked = 0;
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), gptr.segid);
+  MPI_Win_sync(seginfo->win);
+
+  /* The reader counter of a node is held by its first unit. */
+  int32_t node_leader = unitid.id;
+  if (team_data->sharedmem_tab != NULL) {
+    for (int u = 0; u < team_data->size; ++u) {
+      if (team_data->sharedmem_tab[u].id == 0) {
+        node_leader = u;
+        break;
+      }
+    }
+  }
+
+  ret = dart_allgather(
+          &node_leader, node_leaders, 1, DART_TYPE_INT, teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to exchange node leaders!", __FUNCTION__);
+    free(new_lock);
+    free(leaders);
+    free(node_leaders);
+    dart_team_memfree(gptr);
+    return ret;
+  }
+
+  new_lock->gptr         = gptr;
+  new_lock->teamid       = teamid;
+  new_lock->node_leader  = DART_TEAM_UNIT_ID(node_leader);
+  new_lock->leaders      = leaders;
+  new_lock->num_leaders  = 0;
+  new_lock->win          = seginfo->win;
+  new_lock->node_blocked = NULL;
+  new_lock->is_acquired  = 0;
+  new_lock->num_shared   = 0;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS) && \
+    defined(DART_HAVE_SYNC_BUILTINS)
+  if (seginfo->baseptr != NULL && team_data->sharedmem_tab != NULL &&
+      team_data->sharedmem_tab[node_leader].id >= 0) {
+    new_lock->node_blocked = (int32_t *)(
+      seginfo->baseptr[team_data->sharedmem_tab[node_leader].id] +
+      gptr.addr_or_offs.offset + offsetof(dart_rwlock_slot_t, blocked));
+  }
+#endif // !DART_MPI_DISABLE_SHARED_WINDOWS && DART_HAVE_SYNC_BUILTINS
+  for (int u = 0; u < team_data->size; ++u) {
+    if (node_leaders[u] == u) {
+      new_lock->leaders[new_lock->num_leaders++] = DART_TEAM_UNIT_ID(u);
+    }
+  }
+  free(node_leaders);
+  *lock = new_lock;
+
+  DART_LOG_DEBUG("dart_team_rwlock_init: unit %d on node of unit %d, "
+                 "%d nodes in team %d",
+                 unitid.id, node_leader, new_lock->num_leaders, teamid);
+
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire(dart_rwlock_t lock)
+{
+  int32_t is_acquired;
+  dart_ret_t ret = rwlock_acquire(lock, 1, DBL_MAX, &is_acquired);
+  if (ret == DART_OK) {
+    DART_LOG_DEBUG("dart_rwlock_acquire: lock acquired in team %d",
+                   lock->teamid);
+  }
+  return ret;
+}
+
+dart_ret_t dart_rwlock_try_acquire(dart_rwlock_t lock, int32_t *is_acquired)
+{
+  return rwlock_acquire(lock, 0, 0.0, is_acquired);
+}
+
+dart_ret_t dart_rwlock_try_acquire_for(
+  dart_rwlock_t   lock,
+  uint64_t        timeout_us,
+  int32_t       * is_acquired)
+{
+  return rwlock_acquire(
+           lock, 1, dart_lock_timestamp_us() + (double)timeout_us,
+           is_acquired);
+}
+
+dart_ret_t dart_rwlock_release(dart_rwlock_t lock)
+{
+  int32_t result;
+  /* reset before the writer flag, another thread may acquire the lock */
+  if (!DART_COMPARE_AND_SWAP32(&lock->is_acquired, 1, 0)) {
+    DART_LOG_ERROR("dart_rwlock_release: LOCK has not been acquired");
+    return DART_ERR_INVAL;
+  }
+  dart_ret_t ret = rwlock_set_blocked(lock, 0);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  ret = rwlock_fetch_and_op(
+          rwlock_writer_gptr(lock), 0, DART_OP_REPLACE, &result);
+  DART_LOG_DEBUG("dart_rwlock_release: release lock in team %d",
+                 lock->teamid);
+  return ret;
+}
+
+dart_ret_t dart_rwlock_acquire_shared(dart_rwlock_t lock)
+{
+  int32_t is_acquired;
+  dart_ret_t ret = rwlock_acquire_shared(lock, 1, DBL_MAX, &is_acquired);
+  if (ret == DART_OK) {
+    DART_LOG_DEBUG("dart_rwlock_acquire_shared: lock acquired in team %d",
+                   lock->teamid);
+  }
+  return ret;
+}
+
+dart_ret_t dart_rwlock_try_acquire_shared(
+  dart_rwlock_t   lock,
+  int32_t       * is_acquired)
+{
+  return rwlock_acquire_shared(lock, 0, 0.0, is_acquired);
+}
+
+dart_ret_t dart_rwlock_try_acquire_shared_for(
+  dart_rwlock_t   lock,
+  uint64_t        timeout_us,
+  int32_t       * is_acquired)
+{
+  return rwlock_acquire_shared(
+           lock, 1, dart_lock_timestamp_us() + (double)timeout_us,
+           is_acquired);
+}
+
+dart_ret_t dart_rwlock_release_shared(dart_rwlock_t lock)
+{
+  int32_t result;
+  if (DART_FETCH_AND_DEC32(&lock->num_shared) <= 0) {
+    DART_FETCH_AND_INC32(&lock->num_shared);
+    DART_LOG_ERROR("dart_rwlock_release_shared: LOCK has not been acquired");
+    return DART_ERR_INVAL;
+  }
+  dart_gptr_t readers_gptr = rwlock_readers_gptr(lock, lock->node_leader);
+  dart_ret_t  ret          = rwlock_fetch_and_op(
+                               readers_gptr, -1, DART_OP_SUM, &result);
+  if (ret != DART_OK) {
+    DART_FETCH_AND_INC32(&lock->num_shared);
+    return ret;
+  }
+  if (result <= 0) {
+    /* the counter must not drop below zero, revert the decrement */
+    DART_LOG_ERROR("dart_rwlock_release_shared: no readers registered "
+                   "on unit %d", lock->node_leader.id);
+    rwlock_fetch_and_op(readers_gptr, 1, DART_OP_SUM, &result);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_rwlock_release_shared: release lock in team %d",
+                 lock->teamid);
+  return ret;
+}
+
+dart_ret_t dart_team_rwlock_destroy(dart_rwlock_t* lock)
+{
+  dart_ret_t ret = dart_team_memfree((*lock)->gptr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to free global mmeory");
+    return ret;
+  }
+  DART_LOG_DEBUG("dart_team_rwlock_destroy: done in team %d",
+                 (*lock)->teamid);
+  free((*lock)->leaders);
+  free(*lock);
+  *lock = NULL;
+  return DART_OK;
+}
@@ -17,6 +17,7 @@
 #include <dash/dart/base/locality.h>
 
 #include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_group_priv.h>
 
 #include <limits.h>
@@ -633,6 +634,8 @@ dart_ret_t dart_team_create(
     MPI_Comm_rank(team_data->comm, &rank);
     team_data->unitid = rank;
     MPI_Comm_size(team_data->comm, &team_data->size);
+    team_data->stats_target = calloc(team_data->size,
+                                     sizeof(dart_stats_target_t));
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
     dart_allocate_shared_comm(team_data);
@@ -666,6 +669,8 @@ dart_ret_t dart_team_destroy(
 
   comm = team_data->comm;
 
+  dart__mpi__symheap_release(team_data);
+
   // free(dart_unit_mapping[index]);
 
   // MPI_Win_free (&(sharedmem_win_list[index]));
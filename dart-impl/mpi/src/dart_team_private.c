@@ -222,6 +222,7 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid)
   }
 
   res->next = NULL;
+  free(res->stats_target);
   free(res);
   return DART_OK;
 }
@@ -248,6 +249,7 @@ dart_ret_t dart_adapt_teamlist_destroy()
       dart_team_data_t *tmp = elem;
       elem = tmp->next;
       tmp->next = NULL;
+      free(tmp->stats_target);
       free(tmp);
     }
     dart_team_data[i] = NULL;
@@ -255,6 +257,20 @@ dart_ret_t dart_adapt_teamlist_destroy()
   return DART_OK;
 }
 
+dart_ret_t dart__mpi__team_agree_max(
+  const dart_team_data_t * team_data,
+  int                      local_status,
+  int                    * team_status)
+{
+  *team_status = local_status;
+  if (MPI_Allreduce(
+        MPI_IN_PLACE, team_status, 1, MPI_INT, MPI_MAX,
+        team_data->comm) != MPI_SUCCESS) {
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
 {
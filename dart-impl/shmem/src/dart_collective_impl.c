@@ -7,6 +7,9 @@
 #include <dash/dart/shmem/shmem_logger.h>
 #include <dash/dart/shmem/shmem_barriers_if.h>
 
+#include <stdlib.h>
+#include <string.h>
+
 dart_ret_t dart_barrier(dart_team_t teamid)
 {
   dart_ret_t ret;
@@ -137,3 +140,99 @@ dart_ret_t dart_allgather(void *sendbuf, void *recvbuf, size_t nbytes,
   dart_bcast(recvbuf,nbytes,root,team);
   return DART_OK;
 }
+
+dart_ret_t dart_alltoall(void *sendbuf, void *recvbuf, size_t nbytes,
+			 dart_team_t team)
+{
+  //SANITY_CHECK_TEAM(team);
+  dart_unit_t myid;
+  size_t size;
+  int i, root;
+  char* sbuf = (char*)sendbuf;
+  char* rbuf = (char*)recvbuf;
+  char* tmp  = 0;
+
+  dart_team_myid(team, &myid);
+  dart_team_size(team, &size);
+  DEBUG("dart_alltoall on team %d, tsize=%d", team, size);
+  if( sbuf != 0 && sbuf == rbuf ){
+    // in-place: blocks received in early rounds would overwrite
+    // blocks to be sent in later rounds
+    tmp  = (char*)malloc(nbytes*size);
+    memcpy(tmp, rbuf, nbytes*size);
+    sbuf = tmp;
+  }
+  // one scatter per unit, only the root of a round is sending so
+  // blocking pipes cannot deadlock
+  for( root = 0; root < size; root++ ){
+    if( myid == root ){
+      for( i = 0; i < size; i++ ){
+        if( i != root ){
+          DEBUG("dart_alltoall sending to %d %d bytes", i, nbytes);
+          dart_shmem_send(&sbuf[nbytes*i], nbytes, team, i);
+        }else{
+          memcpy(&rbuf[nbytes*i], &sbuf[nbytes*i], nbytes);
+        }
+      }
+    }else{
+      DEBUG("dart_alltoall receiving from %d %d bytes", root, nbytes);
+      dart_shmem_recv(&rbuf[nbytes*root], nbytes, team, root);
+    }
+  }
+  free(tmp);
+  dart_barrier(team);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(void *sendbuf, size_t *nsendbytes,
+			  size_t *senddispls, void *recvbuf,
+			  size_t *nrecvbytes, size_t *recvdispls,
+			  dart_team_t team)
+{
+  //SANITY_CHECK_TEAM(team);
+  dart_unit_t myid;
+  size_t size;
+  int i, root;
+  char* sbuf = (char*)sendbuf;
+  char* rbuf = (char*)recvbuf;
+  char* tmp  = 0;
+
+  dart_team_myid(team, &myid);
+  dart_team_size(team, &size);
+  DEBUG("dart_alltoallv on team %d, tsize=%d", team, size);
+  if( sbuf != 0 && sbuf == rbuf ){
+    // in-place: send blocks are described by the receive counts and
+    // displacements
+    size_t tmpsize = 0;
+    for( i = 0; i < size; i++ ){
+      if( recvdispls[i] + nrecvbytes[i] > tmpsize ){
+        tmpsize = recvdispls[i] + nrecvbytes[i];
+      }
+    }
+    tmp        = (char*)malloc(tmpsize);
+    memcpy(tmp, rbuf, tmpsize);
+    sbuf       = tmp;
+    nsendbytes = nrecvbytes;
+    senddispls = recvdispls;
+  }
+  for( root = 0; root < size; root++ ){
+    if( myid == root ){
+      for( i = 0; i < size; i++ ){
+        if( i != root ){
+          DEBUG("dart_alltoallv sending to %d %d bytes", i, nsendbytes[i]);
+          dart_shmem_send(&sbuf[senddispls[i]], nsendbytes[i], team, i);
+        }else{
+          memcpy(&rbuf[recvdispls[i]], &sbuf[senddispls[i]],
+                 nsendbytes[i]);
+        }
+      }
+    }else{
+      DEBUG("dart_alltoallv receiving from %d %d bytes",
+            root, nrecvbytes[root]);
+      dart_shmem_recv(&rbuf[recvdispls[root]], nrecvbytes[root], team, root);
+    }
+  }
+  free(tmp);
+  dart_barrier(team);
+  return DART_OK;
+}
@@ -44,6 +44,7 @@ typedef struct benchmark_params_t {
   size_t size_base;
   size_t num_updates;
   size_t rep_base;
+  size_t agg_capacity;
   bool   verify;
 } benchmark_params;
 
@@ -102,6 +103,18 @@ void RandomAccessUpdate(const benchmark_params & params)
   uint64_t ran = starts(params.num_updates / dash::size() * dash::myid());
   auto     table_size = params.size_base;
 
+  if (params.agg_capacity > 0) {
+    // Buffer updates per target unit and ship them in batches:
+    dash::Aggregator<decltype(Table), dash::bit_xor<value_t>>
+      agg(Table, params.agg_capacity);
+    for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
+      ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
+      int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
+      agg.update(g_idx, ran);
+    }
+    return;
+  }
+
   for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
     ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
     int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
@@ -184,6 +197,7 @@ void perform_test(const benchmark_params & params)
     cout << setw(6)  << "units"     << ","
          << setw(12) << "size"      << ","
          << setw(9)  << "mpi.impl"  << ","
+         << setw(9)  << "agg.buf"   << ","
          << setw(12) << "mb.total"  << ","
          << setw(12) << "mb.unit"   << ","
          << setw(12) << "updates.m" << ","
@@ -197,6 +211,7 @@ void perform_test(const benchmark_params & params)
     cout << setw(6)  << nunits           << ","
          << setw(12) << params.size_base << ","
          << setw(9)  << mpi_impl         << ","
+         << setw(9)  << params.agg_capacity << ","
          << setw(12) << std::fixed << std::setprecision(2) << mb_total  << ","
          << setw(12) << std::fixed << std::setprecision(2) << mb_unit   << ","
          << setw(12) << std::fixed << std::setprecision(2) << updates_m << ","
@@ -279,10 +294,11 @@ void perform_test(const benchmark_params & params)
 benchmark_params parse_args(int argc, char * argv[])
 {
   benchmark_params params;
-  params.size_base   = TableSize;
-  params.num_updates = NUPDATE;
-  params.rep_base    = 1;
-  params.verify      = false;
+  params.size_base    = TableSize;
+  params.num_updates  = NUPDATE;
+  params.rep_base     = 1;
+  params.agg_capacity = 0;
+  params.verify       = false;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -290,11 +306,15 @@ benchmark_params parse_args(int argc, char * argv[])
       params.size_base = atoi(argv[i+1]);
     } else if (flag == "-rb") {
       params.rep_base  = atoi(argv[i+1]);
+    } else if (flag == "-agg") {
+      params.agg_capacity = atoi(argv[i+1]);
     } else if (flag == "-verify") {
       params.verify    = true;
       --i;
     }
   }
+  // NUPDATE for table size base:
+  params.num_updates = 4 * params.size_base;
   return params;
 }
 
@@ -309,6 +329,7 @@ void print_params(
   bench_cfg.print_section_start("Runtime arguments");
   bench_cfg.print_param("-sb",     "size base",    params.size_base);
   bench_cfg.print_param("-rb",     "rep. base",    params.rep_base);
+  bench_cfg.print_param("-agg",    "aggr. buffer", params.agg_capacity);
   bench_cfg.print_param("-verify", "verification", params.verify);
   bench_cfg.print_section_end();
 }
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <algorithm>
+#include <string>
 #include <libdash.h>
 
 #include "../bench.h"
@@ -22,6 +24,12 @@ int main(int argc, char **argv)
   
   dash::init(&argc, &argv);
 
+  // number of buffered updates per unit in aggregated histogram
+  size_t agg_capacity = dash::Aggregator<dash::Array<int>>::DefaultCapacity;
+  if(argc > 2 && std::string(argv[1]) == "-agg") {
+    agg_capacity = atoi(argv[2]);
+  }
+
   int myid = dash::myid();
   int size = dash::size();
 
@@ -88,6 +96,33 @@ int main(int argc, char **argv)
     cout<<"MKeys/sec: "<<(NUM_KEYS*1.0e-6)/(tstop-tstart)<<endl;
   }
 
+  // compute the histogram again with fine-grained remote updates of
+  // single bins, aggregated per target unit
+  dash::Array<int> key_histo_agg(MAX_KEY, dash::BLOCKED);
+  dash::fill(key_histo_agg.begin(), key_histo_agg.end(), 0);
+
+  dash::barrier();
+  TIMESTAMP(tstart);
+  {
+    dash::Aggregator<decltype(key_histo_agg)> agg(key_histo_agg, agg_capacity);
+    for(int i=0; i<key_array.lsize(); i++) {
+      agg.update(key_array.local[i], 1);
+    }
+  }
+  dash::barrier();
+  TIMESTAMP(tstop);
+
+  if(myid==0) {
+    cout<<"MKeys/sec (aggregated, buffer "<<agg_capacity<<"): "
+        <<(NUM_KEYS*1.0e-6)/(tstop-tstart)<<endl;
+  }
+
+  bool agg_valid = std::equal(key_histo.lbegin(), key_histo.lend(),
+                              key_histo_agg.lbegin());
+  if(!agg_valid) {
+    cout<<"unit "<<myid<<": aggregated histogram differs"<<endl;
+  }
+
 #ifdef DBGOUT
   dash::barrier();
   if(myid==0) {
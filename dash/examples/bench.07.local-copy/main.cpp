@@ -10,6 +10,8 @@
 #include <string>
 #include <cstring>
 #include <limits>
+#include <array>
+#include <algorithm>
 
 #include <malloc.h>
 
@@ -52,6 +54,7 @@ typedef struct benchmark_params_t {
   bool   verify;
   bool   local_only;
   bool   flush_cache;
+  size_t bcyclic_size;
 } benchmark_params;
 
 typedef enum local_copy_method_t {
@@ -81,6 +84,13 @@ measurement copy_block_to_local(
   const benchmark_params & params,
   local_copy_method        l_copy_method = DASH_COPY);
 
+measurement copy_bcyclic_to_local(
+  size_t                   size,
+  size_t                   num_repeats,
+  index_t                  target_unit_id,
+  const benchmark_params & params,
+  local_copy_method        l_copy_method = DASH_COPY);
+
 void print_measurement_header();
 void print_measurement_record(
   const std::string      & scenario,
@@ -242,6 +252,32 @@ int main(int argc, char** argv)
   }
 #endif
 
+#if 1
+  // Copy range spanning blocks of all units in block-cyclic distribution:
+  for (auto l_copy_method : { DASH_COPY, DASH_COPY_ASYNC }) {
+    num_repeats = params.num_repeats;
+    for (size_t i = 0; i < num_iterations && num_repeats > 0;
+         ++i, num_repeats /= params.rep_base)
+    {
+      auto block_size = std::pow(params.size_base,i) * size_inc;
+      auto size       = block_size * dash::size();
+
+      num_repeats     = std::max<size_t>(num_repeats, params.min_repeats);
+
+      u_dst    = u_loc;
+      ts_start = Timer::Now();
+      res      = copy_bcyclic_to_local(size, num_repeats, u_dst, params,
+                                       l_copy_method);
+      time_s   = Timer::ElapsedSince(ts_start) * 1.0e-06;
+      print_measurement_record(
+        (l_copy_method == DASH_COPY) ? "bcyclic" : "bcyclic.a",
+        "dash::copy", bench_cfg,
+        -1, u_dst, -1, size, num_repeats,
+        time_s, res, params);
+    }
+  }
+#endif
+
   if( dash::myid()==0 ) {
     cout << "Benchmark finished" << endl;
   }
@@ -471,6 +507,107 @@ measurement copy_block_to_local(
   return result;
 }
 
+/**
+ * Copies the first \c size / \c dash::size() elements of an array in
+ * block-cyclic distribution to local memory of the target unit.
+ * The copied range consists of blocks of all units unless the block size
+ * exceeds the range.
+ */
+measurement copy_bcyclic_to_local(
+  size_t                   size,
+  size_t                   num_repeats,
+  index_t                  target_unit_id,
+  const benchmark_params & params,
+  local_copy_method        l_copy_method)
+{
+  measurement result;
+  result.time_init_s        = 0;
+  result.time_copy_s        = 0;
+  result.time_copy_min_us   = 0;
+  result.time_copy_max_us   = 0;
+  result.time_copy_med_us   = 0;
+  result.time_copy_sdv_us   = 0;
+  result.mb_per_s           = 0;
+
+  auto   myid        = dash::myid();
+  size_t copy_n      = size / dash::size();
+  size_t copy_bytes  = copy_n * sizeof(ElementType);
+
+  dash::Array<ElementType> global_array(
+                             size, dash::BLOCKCYCLIC(params.bcyclic_size));
+  for (size_t l = 0; l < global_array.lsize(); ++l) {
+    global_array.local[l] = global_array.pattern().global(l);
+  }
+
+  std::vector<ElementType> local_array;
+  if (myid == target_unit_id) {
+    local_array.resize(copy_n);
+  }
+
+  double total_copy_us = 0;
+  std::vector<double> history_copy_us;
+  for (size_t r = 0; r < num_repeats; ++r) {
+    dash::barrier();
+    if (myid == target_unit_id) {
+      auto ts_copy_start = Timer::Now();
+      ElementType * copy_lend;
+      if (l_copy_method == DASH_COPY_ASYNC) {
+        copy_lend = dash::copy_async(global_array.begin(),
+                                     global_array.begin() + copy_n,
+                                     local_array.data()).get();
+      } else {
+        copy_lend = dash::copy(global_array.begin(),
+                               global_array.begin() + copy_n,
+                               local_array.data());
+      }
+      auto copy_us   = Timer::ElapsedSince(ts_copy_start);
+      total_copy_us += copy_us;
+      history_copy_us.push_back(copy_us);
+
+      if (copy_lend != local_array.data() + copy_n) {
+        DASH_THROW(dash::exception::RuntimeError,
+                   "copy_bcyclic_to_local: " <<
+                   "Unexpected end of copy output range");
+      }
+      if (params.verify) {
+        for (size_t i = 0; i < copy_n; ++i) {
+          if (local_array[i] != static_cast<ElementType>(i)) {
+            DASH_THROW(dash::exception::RuntimeError,
+                       "copy_bcyclic_to_local: Validation failed " <<
+                       "for copied element at offset " << i << ": " <<
+                       "actual: " << local_array[i]);
+          }
+        }
+      }
+    }
+  }
+  dash::barrier();
+
+  // Results are reported by unit 0:
+  std::array<double, 5> times {{ total_copy_us, 0, 0, 0, 0 }};
+  if (myid == target_unit_id) {
+    std::sort(history_copy_us.begin(), history_copy_us.end());
+    times[1] = history_copy_us.front();
+    times[2] = history_copy_us[history_copy_us.size() / 2];
+    times[3] = history_copy_us.back();
+    times[4] = dash::math::sigma(history_copy_us.begin(),
+                                 history_copy_us.end());
+  }
+  dart_bcast(times.data(), times.size(), DART_TYPE_DOUBLE,
+             dart_team_unit_t { static_cast<dart_unit_t>(target_unit_id) },
+             DART_TEAM_ALL);
+
+  double mb_copied        = static_cast<double>(copy_bytes * num_repeats)
+                            / 1024.0 / 1024.0;
+  result.time_copy_s      = times[0] * 1.0e-6;
+  result.time_copy_min_us = times[1];
+  result.time_copy_med_us = times[2];
+  result.time_copy_max_us = times[3];
+  result.time_copy_sdv_us = times[4];
+  result.mb_per_s         = mb_copied / result.time_copy_s;
+  return result;
+}
+
 void print_measurement_header()
 {
   if (dash::myid() == 0) {
@@ -557,6 +694,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.local_only     = false;
   params.flush_cache    = false;
   params.size_min       = 64;
+  params.bcyclic_size   = 16;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -578,6 +716,8 @@ benchmark_params parse_args(int argc, char * argv[])
     } else if (flag == "-lo") {
       params.local_only     = true;
       --i;
+    } else if (flag == "-bc") {
+      params.bcyclic_size   = atoi(argv[i+1]);
     } else if (flag == "-fcache") {
       params.flush_cache    = true;
       --i;
@@ -607,6 +747,7 @@ void print_params(
   bench_cfg.print_param("-verify", "verification",          params.verify);
   bench_cfg.print_param("-lo",     "local only",            params.local_only);
   bench_cfg.print_param("-fcache", "no copying from cache", params.flush_cache);
+  bench_cfg.print_param("-bc",     "block-cyclic block size", params.bcyclic_size);
   bench_cfg.print_section_end();
 }
 
@@ -107,6 +107,7 @@ typedef struct benchmark_params_t {
   float       cpu_gflops_peak;
   bool        mkl_dyn;
   bool        verify;
+  unsigned    replication;
 } benchmark_params;
 
 template<typename MatrixType>
@@ -135,6 +136,11 @@ std::pair<double, double> test_blas(
   unsigned                 repeat,
   const benchmark_params & params);
 
+std::pair<double, double> test_gemm(
+  extent_t                 sb,
+  unsigned                 repeat,
+  const benchmark_params & params);
+
 std::pair<double, double> test_plasma(
   extent_t                 sb,
   unsigned                 repeat,
@@ -146,6 +152,12 @@ std::pair<double, double> test_pblas(
   unsigned                 repeat,
   const benchmark_params & params);
 
+template<class PatternType>
+double comm_volume_mb(
+  const std::string      & variant,
+  const benchmark_params & params,
+  const PatternType      & pattern);
+
 void perform_test(
   const std::string      & variant,
   extent_t                 n,
@@ -353,7 +365,8 @@ void perform_test(
            << setw(7)  << "repeats" << ", "
            << setw(10) << "gflop/s" << ", "
            << setw(11) << "init.s"  << ", "
-           << setw(11) << "mmult.s"
+           << setw(11) << "mmult.s" << ", "
+           << setw(9)  << "comm.mb"
            << endl;
     }
     int mem_total_mb = 0;
@@ -404,15 +417,22 @@ void perform_test(
   std::pair<double, double> t_mmult;
   if (variant == "mkl" || variant == "blas") {
     t_mmult = test_blas(n, num_repeats, params);
+  } else if (variant == "gemm") {
+    t_mmult = test_gemm(n, num_repeats, params);
   } else if (variant == "plasma") {
     t_mmult = test_plasma(n, num_repeats, params, tilesize);
   } else if (variant == "pblas") {
     t_mmult = test_pblas(n, num_repeats, params);
   } else {
+    // Variant "dash-gemm" uses the built-in GEMM kernel for local block
+    // multiplication in dash::summa even if MKL or BLAS is available:
+    dash::util::Config::set("DASH_SUMMA_BUILTIN_GEMM",
+                            variant == "dash-gemm");
     t_mmult = test_dash(n, num_repeats, params, pattern);
   }
   double t_init = t_mmult.first;
   double t_mult = t_mmult.second;
+  double comm_mb = comm_volume_mb(variant, params, pattern);
 
   if (myid == 0) {
     double s_mult = 1.0e-6 * t_mult;
@@ -420,7 +440,8 @@ void perform_test(
     double gflops = (gflop * num_repeats) / s_mult;
     cout << setw(10) << std::fixed << std::setprecision(4) << gflops << ", "
          << setw(11) << std::fixed << std::setprecision(4) << s_init << ", "
-         << setw(11) << std::fixed << std::setprecision(4) << s_mult
+         << setw(11) << std::fixed << std::setprecision(4) << s_mult << ", "
+         << setw(9)  << std::fixed << std::setprecision(2) << comm_mb
          << endl;
   }
 
@@ -526,7 +547,11 @@ std::pair<double, double> test_dash(
       dash::util::TraceStore::on();
     }
 
-    dash::summa(matrix_a, matrix_b, matrix_c);
+    if (params.variant == "dash-25d") {
+      dash::summa_25d(matrix_a, matrix_b, matrix_c, params.replication);
+    } else {
+      dash::summa(matrix_a, matrix_b, matrix_c);
+    }
 
     if (i == 0) {
       dash::util::TraceStore::off();
@@ -681,6 +706,137 @@ std::pair<double, double> test_blas(
 #endif
 }
 
+/**
+ * Returns the maximum volume of blocks in MB transferred from or to other
+ * units by a single unit in one multiplication.
+ */
+template<class PatternType>
+double comm_volume_mb(
+  const std::string      & variant,
+  const benchmark_params & params,
+  const PatternType      & pattern)
+{
+  typedef std::array<index_t, 2> coords_t;
+
+  if (variant.find("dash") != 0) {
+    return 0;
+  }
+  auto     myid      = dash::myid().id;
+  extent_t bs_rows   = pattern.blocksize(0);
+  extent_t bs_cols   = pattern.blocksize(1);
+  extent_t nb_rows   = pattern.extent(0) / bs_rows;
+  extent_t nb_cols   = pattern.extent(1) / bs_cols;
+  auto     is_remote = [&](extent_t bi, extent_t bj) {
+                         coords_t g_coords {{
+                           static_cast<index_t>(bi * bs_rows),
+                           static_cast<index_t>(bj * bs_cols) }};
+                         return pattern.unit_at(g_coords).id != myid;
+                       };
+  uint64_t num_blocks = 0;
+  if (variant == "dash-25d") {
+    auto plan = dash::internal::summa_25d_make_plan(
+                  nb_rows, nb_cols, nb_cols, myid, dash::size(),
+                  params.replication);
+    uint64_t tile_blocks = (plan.a_k_end - plan.a_k_begin) *
+                           plan.num_rows() +
+                           (plan.b_k_end - plan.b_k_begin) *
+                           plan.num_cols();
+    if (plan.layer == 0) {
+      // Tiles of A and B loaded in the first layer:
+      for (auto k = plan.a_k_begin; k < plan.a_k_end; ++k) {
+        for (auto i = plan.row_begin; i < plan.row_end; ++i) {
+          num_blocks += is_remote(i, k);
+        }
+      }
+      for (auto k = plan.b_k_begin; k < plan.b_k_end; ++k) {
+        for (auto j = plan.col_begin; j < plan.col_end; ++j) {
+          num_blocks += is_remote(k, j);
+        }
+      }
+      // Results stored in C:
+      for (auto i = plan.row_begin; i < plan.row_end; ++i) {
+        for (auto j = plan.col_begin; j < plan.col_end; ++j) {
+          num_blocks += is_remote(i, j);
+        }
+      }
+    }
+    if (plan.num_layers > 1) {
+      // Tiles broadcast and partial results reduced along the fiber:
+      num_blocks += tile_blocks + plan.num_rows() * plan.num_cols();
+    }
+    // Panels broadcast in grid rows and columns:
+    for (auto k = plan.k_begin; k < plan.k_end; ++k) {
+      if (plan.grid_cols > 1) {
+        num_blocks += plan.num_rows();
+      }
+      if (plan.grid_rows > 1) {
+        num_blocks += plan.num_cols();
+      }
+    }
+  } else {
+    // Every unit fetches a row of blocks in A and a column of blocks in B
+    // for every local block in C:
+    for (extent_t lb = 0; lb < pattern.local_blockspec().size(); ++lb) {
+      auto l_block  = pattern.local_block(lb);
+      extent_t bi   = l_block.offset(0) / bs_rows;
+      extent_t bj   = l_block.offset(1) / bs_cols;
+      for (extent_t k = 0; k < nb_cols; ++k) {
+        num_blocks += is_remote(bi, k);
+        num_blocks += is_remote(k, bj);
+      }
+    }
+  }
+  double   l_mb = static_cast<double>(num_blocks * bs_rows * bs_cols *
+                                      sizeof(value_t)) / (1024 * 1024);
+  double   g_mb = 0;
+  dart_allreduce(&l_mb, &g_mb, 1, DART_TYPE_DOUBLE, DART_OP_MAX,
+                 dash::Team::All().dart_id());
+  return g_mb;
+}
+
+/**
+ * Returns pair of durations (init_secs, multiply_secs).
+ *
+ * Local matrix multiplication using the built-in GEMM kernel of
+ * \c dash::summa.
+ */
+std::pair<double, double> test_gemm(
+  extent_t sb,
+  unsigned repeat,
+  const benchmark_params & params)
+{
+  std::pair<double, double> time;
+
+  if (dash::size() != 1) {
+    time.first  = 0;
+    time.second = 0;
+    return time;
+  }
+
+  // Create local copy of matrices:
+  std::vector<value_t> l_matrix_a(sb * sb);
+  std::vector<value_t> l_matrix_b(sb * sb);
+  std::vector<value_t> l_matrix_c(sb * sb);
+
+  auto ts_init_start = Timer::Now();
+  init_values(l_matrix_a.data(), l_matrix_b.data(), l_matrix_c.data(),
+              sb, params);
+  time.first = Timer::ElapsedSince(ts_init_start);
+
+  auto ts_multiply_start = Timer::Now();
+  for (unsigned i = 0; i < repeat; ++i) {
+    dash::internal::gemm<value_t>(
+        l_matrix_a.data(),
+        l_matrix_b.data(),
+        l_matrix_c.data(),
+        sb, sb, sb,
+        dash::ROW_MAJOR);
+  }
+  time.second = Timer::ElapsedSince(ts_multiply_start);
+
+  return time;
+}
+
 /**
  * Returns pair of durations (init_secs, multiply_secs).
  *
@@ -1060,6 +1216,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.cpu_gflops_peak    = 41.4;
   params.mkl_dyn            = false;
   params.verify             = false;
+  params.replication        = 2;
 
   extent_t size_base        = 0;
   extent_t num_units_inc    = 0;
@@ -1093,6 +1250,8 @@ benchmark_params parse_args(int argc, char * argv[])
       params.cpu_gflops_peak = static_cast<float>(atof(argv[i+1]));
     } else if (flag == "-mkldyn") {
       params.mkl_dyn  = atoi(argv[i+1]) == 1;
+    } else if (flag == "-c") {
+      params.replication = static_cast<unsigned>(atoi(argv[i+1]));
     } else if (flag == "-verify") {
       params.verify   = atoi(argv[i+1]) == 1;
     } else if (flag == "-tb") {
@@ -1173,6 +1332,7 @@ void print_params(
   conf.print_param("-nt",     "threads/proc",       params.threads);
   conf.print_param("-mkldyn", "MKL dynamic",        params.mkl_dyn);
   conf.print_param("-verify", "run test iteration", params.verify);
+  conf.print_param("-c",      "2.5D replication",   params.replication);
   conf.print_param("-ninc",   "units inc.",         params.units_inc);
   conf.print_param("-nmax",   "max. units",         params.units_max);
   conf.print_section_end();
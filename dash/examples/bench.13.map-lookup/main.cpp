@@ -0,0 +1,231 @@
+/**
+ * Measures the throughput of key lookups in dash::UnorderedMap for keys
+ * in local and in remote memory.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef long                                         map_key_t;
+typedef long                                         map_mapped_t;
+typedef dash::UnorderedMap<map_key_t, map_mapped_t>  map_t;
+
+typedef struct benchmark_params_t {
+  long   size_base;
+  long   num_lookups;
+  int    num_iterations;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  long        local_size;
+  double      time_insert_s;
+  double      time_lookup_s;
+  double      mlookups_per_s;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              long             local_size,
+              std::string      testcase,
+              benchmark_params params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.13.map-lookup");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  std::array<std::string, 3> testcases {{
+                               "map.local.find",
+                               "map.find.remote",
+                               "map.find_many.remote" }};
+
+  long local_size = params.size_base;
+  for (int i = 0; i < params.num_iterations; ++i, local_size *= 4) {
+    for (auto testcase : testcases) {
+      auto res = evaluate(local_size, testcase, params);
+      print_measurement_record(res, params);
+    }
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(
+  long             local_size,
+  std::string      testcase,
+  benchmark_params params)
+{
+  measurement mes;
+  auto myid   = dash::myid().id;
+  auto nunits = dash::size();
+  // Lookups target keys inserted by the next unit:
+  auto target = (testcase == "map.local.find")
+                ? myid
+                : (myid + 1) % nunits;
+
+  map_t map(local_size * nunits);
+
+  auto ts_insert_start = Timer::Now();
+  if (testcase == "map.find_many.remote") {
+    std::vector<std::pair<map_key_t, map_mapped_t>> values;
+    for (long i = 0; i < local_size; ++i) {
+      values.push_back(std::make_pair(myid * local_size + i, i));
+    }
+    map.insert_many(values.begin(), values.end());
+  } else {
+    for (long i = 0; i < local_size; ++i) {
+      map_key_t key = myid * local_size + i;
+      map.insert(std::make_pair(key, static_cast<map_mapped_t>(i)));
+    }
+  }
+  map.barrier();
+  mes.time_insert_s = Timer::ElapsedSince(ts_insert_start) / (1000 * 1000);
+
+  // Pseudo-random sequence of keys to look up:
+  std::vector<map_key_t> keys(params.num_lookups);
+  long offs = 0;
+  for (auto & key : keys) {
+    offs = (offs * 1103515245 + 12345) & 0x7fffffff;
+    key  = target * local_size + (offs % local_size);
+  }
+
+  long found          = 0;
+  auto ts_lookup_start = Timer::Now();
+  if (testcase == "map.local.find") {
+    for (auto key : keys) {
+      found += map.local.count(key);
+    }
+  } else if (testcase == "map.find.remote") {
+    for (auto key : keys) {
+      found += map.count(key);
+    }
+  } else {
+    std::vector<map_t::iterator> elements(keys.size());
+    map.find_many(keys.begin(), keys.end(), elements.begin());
+    for (auto element : elements) {
+      found += (element != map.end());
+    }
+  }
+  mes.time_lookup_s = Timer::ElapsedSince(ts_lookup_start) / (1000 * 1000);
+  dash::barrier();
+
+  if (found != params.num_lookups) {
+    std::cerr << "Verification failed: found " << found << " of "
+              << params.num_lookups << " keys" << endl;
+  }
+
+  mes.testcase       = testcase;
+  mes.local_size     = local_size;
+  mes.mlookups_per_s = params.num_lookups / mes.time_lookup_s / 1.0e6;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "l.size"     << ","
+         << std::setw(20) << "impl"       << ","
+         << std::setw(10) << "insert.s"   << ","
+         << std::setw(10) << "lookup.s"   << ","
+         << std::setw(12) << "mlookups/s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5)  << dash::size()   << ","
+         << std::setw(9)  << mpi_impl       << ","
+         << std::setw(12) << mes.local_size << ","
+         << std::setw(20) << mes.testcase   << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_insert_s  << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_lookup_s  << ","
+         << std::fixed << setprecision(4) << setw(12) << mes.mlookups_per_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base      = 1024;
+  params.num_lookups    = 10000;
+  params.num_iterations = 4;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base      = atol(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.num_lookups    = atol(argv[i+1]);
+    }
+    if (flag == "-i") {
+      params.num_iterations = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-sb", "initial local map size", params.size_base);
+  bench_cfg.print_param("-n",  "lookups per unit",       params.num_lookups);
+  bench_cfg.print_param("-i",  "iterations",             params.num_iterations);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,222 @@
+/**
+ * Measures strong and weak scaling of dash::sort.
+ *
+ * Strong scaling: the total number of keys is fixed (-s), run with
+ * varying number of units.
+ * Weak scaling: the number of keys per unit is fixed (-l).
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <functional>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct benchmark_params_t {
+  long   size_total;
+  long   size_local;
+  int    num_repeats;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  std::string key_type;
+  long        size_total;
+  double      time_sort_s;
+  double      mkeys_per_s;
+  bool        verified;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+template <class KeyType, class Compare>
+measurement evaluate(
+              long             size_total,
+              std::string      testcase,
+              std::string      key_type,
+              Compare          comp,
+              benchmark_params params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.14.sort");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  std::array<std::string, 2> testcases {{
+                               "strong",
+                               "weak" }};
+
+  for (auto testcase : testcases) {
+    long size_total = (testcase == "strong")
+                      ? params.size_total
+                      : params.size_local * dash::size();
+    // Integral keys, sorted by radix sort locally:
+    print_measurement_record(
+      evaluate<long>(size_total, testcase, "long",
+                     std::less<long>(), params),
+      params);
+    // Floating point keys, sorted by comparison sort locally:
+    print_measurement_record(
+      evaluate<double>(size_total, testcase, "double",
+                       std::less<double>(), params),
+      params);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+template <class KeyType, class Compare>
+measurement evaluate(
+  long             size_total,
+  std::string      testcase,
+  std::string      key_type,
+  Compare          comp,
+  benchmark_params params)
+{
+  measurement mes;
+  mes.testcase   = testcase;
+  mes.key_type   = key_type;
+  mes.size_total = size_total;
+  mes.verified   = true;
+
+  dash::Array<KeyType> keys(size_total, dash::BLOCKED);
+
+  double time_total_s = 0;
+  for (int r = 0; r < params.num_repeats; ++r) {
+    std::mt19937_64 rng(dash::myid().id * 7919 + r);
+    std::uniform_int_distribution<long> dist(
+                                          std::numeric_limits<int>::min(),
+                                          std::numeric_limits<int>::max());
+    for (auto & key : keys.local) {
+      key = static_cast<KeyType>(dist(rng));
+    }
+    keys.barrier();
+
+    auto ts_sort_start = Timer::Now();
+    dash::sort(keys.begin(), keys.end(), comp);
+    time_total_s += Timer::ElapsedSince(ts_sort_start) / (1000 * 1000);
+
+    // Local portions are sorted and ordered across unit boundaries:
+    mes.verified &= std::is_sorted(keys.lbegin(), keys.lend(), comp);
+    auto g_lend = keys.pattern().global(0) + keys.lsize();
+    if (keys.lsize() > 0 && g_lend < size_total) {
+      KeyType next_first = keys[g_lend];
+      mes.verified &= !comp(next_first, *(keys.lend() - 1));
+    }
+    keys.barrier();
+  }
+  mes.time_sort_s = time_total_s / params.num_repeats;
+  mes.mkeys_per_s = size_total / mes.time_sort_s / 1.0e6;
+  if (!mes.verified) {
+    std::cerr << "Verification failed at unit " << dash::myid() << endl;
+  }
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw( 8) << "scaling"    << ","
+         << std::setw( 8) << "key"        << ","
+         << std::setw(12) << "size"       << ","
+         << std::setw(12) << "l.size"     << ","
+         << std::setw(10) << "sort.s"     << ","
+         << std::setw(10) << "mkeys/s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5)  << dash::size()   << ","
+         << std::setw(9)  << mpi_impl       << ","
+         << std::setw(8)  << mes.testcase   << ","
+         << std::setw(8)  << mes.key_type   << ","
+         << std::setw(12) << mes.size_total << ","
+         << std::setw(12) << mes.size_total / dash::size() << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_sort_s << ","
+         << std::fixed << setprecision(2) << setw(10) << mes.mkeys_per_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_total  = 1 << 24;
+  params.size_local  = 1 << 22;
+  params.num_repeats = 3;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-s") {
+      params.size_total  = atol(argv[i+1]);
+    }
+    if (flag == "-l") {
+      params.size_local  = atol(argv[i+1]);
+    }
+    if (flag == "-r") {
+      params.num_repeats = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-s", "total keys (strong scaling)",  params.size_total);
+  bench_cfg.print_param("-l", "keys per unit (weak scaling)", params.size_local);
+  bench_cfg.print_param("-r", "repetitions",                  params.num_repeats);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,220 @@
+/**
+ * Measures the performance of temporal blocking for the heat equation
+ * example: the halo width is k times the stencil radius and k time steps
+ * are computed per halo exchange, for k = 1 .. 8.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <numeric>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+using pattern_t      = dash::Pattern<2>;
+using matrix_t       = dash::Matrix<
+                         double, 2,
+                         typename pattern_t::index_type,
+                         pattern_t>;
+using StencilT       = dash::halo::StencilPoint<2>;
+using StencilSpecT   = dash::halo::StencilSpec<StencilT, 4>;
+using GlobBoundSpecT = dash::halo::GlobalBoundarySpec<2>;
+using BlockingT      = dash::halo::TemporalBlocking<matrix_t, StencilSpecT>;
+
+typedef struct benchmark_params_t {
+  long   size;
+  int    steps;
+  int    max_depth;
+  bool   push;
+} benchmark_params;
+
+typedef struct measurement_t {
+  int    depth;
+  long   exchanges;
+  double time_s;
+  double mlups;
+  double energy;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(
+  const measurement        & mes,
+  const benchmark_params   & params);
+
+measurement evaluate(int depth, const benchmark_params & params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.15.heat-temporal");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  for (int depth = 1; depth <= params.max_depth; ++depth) {
+    auto mes = evaluate(depth, params);
+    print_measurement_record(mes, params);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(int depth, const benchmark_params & params)
+{
+  measurement mes;
+  mes.depth     = depth;
+  mes.exchanges = (params.steps + depth - 1) / depth;
+
+  dash::DistributionSpec<2> dist(dash::BLOCKED, dash::BLOCKED);
+  dash::TeamSpec<2>         tspec(dash::size(), 1);
+  tspec.balance_extents();
+  pattern_t pattern(dash::SizeSpec<2>(params.size, params.size), dist, tspec,
+                    dash::Team::All());
+  matrix_t matrix(pattern);
+
+  std::fill(matrix.lbegin(), matrix.lend(),
+            (dash::myid() == 0) ? 1.0 : 0.0);
+  matrix.barrier();
+
+  StencilSpecT stencil_spec(
+    StencilT(-1, 0), StencilT(1, 0), StencilT(0, -1), StencilT(0, 1));
+  GlobBoundSpecT bound_spec(dash::halo::BoundaryProp::CYCLIC,
+                            dash::halo::BoundaryProp::CYCLIC);
+  BlockingT blocking(matrix, bound_spec, stencil_spec, depth,
+                     params.push ? dash::halo::HaloExchange::PUSH
+                                 : dash::halo::HaloExchange::PULL);
+
+  const double dx = 1.0;
+  const double dy = 1.0;
+  const double dt = 0.05;
+  const double k  = 1.0;
+  auto heat = [=](const double & core, const std::array<double, 4> & v) {
+    double dtheta = (v[0] + v[1] - 2 * core) / (dx * dx) +
+                    (v[2] + v[3] - 2 * core) / (dy * dy);
+    return core + k * dtheta * dt;
+  };
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  blocking.run(heat, params.steps);
+  dash::barrier();
+  mes.time_s = Timer::ElapsedSince(ts_start) / (1000 * 1000);
+  mes.mlups  = static_cast<double>(params.size) * params.size *
+               params.steps / mes.time_s / (1000 * 1000);
+
+  // total energy is preserved with cyclic boundaries
+  double l_energy = std::accumulate(matrix.lbegin(), matrix.lend(), 0.0);
+  mes.energy = 0;
+  dart_allreduce(&l_energy, &mes.energy, 1, DART_TYPE_DOUBLE, DART_OP_SUM,
+                 dash::Team::All().dart_id());
+
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"     << ","
+         << std::setw( 9) << "mpi.impl"  << ","
+         << std::setw( 8) << "size"      << ","
+         << std::setw( 7) << "steps"     << ","
+         << std::setw( 5) << "k"         << ","
+         << std::setw(10) << "exchanges" << ","
+         << std::setw(10) << "time.s"    << ","
+         << std::setw(10) << "mlups"     << ","
+         << std::setw(12) << "energy"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const measurement        & mes,
+  const benchmark_params   & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    cout << std::right
+         << std::setw( 5) << dash::size()   << ","
+         << std::setw( 9) << mpi_impl       << ","
+         << std::setw( 8) << params.size    << ","
+         << std::setw( 7) << params.steps   << ","
+         << std::setw( 5) << mes.depth      << ","
+         << std::setw(10) << mes.exchanges  << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_s << ","
+         << std::fixed << setprecision(2) << setw(10) << mes.mlups  << ","
+         << std::fixed << setprecision(4) << setw(12) << mes.energy
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size      = 1024;
+  params.steps     = 64;
+  params.max_depth = 8;
+  params.push      = false;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-n") {
+      params.size      = atol(argv[i+1]);
+    }
+    if (flag == "-s") {
+      params.steps     = atoi(argv[i+1]);
+    }
+    if (flag == "-k") {
+      params.max_depth = atoi(argv[i+1]);
+    }
+    if (flag == "-push") {
+      params.push      = atoi(argv[i+1]) != 0;
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-n",    "matrix extent per dimension", params.size);
+  bench_cfg.print_param("-s",    "time steps",                  params.steps);
+  bench_cfg.print_param("-k",    "max. time steps per exchange",
+                        params.max_depth);
+  bench_cfg.print_param("-push", "push-based halo exchange",    params.push);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,89 @@
+/**
+ * \example ex.12.event-trace/main.cpp
+ * Records an event trace of DASH algorithms and DART operations and
+ * merges the trace files of all units to the Chrome trace format.
+ *
+ * Record, one trace file per unit in the given directory:
+ *
+ *   mpirun -n 4 ./ex.12.event-trace.mpi /tmp
+ *
+ * Merge offline, the result can be opened in chrome://tracing:
+ *
+ *   ./ex.12.event-trace.mpi -merge trace.json /tmp/u000*.events.bin
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+using std::cout;
+using std::cerr;
+using std::endl;
+
+int merge(int argc, char * argv[])
+{
+  if (argc < 4) {
+    cerr << "usage: " << argv[0]
+         << " -merge <output.json> <trace file> ..." << endl;
+    return 1;
+  }
+  std::vector<std::string> trace_files(argv + 3, argv + argc);
+  std::ofstream out(argv[2]);
+  auto num_events = dash::util::EventTrace::merge_chrome_trace(
+                      trace_files, out);
+  cout << "merged " << num_events << " events of "
+       << trace_files.size() << " units to " << argv[2] << endl;
+  return 0;
+}
+
+int main(int argc, char * argv[])
+{
+  if (argc > 1 && std::string(argv[1]) == "-merge") {
+    // Offline merge does not require the DASH runtime:
+    return merge(argc, argv);
+  }
+
+  dash::init(&argc, &argv);
+
+  std::string path = (argc > 1) ? argv[1] : ".";
+  // Tracing might have been started in dash::init already if
+  // DASH_EVENT_TRACE_PATH is set:
+  dash::util::EventTrace::start(path);
+
+  const size_t nelem = 100000 * dash::size();
+  dash::Array<int> array(nelem);
+  {
+    DASH_EVENT_TRACE_SCOPE("init");
+    std::iota(array.lbegin(), array.lend(),
+              static_cast<int>(dash::myid() * array.lsize()));
+    array.barrier();
+  }
+
+  dash::transform(array.begin(), array.end(), array.begin(),
+                  array.begin(), dash::plus<int>());
+  array.barrier();
+
+  std::vector<int> copy(nelem);
+  dash::copy(array.begin(), array.end(), copy.data());
+
+  dash::sort(array.begin(), array.end(), std::greater<int>());
+
+  std::string trace_file = dash::util::EventTrace::filename();
+  dash::util::EventTrace::stop();
+  dash::barrier();
+
+  if (dash::myid() == 0 && !trace_file.empty()) {
+    cout << "trace files written, merge with:" << endl
+         << "  " << argv[0] << " -merge trace.json "
+         << path << "/u*.events.bin" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
@@ -0,0 +1,307 @@
+#ifndef DASH__AGGREGATOR_H__INCLUDED
+#define DASH__AGGREGATOR_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/algorithm/Operation.h>
+
+#include <dash/util/EventTrace.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Aggregates fine-grained element-wise updates of a global container
+ * into batches per target unit.
+ *
+ * Instead of issuing a single atomic operation and a flush per element
+ * like \c dash::GlobRef::operator+=, updates are buffered per target unit
+ * and shipped as a single \c dart_accumulate_indexed once the buffer of
+ * the target unit is full, on \c flush or when the aggregator is
+ * destroyed. Updates of the same element within a batch are combined
+ * locally using the reduce operation.
+ *
+ * The buffer capacity per unit trades latency for throughput: updates
+ * are not visible to other units before their batch has been shipped and
+ * completed by \c flush, followed by a synchronization like
+ * \c dash::barrier.
+ * Buffers are preallocated, an aggregator allocates
+ * <tt>capacity * team.size()</tt> elements of value and offset type in
+ * two buffers each.
+ *
+ * Updates are atomic with respect to updates of the same reduce
+ * operation from other units, also for elements local to the calling
+ * unit. Results of single updates (as in \c fetch_op) are not available.
+ * Not thread-safe.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<uint64_t> table(size);
+ *   {
+ *     dash::Aggregator<decltype(table), dash::bit_xor<uint64_t>>
+ *       agg(table, 1024);
+ *     for (auto i : random_indices) {
+ *       agg.update(i, value);
+ *     }
+ *   } // remaining updates are shipped and completed
+ *   table.barrier();
+ * \endcode
+ *
+ * \tparam ContainerType  Type of the global container, its pattern must
+ *                        support \c local(index).
+ * \tparam BinaryOp       Reduce operation applied to updated elements,
+ *                        see \ref DashReduceOperations.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ContainerType,
+  class BinaryOp = dash::plus<typename ContainerType::value_type> >
+class Aggregator
+{
+private:
+  typedef Aggregator<ContainerType, BinaryOp>          self_t;
+
+public:
+  typedef typename ContainerType::value_type            value_type;
+  typedef typename ContainerType::index_type            index_type;
+  typedef typename ContainerType::size_type             size_type;
+  typedef typename ContainerType::pattern_type          pattern_type;
+  typedef BinaryOp                                      op_type;
+
+  /// Default number of buffered updates per target unit
+  static constexpr size_type DefaultCapacity = 1024;
+
+private:
+  static_assert(
+    dash::dart_datatype<value_type>::value != DART_TYPE_UNDEFINED,
+    "dash::Aggregator requires a value type with a DART basic type");
+  static_assert(
+    dash::internal::has_dart_operation<BinaryOp>::value,
+    "dash::Aggregator requires a reduce operation mapping to a DART "
+    "operation");
+
+  /**
+   * Element update staged in a unit buffer.
+   */
+  struct update_t {
+    std::uint64_t offset;
+    value_type    value;
+  };
+
+  /**
+   * Buffers of updates to a single target unit.
+   */
+  struct unit_buffer {
+    /// Updates not shipped yet
+    std::vector<update_t>      staged;
+    /// Element offsets of the batch in flight
+    std::vector<std::uint64_t> offsets;
+    /// Values of the batch in flight
+    std::vector<value_type>    values;
+    /// Whether a batch is in flight and the send buffers are not
+    /// locally completed
+    bool                       pending = false;
+  };
+
+public:
+  /**
+   * Creates an aggregator of updates of elements in \c container.
+   * Not a collective operation.
+   */
+  explicit Aggregator(
+    ContainerType & container,
+    size_type       capacity = DefaultCapacity,
+    op_type         op       = op_type())
+  : _pattern(&container.pattern()),
+    _capacity(std::max<size_type>(capacity, 1)),
+    _op(op),
+    _gptrs(container.pattern().team().size()),
+    _buffers(container.pattern().team().size())
+  {
+    DASH_LOG_DEBUG("Aggregator()", "capacity:", _capacity,
+                   "units:", _buffers.size());
+    auto & globmem = container.begin().globmem();
+    for (size_type u = 0; u < _buffers.size(); ++u) {
+      _gptrs[u] = globmem.at(dash::team_unit_t(u), 0).dart_gptr();
+      _buffers[u].staged.reserve(_capacity);
+      _buffers[u].offsets.resize(_capacity);
+      _buffers[u].values.resize(_capacity);
+    }
+  }
+
+  /**
+   * Ships all remaining updates and waits for their completion.
+   * Failures are logged as destructors must not throw.
+   */
+  ~Aggregator()
+  {
+    try {
+      flush();
+    } catch (const std::exception & excep) {
+      DASH_LOG_ERROR("Aggregator.~Aggregator()", "flush failed:",
+                     excep.what());
+    } catch (...) {
+      DASH_LOG_ERROR("Aggregator.~Aggregator()", "flush failed");
+    }
+  }
+
+  Aggregator(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)    = delete;
+
+  /**
+   * Applies the reduce operation on the element at global index
+   * \c g_index and \c value.
+   */
+  void update(index_type g_index, const value_type & value)
+  {
+    auto l_pos  = _pattern->local(g_index);
+    auto & buf  = _buffers[l_pos.unit.id];
+    buf.staged.push_back(
+      update_t { static_cast<std::uint64_t>(l_pos.index), value });
+    ++_num_updates;
+    if (buf.staged.size() >= _capacity) {
+      ship(l_pos.unit);
+    }
+  }
+
+  /**
+   * Same as \c update.
+   */
+  void operator()(index_type g_index, const value_type & value)
+  {
+    update(g_index, value);
+  }
+
+  /**
+   * Ships updates to all units and waits for their completion.
+   * Updates are visible to other units after a subsequent
+   * synchronization like \c dash::barrier.
+   * Not a collective operation.
+   */
+  void flush()
+  {
+    DASH_EVENT_TRACE_SCOPE("dash::Aggregator::flush");
+    bool shipped = false;
+    for (size_type u = 0; u < _buffers.size(); ++u) {
+      if (!_buffers[u].staged.empty()) {
+        ship(dash::team_unit_t(u));
+      }
+      if (_buffers[u].pending) {
+        _buffers[u].pending = false;
+        shipped = true;
+      }
+    }
+    if (shipped) {
+      DASH_ASSERT_RETURNS(
+        dart_flush_all(_gptrs[0]),
+        DART_OK);
+    }
+  }
+
+  /**
+   * Maximum number of buffered updates per unit.
+   */
+  constexpr size_type capacity() const noexcept {
+    return _capacity;
+  }
+
+  /**
+   * Number of element updates passed to the aggregator.
+   */
+  constexpr size_type num_updates() const noexcept {
+    return _num_updates;
+  }
+
+  /**
+   * Number of batches shipped to target units.
+   */
+  constexpr size_type num_batches() const noexcept {
+    return _num_batches;
+  }
+
+  /**
+   * Number of elements updated remotely after combining updates of the
+   * same element.
+   */
+  constexpr size_type num_shipped() const noexcept {
+    return _num_shipped;
+  }
+
+private:
+  /**
+   * Combines the staged updates to the given unit and issues them in
+   * a single accumulate operation.
+   */
+  void ship(dash::team_unit_t unit)
+  {
+    auto & buf = _buffers[unit.id];
+    if (buf.pending) {
+      // send buffers of the previous batch must not be modified before
+      // its local completion:
+      DASH_ASSERT_RETURNS(
+        dart_flush_local(_gptrs[unit.id]),
+        DART_OK);
+      buf.pending = false;
+    }
+    std::sort(buf.staged.begin(), buf.staged.end(),
+              [](const update_t & a, const update_t & b) {
+                return a.offset < b.offset;
+              });
+    size_type nelem = 0;
+    for (const auto & upd : buf.staged) {
+      if (nelem > 0 && buf.offsets[nelem-1] == upd.offset) {
+        buf.values[nelem-1] = _op(buf.values[nelem-1], upd.value);
+        continue;
+      }
+      buf.offsets[nelem] = upd.offset;
+      buf.values[nelem]  = upd.value;
+      ++nelem;
+    }
+    buf.staged.clear();
+    DASH_LOG_TRACE("Aggregator.ship", "unit:", unit, "nelem:", nelem);
+    DASH_ASSERT_RETURNS(
+      dart_accumulate_indexed(
+        _gptrs[unit.id],
+        buf.values.data(),
+        buf.offsets.data(),
+        nelem,
+        dash::dart_datatype<value_type>::value,
+        _op.dart_operation()),
+      DART_OK);
+    buf.pending   = true;
+    _num_shipped += nelem;
+    ++_num_batches;
+  }
+
+private:
+  const pattern_type       * _pattern;
+  size_type                  _capacity;
+  op_type                    _op;
+  std::vector<dart_gptr_t>   _gptrs;
+  std::vector<unit_buffer>   _buffers;
+  size_type                  _num_updates = 0;
+  size_type                  _num_batches = 0;
+  size_type                  _num_shipped = 0;
+};
+
+template <class ContainerType, class BinaryOp>
+constexpr typename Aggregator<ContainerType, BinaryOp>::size_type
+Aggregator<ContainerType, BinaryOp>::DefaultCapacity;
+
+} // namespace dash
+
+#endif // DASH__AGGREGATOR_H__INCLUDED
@@ -16,7 +16,10 @@
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
+#include <dash/algorithm/Reduce.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/Sort.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
@@ -24,7 +27,9 @@
 #include <dash/algorithm/AnyOf.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Redistribute.h>
 
 #include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/SUMMA25D.h>
 
 #endif // DASH__ALGORITHM_H_
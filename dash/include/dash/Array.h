@@ -17,8 +17,11 @@
 
 #include <dash/iterator/GlobIter.h>
 
+#include <dash/internal/WriteCombineBuffer.h>
+
 #include <iterator>
 #include <initializer_list>
+#include <memory>
 #include <type_traits>
 
 
@@ -297,8 +300,14 @@ public:
     return 1;
   }
 
+private:
+  typedef dash::internal::WriteCombineBuffer<T>
+    write_combine_buffer;
+
 private:
   Array<T, IndexType, PatternType> * _array;
+  /// Queue of combined writes if write-combining is enabled
+  std::shared_ptr<write_combine_buffer> _wcbuf;
 
 public:
   /**
@@ -309,6 +318,19 @@ public:
   : _array(array) {
   }
 
+  /**
+   * Constructor, creates an asynchronous access proxy for the given array
+   * that takes over the queue of combined writes of \c other.
+   * Used when moving arrays, queued writes are completed by the new
+   * owner of the array memory.
+   */
+  AsyncArrayRef(
+    Array<T, IndexType, PatternType> * const array,
+    self_t                                && other)
+  : _array(array),
+    _wcbuf(std::move(other._wcbuf)) {
+  }
+
   AsyncArrayRef(const self_t &) = default;
   AsyncArrayRef(self_t &&)      = default;
 
@@ -371,8 +393,74 @@ public:
    * Subscript operator, access to local array element at given position.
    */
   async_reference operator[](const size_type n) {
-    return async_reference(
-             (*(_array->begin() + n)).dart_gptr());
+    return make_async_reference(
+             (*(_array->begin() + n)).dart_gptr(),
+             std::is_constructible<
+               async_reference, dart_gptr_t,
+               const std::shared_ptr<write_combine_buffer> &>());
+  }
+
+private:
+  async_reference make_async_reference(
+    dart_gptr_t gptr, std::true_type /* supports write-combining */) {
+    return async_reference(gptr, _wcbuf);
+  }
+
+  async_reference make_async_reference(
+    dart_gptr_t gptr, std::false_type /* supports write-combining */) {
+    return async_reference(gptr);
+  }
+
+public:
+  /**
+   * Enable or disable write-combining of asynchronous writes.
+   *
+   * If enabled, writes to array elements are queued per target unit
+   * instead of being transferred individually. Queued writes to a unit
+   * are merged to contiguous or indexed transfers which are issued once
+   * \c capacity writes to the unit are queued or on \c flush.
+   * Reads of elements written before the next \c flush may yield the
+   * previous value.
+   * Queued writes are completed at their targets before write-combining
+   * is disabled or re-enabled.
+   * Has no effect on arrays of atomic elements.
+   *
+   * Asynchronous references obtained before do not keep the previous
+   * buffer of combined writes alive, writes through them are transferred
+   * individually once it is destroyed.
+   *
+   * Not a collective operation.
+   */
+  void write_combining(
+    bool   enable   = true,
+    size_t capacity = write_combine_buffer::DefaultCapacity) {
+    if (_wcbuf) {
+      // Writes issued afterwards are not ordered after the queued writes
+      // unless these are completed at their targets:
+      _wcbuf->commit();
+      _array->m_globmem->flush();
+      _wcbuf->release();
+    }
+    _wcbuf = enable
+             ? std::make_shared<write_combine_buffer>(capacity)
+             : nullptr;
+  }
+
+  /**
+   * Whether asynchronous writes are combined.
+   */
+  inline bool is_write_combining() const noexcept {
+    return static_cast<bool>(_wcbuf);
+  }
+
+  /**
+   * Issue all queued combined writes without waiting for their
+   * completion.
+   */
+  inline void commit() const {
+    if (_wcbuf) {
+      _wcbuf->commit();
+    }
   }
 
   /**
@@ -380,8 +468,12 @@ public:
    * on all units.
    */
   inline void flush() const {
+    commit();
     // could also call _array->flush();
     _array->m_globmem->flush();
+    if (_wcbuf) {
+      _wcbuf->release();
+    }
   }
 
   /**
@@ -389,8 +481,12 @@ public:
    * to the specified unit.
    */
   inline void flush(dash::team_unit_t target) const {
+    commit();
     // could also call _array->flush();
     _array->m_globmem->flush(target);
+    if (_wcbuf) {
+      _wcbuf->release(target.id);
+    }
   }
 
   /**
@@ -398,8 +494,12 @@ public:
    * on all units.
    */
   inline void flush_local() const {
+    commit();
     // could also call _array->flush_local();
     _array->m_globmem->flush_local();
+    if (_wcbuf) {
+      _wcbuf->release_local();
+    }
   }
 
   /**
@@ -407,8 +507,12 @@ public:
    * to the specified unit.
    */
   inline void flush_local(dash::team_unit_t target) const {
+    commit();
     // could also call _array->flush_local();
     _array->m_globmem->flush_local(target);
+    if (_wcbuf) {
+      _wcbuf->release_local(target.id);
+    }
   }
 
 };
@@ -894,7 +998,7 @@ public:
    */
   Array(self_t && other)
   : local(this),
-    async(this),
+    async(this, std::move(other.async)),
     m_team(other.m_team),
     m_myid(other.m_myid),
     m_pattern(std::move(other.m_pattern)),
@@ -961,6 +1065,8 @@ public:
     this->m_pattern   = std::move(other.m_pattern);
     this->m_size      = other.m_size;
     this->m_team      = other.m_team;
+    // Queued combined writes target the moved memory:
+    this->async       = async_type(this, std::move(other.async));
 
     other.m_globmem = nullptr;
     other.m_lbegin  = nullptr;
@@ -1230,7 +1336,7 @@ public:
   {
     DASH_LOG_TRACE_VAR("Array.barrier()", m_team);
     if (nullptr != m_globmem) {
-      m_globmem->flush();
+      async.flush();
     }
     if (nullptr != m_team && *m_team != dash::Team::Null()) {
       m_team->barrier();
@@ -1243,7 +1349,7 @@ public:
    * on the array's underlying global memory.
    */
   inline void flush() const {
-    m_globmem->flush();
+    async.flush();
   }
 
   /**
@@ -1251,7 +1357,7 @@ public:
    * on the array's underlying global memory.
    */
   inline void flush(dash::team_unit_t target) const {
-    m_globmem->flush(target);
+    async.flush(target);
   }
 
   /**
@@ -1259,7 +1365,7 @@ public:
    * the array's underlying global memory.
    */
   inline void flush_local() const {
-    m_globmem->flush_local();
+    async.flush_local();
   }
 
 
@@ -1268,7 +1374,7 @@ public:
    * specified unit on the array's underlying global memory.
    */
   inline void flush_local(dash::team_unit_t target) const {
-    m_globmem->flush_local(target);
+    async.flush_local(target);
   }
 
   /**
@@ -0,0 +1,261 @@
+#ifndef DASH__COLLECTIVE_H__INCLUDED
+#define DASH__COLLECTIVE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Future.h>
+#include <dash/Exception.h>
+
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <dash/internal/Logging.h>
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+
+/**
+ * \defgroup  DashCollectiveConcept  Collective Operations Concept
+ * Non-blocking collective operations on local buffers.
+ *
+ * \ingroup DashConcept
+ * \{
+ * \par Description
+ *
+ * Collective operations on local data that return a \c dash::Future so
+ * that local computation can be overlapped with communication, e.g. a
+ * global residual reduction with halo computation.
+ * Buffers passed to an operation must not be accessed before the future
+ * completed. Destroying a future waits for completion of its operation.
+ *
+ * \par Methods
+ *
+ * Function                    | Semantics
+ * --------------------------- | ------------------------------------------
+ * \c dash::Team::barrier_async | Non-blocking barrier
+ * \c dash::allreduce_async     | Non-blocking all-reduce
+ * \c dash::broadcast_async     | Non-blocking broadcast
+ * \c dash::allgather_async     | Non-blocking all-gather
+ *
+ * \}
+ */
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Future completing with the given result once the non-blocking DART
+ * collective operation referenced by \c handle completed.
+ * The result may depend on buffers owned by the captured \c state.
+ */
+template <typename ResultT, class StateT>
+dash::Future<ResultT> collective_future(
+  std::shared_ptr<dart_handle_t> handle,
+  std::shared_ptr<StateT>        state,
+  std::function<ResultT (void)>  result)
+{
+  return dash::Future<ResultT>(
+    // wait
+    [handle, state, result]() {
+      DASH_ASSERT_RETURNS(dart_wait(handle.get()), DART_OK);
+      return result();
+    },
+    // test
+    [handle, state, result](ResultT * out) {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(dart_test(handle.get(), &flag), DART_OK);
+      if (flag) {
+        *out = result();
+      }
+      return (flag != 0);
+    },
+    // destroy
+    [handle, state]() {
+      // Requests of collective operations cannot be released before
+      // completion:
+      DASH_ASSERT_RETURNS(dart_wait(handle.get()), DART_OK);
+    });
+}
+
+} // namespace internal
+
+/**
+ * Non-blocking reduction of a value of every unit in the team using the
+ * binary operation \c op.
+ *
+ * Collective operation, the result is available at all units in the
+ * team once the returned future completed.
+ * The reduce operation must have an equivalent \c dart_operation_t for the
+ * value type (e.g. \c dash::plus, \c dash::max).
+ *
+ * \ingroup DashCollectiveConcept
+ */
+template <
+  typename ValueType,
+  class    BinaryOperation = dash::plus<ValueType> >
+dash::Future<ValueType> allreduce_async(
+  const ValueType & value,
+  BinaryOperation   op   = BinaryOperation(),
+  dash::Team      & team = dash::Team::All())
+{
+  typedef internal::reduce_dart_operation<BinaryOperation, ValueType>
+    dart_op_t;
+  static_assert(dart_op_t::value != DART_OP_UNDEFINED,
+                "dash::allreduce_async requires a reduce operation with "
+                "DART equivalent");
+  DASH_LOG_TRACE("dash::allreduce_async()");
+  // Send and receive buffers must outlive the returned future:
+  struct state_t { ValueType l_value; ValueType g_value; };
+  auto state  = std::make_shared<state_t>();
+  auto handle = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+  state->l_value = value;
+  DASH_ASSERT_RETURNS(
+    dart_iallreduce(
+      &state->l_value,
+      &state->g_value,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      dart_op_t::value,
+      team.dart_id(),
+      handle.get()),
+    DART_OK);
+  state_t * s = state.get();
+  return internal::collective_future<ValueType>(
+           handle, state,
+           [s]() { return s->g_value; });
+}
+
+/**
+ * Non-blocking element-wise reduction of the values in local range
+ * \c [in_first, in_last) of every unit in the team using the binary
+ * operation \c op.
+ * The result is written to the range starting at \c out_first which may
+ * be identical to \c in_first.
+ *
+ * Collective operation, the reduce operation must have an equivalent
+ * \c dart_operation_t for the value type.
+ *
+ * \return  Future of the iterator past the last element written.
+ *
+ * \ingroup DashCollectiveConcept
+ */
+template <
+  typename ValueType,
+  class    BinaryOperation >
+dash::Future<ValueType *> allreduce_async(
+  const ValueType * in_first,
+  const ValueType * in_last,
+  ValueType       * out_first,
+  BinaryOperation   op,
+  dash::Team      & team = dash::Team::All())
+{
+  typedef internal::reduce_dart_operation<BinaryOperation, ValueType>
+    dart_op_t;
+  static_assert(dart_op_t::value != DART_OP_UNDEFINED,
+                "dash::allreduce_async requires a reduce operation with "
+                "DART equivalent");
+  auto nelem    = std::distance(in_first, in_last);
+  auto out_last = out_first + nelem;
+  DASH_LOG_TRACE("dash::allreduce_async()", "nelem:", nelem);
+  auto handle   = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+  DASH_ASSERT_RETURNS(
+    dart_iallreduce(
+      in_first,
+      out_first,
+      nelem,
+      dash::dart_datatype<ValueType>::value,
+      dart_op_t::value,
+      team.dart_id(),
+      handle.get()),
+    DART_OK);
+  return internal::collective_future<ValueType *>(
+           handle, std::shared_ptr<void>(),
+           [out_last]() { return out_last; });
+}
+
+/**
+ * Non-blocking broadcast of the values in local range \c [first, last)
+ * of unit \c root to all units in the team.
+ *
+ * Collective operation.
+ *
+ * \return  Future of the iterator past the last element received.
+ *
+ * \ingroup DashCollectiveConcept
+ */
+template <typename ValueType>
+dash::Future<ValueType *> broadcast_async(
+  ValueType        * first,
+  ValueType        * last,
+  dash::team_unit_t  root,
+  dash::Team       & team = dash::Team::All())
+{
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::broadcast_async requires trivially copyable "
+                "element type");
+  dash::dart_storage<ValueType> ds(std::distance(first, last));
+  DASH_LOG_TRACE("dash::broadcast_async()", "root:", root, "nelem:",
+                 ds.nelem);
+  auto handle = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+  DASH_ASSERT_RETURNS(
+    dart_ibcast(
+      first,
+      ds.nelem,
+      ds.dtype,
+      root,
+      team.dart_id(),
+      handle.get()),
+    DART_OK);
+  return internal::collective_future<ValueType *>(
+           handle, std::shared_ptr<void>(),
+           [last]() { return last; });
+}
+
+/**
+ * Non-blocking gather of the values in local range \c [in_first, in_last)
+ * of all units in the team.
+ * Values of unit \c u are written to the range starting at
+ * \c out_first + u * (in_last - in_first).
+ * All units must contribute the same number of values.
+ *
+ * Collective operation.
+ *
+ * \return  Future of the iterator past the last element received.
+ *
+ * \ingroup DashCollectiveConcept
+ */
+template <typename ValueType>
+dash::Future<ValueType *> allgather_async(
+  const ValueType * in_first,
+  const ValueType * in_last,
+  ValueType       * out_first,
+  dash::Team      & team = dash::Team::All())
+{
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::allgather_async requires trivially copyable "
+                "element type");
+  auto nelem    = std::distance(in_first, in_last);
+  auto out_last = out_first + nelem * team.size();
+  dash::dart_storage<ValueType> ds(nelem);
+  DASH_LOG_TRACE("dash::allgather_async()", "nelem:", nelem);
+  auto handle   = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+  DASH_ASSERT_RETURNS(
+    dart_iallgather(
+      in_first,
+      out_first,
+      ds.nelem,
+      ds.dtype,
+      team.dart_id(),
+      handle.get()),
+    DART_OK);
+  return internal::collective_future<ValueType *>(
+           handle, std::shared_ptr<void>(),
+           [out_last]() { return out_last; });
+}
+
+} // namespace dash
+
+#endif // DASH__COLLECTIVE_H__INCLUDED
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <utility>
 #include <sstream>
 #include <iostream>
 
@@ -67,7 +68,17 @@ public:
   { }
 
   Future(const self_t& other) = delete;
-  Future(self_t&& other)      = default;
+
+  Future(self_t&& other)
+  : _get_func(std::move(other._get_func)),
+    _test_func(std::move(other._test_func)),
+    _destroy_func(std::move(other._destroy_func)),
+    _value(std::move(other._value)),
+    _ready(other._ready)
+  {
+    // Moved-from std::function objects are not guaranteed to be empty:
+    other._destroy_func = nullptr;
+  }
 
   ~Future() {
     if (_destroy_func) {
@@ -77,7 +88,26 @@ public:
 
   /// copy-assignment is not permitted
   Future<ResultT> & operator=(const self_t& other) = delete;
-  Future<ResultT> & operator=(self_t&& other)      = default;
+
+  /**
+   * Move-assignment, releases the pending operation of this future before
+   * taking over the operation of \c other.
+   */
+  Future<ResultT> & operator=(self_t&& other)
+  {
+    if (this != &other) {
+      if (_destroy_func) {
+        _destroy_func();
+      }
+      _get_func           = std::move(other._get_func);
+      _test_func          = std::move(other._test_func);
+      _destroy_func       = std::move(other._destroy_func);
+      _value              = std::move(other._value);
+      _ready              = other._ready;
+      other._destroy_func = nullptr;
+    }
+    return *this;
+  }
 
   void wait()
   {
@@ -114,6 +144,125 @@ public:
 
 }; // class Future
 
+/**
+ * Future of an operation without result, e.g. a non-blocking barrier.
+ */
+template<>
+class Future<void>
+{
+private:
+  typedef Future<void>                   self_t;
+  typedef std::function<void (void)>     get_func_t;
+  typedef std::function<bool (void)>     test_func_t;
+  typedef std::function<void (void)>     destroy_func_t;
+
+private:
+  get_func_t     _get_func;
+  test_func_t    _test_func;
+  destroy_func_t _destroy_func;
+  bool           _ready = false;
+
+public:
+
+  /**
+   * Future of an operation that has already completed.
+   */
+  Future()
+  : _ready(true)
+  { }
+
+  Future(const get_func_t & func)
+  : _get_func(func)
+  { }
+
+  Future(
+    const get_func_t     & get_func,
+    const test_func_t    & test_func)
+  : _get_func(get_func),
+    _test_func(test_func)
+  { }
+
+  Future(
+    const get_func_t     & get_func,
+    const test_func_t    & test_func,
+    const destroy_func_t & destroy_func)
+  : _get_func(get_func),
+    _test_func(test_func),
+    _destroy_func(destroy_func)
+  { }
+
+  Future(const self_t& other) = delete;
+
+  Future(self_t&& other)
+  : _get_func(std::move(other._get_func)),
+    _test_func(std::move(other._test_func)),
+    _destroy_func(std::move(other._destroy_func)),
+    _ready(other._ready)
+  {
+    // Moved-from std::function objects are not guaranteed to be empty:
+    other._destroy_func = nullptr;
+  }
+
+  ~Future() {
+    if (_destroy_func) {
+      _destroy_func();
+    }
+  }
+
+  /// copy-assignment is not permitted
+  Future<void> & operator=(const self_t& other) = delete;
+
+  /**
+   * Move-assignment, releases the pending operation of this future before
+   * taking over the operation of \c other.
+   */
+  Future<void> & operator=(self_t&& other)
+  {
+    if (this != &other) {
+      if (_destroy_func) {
+        _destroy_func();
+      }
+      _get_func           = std::move(other._get_func);
+      _test_func          = std::move(other._test_func);
+      _destroy_func       = std::move(other._destroy_func);
+      _ready              = other._ready;
+      other._destroy_func = nullptr;
+    }
+    return *this;
+  }
+
+  void wait()
+  {
+    DASH_LOG_TRACE_VAR("Future<void>.wait()", _ready);
+    if (_ready) {
+      return;
+    }
+    if (!_get_func) {
+      DASH_LOG_ERROR("Future<void>.wait()", "No function");
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future not initialized with function");
+    }
+    _get_func();
+    _ready = true;
+    DASH_LOG_TRACE_VAR("Future<void>.wait >", _ready);
+  }
+
+  bool test()
+  {
+    if (!_ready && _test_func) {
+      _ready = _test_func();
+    }
+    return _ready;
+  }
+
+  void get()
+  {
+    wait();
+  }
+
+}; // class Future<void>
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
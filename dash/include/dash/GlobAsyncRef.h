@@ -4,8 +4,10 @@
 #include <dash/GlobPtr.h>
 #include <dash/Allocator.h>
 #include <dash/memory/GlobStaticMem.h>
+#include <dash/internal/WriteCombineBuffer.h>
 
 #include <iostream>
+#include <memory>
 
 namespace dash {
 
@@ -74,6 +76,10 @@ private:
   mutable nonconst_value_type _value;
   /// DART handle for asynchronous transfers
   mutable dart_handle_t _handle = DART_HANDLE_NULL;
+  /// Queue of combined writes, writes are transferred individually if
+  /// empty or expired, see \c dash::AsyncArrayRef::write_combining.
+  std::weak_ptr<dash::internal::WriteCombineBuffer<nonconst_value_type>>
+    _wcbuf;
 
 private:
 
@@ -116,6 +122,22 @@ public:
   : _gptr(dart_gptr)
   { }
 
+  /**
+   * Conctructor, creates an GlobRefAsync object referencing an element in
+   * global memory with writes queued in a write-combining buffer.
+   * Writes are transferred individually once the buffer is destroyed.
+   */
+  GlobAsyncRef(
+    /// Pointer to referenced object in global memory
+    dart_gptr_t   dart_gptr,
+    /// Queue of combined writes
+    const std::shared_ptr<
+            dash::internal::WriteCombineBuffer<nonconst_value_type>
+          > & wcbuf)
+  : _gptr(dart_gptr),
+    _wcbuf(wcbuf)
+  { }
+
   /**
    * Conctructor, creates an GlobRefAsync object referencing an element in
    * global memory.
@@ -259,6 +281,10 @@ public:
                   "Cannot modify value through GlobAsyncRef<const T>!");
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", *tptr);
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", _gptr);
+    if (auto wcbuf = _wcbuf.lock()) {
+      wcbuf->push(_gptr, *tptr);
+      return;
+    }
     dash::internal::put(_gptr, tptr, 1);
   }
 
@@ -273,6 +299,10 @@ public:
                   "Cannot modify value through GlobAsyncRef<const T>!");
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", new_value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", _gptr);
+    if (auto wcbuf = _wcbuf.lock()) {
+      wcbuf->push(_gptr, new_value);
+      return;
+    }
     _value = new_value;
     // check that we do not overwrite the handle if it has been used before
     if (this->_handle != DART_HANDLE_NULL) {
@@ -3,8 +3,23 @@
 
 #include <dash/Team.h>
 
+#include <chrono>
+#include <cstdint>
+
 namespace dash {
 
+/**
+ * Algorithm used by a \c dash::Mutex.
+ */
+enum class mutex_policy : uint8_t {
+/// queue lock in which every unit enqueues itself in a team-wide queue
+queue    = 0x1,
+/// hierarchical lock that is handed over between units sharing a node
+/// before it is passed to another node, see
+/// \c dart_team_cohort_lock_init
+cohort   = 0x2
+};
+
 /**
  * Behaves similar to \c std::mutex and is used to ensure mutual exclusion
  * within a dash team.
@@ -36,9 +51,14 @@ public:
    * is used.
    * 
    * This function is not thread-safe
-   * @param team team for mutual exclusive accesses
+   * @param team   team for mutual exclusive accesses
+   * @param policy locking algorithm, \c mutex_policy::cohort reduces
+   *               inter-node traffic if units on the same node contend
+   *               for the lock
    */
-  explicit Mutex(Team & team = dash::Team::All());
+  explicit Mutex(
+    Team         & team   = dash::Team::All(),
+    mutex_policy   policy = mutex_policy::queue);
   
   Mutex(const Mutex & other)               = delete;
   Mutex(Mutex && other)                    = default;
@@ -63,12 +83,38 @@ public:
    * @return True if lock was successfully aquired, False otherwise
    */
   bool try_lock();
+
+  /**
+   * Try to acquire the lock, blocking for at most the given duration.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template<class Rep, class Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period> & timeout) {
+    auto timeout_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(timeout).count();
+    return try_lock_for_us(timeout_us > 0 ? timeout_us : 0);
+  }
+
+  /**
+   * Try to acquire the lock, blocking at most until the given point in
+   * time has been reached.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template<class Clock, class Duration>
+  bool try_lock_until(
+    const std::chrono::time_point<Clock, Duration> & deadline) {
+    return try_lock_for(deadline - Clock::now());
+  }
   
   /**
-   * Release the lock acquired through \c lock() or \c try_lock().
+   * Release the lock acquired through \c lock(), \c try_lock() or
+   * \c try_lock_for().
    */
   void unlock();
   
+private:
+  bool try_lock_for_us(uint64_t timeout_us);
+
 private:
   dart_lock_t   _mutex;
 }; // class Mutex
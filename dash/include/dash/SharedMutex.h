@@ -0,0 +1,162 @@
+#ifndef DASH__SHARED_MUTEX_H__INCLUDED
+#define DASH__SHARED_MUTEX_H__INCLUDED
+
+#include <dash/Team.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace dash {
+
+/**
+ * Behaves similar to \c std::shared_timed_mutex and is used to allow
+ * either exclusive write access or shared read access within a dash team.
+ *
+ * Readers register in a counter shared by all units on the same node so
+ * concurrent readers do not serialize on a single unit, see
+ * \c dart_team_rwlock_init.
+ *
+ * \note This works properly with \c std::lock_guard, \c std::unique_lock
+ *       and \c std::shared_lock
+ * \note SharedMutex cannot be placed in DASH containers
+ *
+ * \code
+ * dash::SharedMutex mx; // mutex for dash::Team::All();
+ * dash::Array<int> arr(10);
+ * {
+ *    std::shared_lock<dash::SharedMutex> sl(mx);
+ *    int value = arr[0];
+ * }
+ * {
+ *    std::lock_guard<dash::SharedMutex> lg(mx);
+ *    arr[0] = arr[0] + 1;
+ * }
+ * \endcode
+ */
+class SharedMutex {
+private:
+  using self_t = SharedMutex;
+
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team & team = dash::Team::All());
+
+  SharedMutex(const SharedMutex & other)   = delete;
+  /**
+   * Move constructor, \c other no longer refers to a lock.
+   */
+  SharedMutex(SharedMutex && other);
+
+  self_t & operator=(const self_t & other) = delete;
+  /**
+   * Move assignment, swaps the locks of both mutexes.
+   */
+  self_t & operator=(self_t && other);
+
+  /**
+   * Collective destructor to destruct a DART reader-writer lock.
+   *
+   * This function is not thread-safe
+   */
+  ~SharedMutex();
+
+  /**
+   * Block until the lock was acquired exclusively.
+   */
+  void lock();
+
+  /**
+   * Try to acquire the lock exclusively and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock();
+
+  /**
+   * Try to acquire the lock exclusively, blocking for at most the given
+   * duration.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template<class Rep, class Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period> & timeout) {
+    return try_lock_for_us(to_us(timeout));
+  }
+
+  /**
+   * Try to acquire the lock exclusively, blocking at most until the given
+   * point in time has been reached.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template<class Clock, class Duration>
+  bool try_lock_until(
+    const std::chrono::time_point<Clock, Duration> & deadline) {
+    return try_lock_for(deadline - Clock::now());
+  }
+
+  /**
+   * Release the lock acquired exclusively.
+   */
+  void unlock();
+
+  /**
+   * Block until the lock was acquired for reading.
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire the lock for reading and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Try to acquire the lock for reading, blocking for at most the given
+   * duration.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template<class Rep, class Period>
+  bool try_lock_shared_for(
+    const std::chrono::duration<Rep, Period> & timeout) {
+    return try_lock_shared_for_us(to_us(timeout));
+  }
+
+  /**
+   * Try to acquire the lock for reading, blocking at most until the given
+   * point in time has been reached.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template<class Clock, class Duration>
+  bool try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration> & deadline) {
+    return try_lock_shared_for(deadline - Clock::now());
+  }
+
+  /**
+   * Release the lock acquired for reading.
+   */
+  void unlock_shared();
+
+private:
+  template<class Rep, class Period>
+  static uint64_t to_us(const std::chrono::duration<Rep, Period> & timeout) {
+    auto timeout_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(timeout).count();
+    return (timeout_us > 0) ? timeout_us : 0;
+  }
+
+  bool try_lock_for_us(uint64_t timeout_us);
+
+  bool try_lock_shared_for_us(uint64_t timeout_us);
+
+private:
+  dart_rwlock_t   _rwlock;
+}; // class SharedMutex
+
+} // namespace dash
+
+#endif // DASH__SHARED_MUTEX_H__INCLUDED
@@ -6,6 +6,7 @@
 #include <dash/Init.h>
 #include <dash/Types.h>
 #include <dash/Exception.h>
+#include <dash/Future.h>
 
 #include <dash/util/Locality.h>
 
@@ -475,6 +476,38 @@ public:
     }
   }
 
+  /**
+   * Non-blocking barrier.
+   * The returned future completes once all units in the team entered the
+   * barrier, local work can be performed in the meantime.
+   * Destroying the future waits for completion of the barrier.
+   */
+  inline dash::Future<void> barrier_async() const
+  {
+    if (is_null()) {
+      return dash::Future<void>();
+    }
+    auto handle = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+    DASH_ASSERT_RETURNS(
+      dart_ibarrier(_dartid, handle.get()),
+      DART_OK);
+    return dash::Future<void>(
+      // wait
+      [handle]() {
+        DASH_ASSERT_RETURNS(dart_wait(handle.get()), DART_OK);
+      },
+      // test
+      [handle]() {
+        int32_t flag;
+        DASH_ASSERT_RETURNS(dart_test(handle.get(), &flag), DART_OK);
+        return (flag != 0);
+      },
+      // destroy
+      [handle]() {
+        DASH_ASSERT_RETURNS(dart_wait(handle.get()), DART_OK);
+      });
+  }
+
   inline team_unit_t myid() const
   {
     return _myid;
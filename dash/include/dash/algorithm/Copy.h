@@ -5,10 +5,16 @@
 #include <dash/Iterator.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/PatternBlocks.h>
+#include <dash/pattern/PatternProperties.h>
+#include <dash/util/EventTrace.h>
 
 #include <dash/dart/if/dart_communication.h>
 
 #include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include <memory>
 #include <future>
@@ -97,9 +103,108 @@ namespace internal {
 // Global to Local
 // =========================================================================
 
+/**
+ * Offset and extent in dimension \c d of the view of a global iterator
+ * relative to a view.
+ */
+template <class GlobIterType>
+auto copy_view_range(
+  const GlobIterType & it,
+  dim_t                d,
+  int)
+-> decltype(it.viewspec(), std::pair<long long, long long>())
+{
+  auto vs = it.viewspec();
+  return std::pair<long long, long long>(vs.offset(d), vs.extent(d));
+}
+
+/**
+ * Offset and extent in dimension \c d of the pattern of a global iterator
+ * not relative to a view.
+ */
+template <class GlobIterType>
+std::pair<long long, long long> copy_view_range(
+  const GlobIterType & it,
+  dim_t                d,
+  long)
+{
+  return std::pair<long long, long long>(0, it.pattern().extent(d));
+}
+
+/**
+ * Number of elements in the iteration range starting at global index
+ * \c g_index that are stored contiguously in the local memory of the
+ * unit owning the element at \c g_index.
+ *
+ * Specialization for one-dimensional patterns with minimal partitioning,
+ * every unit holds a single contiguous index range.
+ */
+template <class PatternType>
+typename PatternType::size_type copy_run_length(
+  const PatternType                          & pattern,
+  typename PatternType::index_type             g_index,
+  const typename PatternType::local_index_t  & l_pos,
+  const std::pair<long long, long long>      & view_range,
+  std::true_type                               /* contiguous units */)
+{
+  return pattern.local_size(l_pos.unit) - l_pos.index;
+}
+
+/**
+ * Number of elements in the iteration range starting at global index
+ * \c g_index that are stored contiguously in the local memory of the
+ * unit owning the element at \c g_index.
+ *
+ * Runs end at the boundary of the current block or of the iterated view
+ * in the fastest-running dimension, adjacent runs are coalesced by the
+ * caller.
+ */
+template <class PatternType>
+typename PatternType::size_type copy_run_length(
+  const PatternType                          & pattern,
+  typename PatternType::index_type             g_index,
+  const typename PatternType::local_index_t  & l_pos,
+  const std::pair<long long, long long>      & view_range,
+  std::false_type                              /* contiguous units */)
+{
+  typedef typename PatternType::size_type size_type;
+  const dim_t fast_dim = (PatternType::memory_order() == dash::ROW_MAJOR)
+                         ? PatternType::ndim() - 1
+                         : 0;
+  auto      g_coords   = pattern.coords(g_index);
+  size_type blocksize  = pattern.blocksize(fast_dim);
+  size_type coord      = g_coords[fast_dim];
+  return std::min<size_type>(blocksize - (coord % blocksize),
+                             view_range.first + view_range.second - coord);
+}
+
+/**
+ * Whether the local index range of the global input range is a
+ * contiguous global index range, i.e. can be copied as a single subrange
+ * preceded and succeeded by remote elements.
+ * Not satisfied for cyclic or tiled distributions in general.
+ */
+template <class GlobInputIt, class LocalIndexRange>
+bool copy_local_range_is_contiguous(
+  const GlobInputIt     & first,
+  const LocalIndexRange & l_range)
+{
+  const auto & pattern = first.pattern();
+  auto num_local_elem  = l_range.end - l_range.begin;
+  auto g_l_begin       = pattern.global(l_range.begin);
+  auto g_l_end         = pattern.global(l_range.end - 1) + 1;
+  return (g_l_end - g_l_begin) == num_local_elem;
+}
+
 /**
  * Blocking implementation of \c dash::copy (global to local) without
  * optimization for local subrange.
+ *
+ * The input range is decomposed into runs of elements stored
+ * contiguously at their owning unit by iterating over pattern blocks.
+ * All runs owned by the same unit are coalesced into a single transfer
+ * using indexed data types, so the number of requests is at most the
+ * number of units, regardless of the distribution.
  */
 template <
   typename ValueType,
@@ -114,9 +219,16 @@ ValueType * copy_impl(
                  "in_first:",  in_first.pos(),
                  "in_last:",   in_last.pos(),
                  "out_first:", out_first);
-  auto pattern = in_first.pattern();
-  typedef typename decltype(pattern)::index_type index_type;
-  typedef typename decltype(pattern)::size_type  size_type;
+  const auto & pattern = in_first.pattern();
+  typedef typename std::decay<decltype(pattern)>::type pattern_t;
+  typedef typename pattern_t::index_type               index_type;
+  typedef typename pattern_t::size_type                size_type;
+  typedef std::integral_constant<
+            bool,
+            pattern_t::ndim() == 1 &&
+            dash::pattern_partitioning_traits<pattern_t>::type::minimal >
+    contiguous_units;
+
   size_type num_elem_total = dash::distance(in_first, in_last);
   if (num_elem_total <= 0) {
     DASH_LOG_TRACE("dash::copy_impl", "input range empty");
@@ -125,89 +237,136 @@ ValueType * copy_impl(
   DASH_LOG_TRACE("dash::copy_impl",
                  "total elements:",    num_elem_total,
                  "expected out_last:", out_first + num_elem_total);
-  // Input iterators could be relative to a view. Map first input iterator
-  // to global index range and use it to resolve last input iterator.
-  // Do not use in_last.global() as this would span over the relative input
-  // range.
-  auto g_in_first      = in_first.global();
-  auto g_in_last       = g_in_first + num_elem_total;
-  DASH_LOG_TRACE("dash::copy_impl",
-                 "g_in_first:", g_in_first.pos(),
-                 "g_in_last:",  g_in_last.pos());
-  auto unit_first      = pattern.unit_at(g_in_first.pos());
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_first);
-  auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
-  DASH_LOG_TRACE_VAR("dash::copy_impl", unit_last);
-
-  size_type num_elem_copied = 0;
-  if (unit_first == unit_last) {
-    // Input range is located at a single remote unit:
-    DASH_LOG_TRACE("dash::copy_impl", "input range at single unit");
-    DASH_LOG_TRACE("dash::copy_impl",
-                    "get elements:",   num_elem_total);
-    auto cur_in_first  = g_in_first;
-    auto cur_out_first = out_first;
-    dart_handle_t handle;
-    dash::internal::get_handle(
-      cur_in_first.dart_gptr(),
-      cur_out_first,
-      num_elem_total,
-      &handle);
-    if (handle != DART_HANDLE_NULL) {
-      handles.push_back(handle);
+  // Input iterators could be relative to a view, elements are enumerated
+  // in the view's iteration order:
+  const dim_t fast_dim = (pattern_t::memory_order() == dash::ROW_MAJOR)
+                         ? pattern_t::ndim() - 1
+                         : 0;
+  auto view_range      = copy_view_range(in_first, fast_dim, 0);
+
+  // Contiguous runs in source units' local memory, in order of the input
+  // range:
+  struct copy_run {
+    team_unit_t unit;
+    index_type  l_index;
+    size_type   offset;
+    size_type   nelem;
+  };
+  std::vector<copy_run> runs;
+  size_type num_elem_planned = 0;
+  while (num_elem_planned < num_elem_total) {
+    index_type g_index = (in_first + num_elem_planned).gpos();
+    auto       l_pos   = pattern.local(g_index);
+    size_type  nelem   = std::min<size_type>(
+                           copy_run_length(pattern, g_index, l_pos,
+                                           view_range, contiguous_units()),
+                           num_elem_total - num_elem_planned);
+    DASH_ASSERT_GT(nelem, 0, "Number of element to copy is 0");
+    if (!runs.empty() &&
+        runs.back().unit == l_pos.unit &&
+        runs.back().l_index + static_cast<index_type>(runs.back().nelem)
+          == l_pos.index) {
+      runs.back().nelem += nelem;
+    } else {
+      runs.push_back({ l_pos.unit, l_pos.index, num_elem_planned, nelem });
     }
-    num_elem_copied = num_elem_total;
-  } else {
-    // Input range is spread over several remote units:
-    DASH_LOG_TRACE("dash::copy_impl", "input range spans multiple units");
-    //
-    // Copy elements from every unit:
-    //
-    while (num_elem_copied < num_elem_total) {
-      // Global iterator pointing at begin of current unit's input range:
-      auto cur_in_first    = g_in_first + num_elem_copied;
-      // unit and local index of first element in current range segment:
-      auto local_pos       = pattern.local(static_cast<index_type>(
-                                             cur_in_first.pos()));
-      // Number of elements located at current source unit:
-      size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
-      // Local offset of first element in input range at current unit:
-      auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      // Number of elements to copy in this iteration.
-      auto num_copy_elem   = num_unit_elem;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
+    num_elem_planned += nelem;
+  }
+  DASH_LOG_TRACE("dash::copy_impl", "runs:", runs.size());
+  std::stable_sort(runs.begin(), runs.end(),
+                   [](const copy_run & a, const copy_run & b) {
+                     return a.unit < b.unit;
+                   });
+
+  const auto myid    = in_first.team().myid();
+  // Elements of basic type per value, non-basic value types are
+  // transferred as bytes:
+  dash::dart_storage<ValueType> ds_value(1);
+  std::vector<size_t> src_offsets;
+  std::vector<size_t> dst_offsets;
+  std::vector<size_t> blocklens;
+  for (auto run_first = runs.begin(); run_first != runs.end(); ) {
+    auto run_last = std::find_if(run_first, runs.end(),
+                                 [&](const copy_run & r) {
+                                   return r.unit != run_first->unit;
+                                 });
+    if (run_first->unit == myid) {
+      // Runs in local memory:
+      ValueType * l_base = (in_first + run_first->offset).global().local()
+                           - run_first->l_index;
+      for (auto run = run_first; run != run_last; ++run) {
+        std::copy(l_base + run->l_index,
+                  l_base + run->l_index + run->nelem,
+                  out_first + run->offset);
       }
-      DASH_ASSERT_GT(num_copy_elem, 0,
-                     "Number of element to copy is 0");
+    } else if (std::next(run_first) == run_last) {
       DASH_LOG_TRACE("dash::copy_impl",
-                     "start g_idx:",    cur_in_first.pos(),
-                     "->",
-                     "unit:",           local_pos.unit,
-                     "l_idx:",          l_in_first_idx,
-                     "->",
-                     "unit elements:",  num_unit_elem,
-                     "max elem/unit:",  max_elem_per_unit,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto dest_ptr = out_first + num_elem_copied;
-      auto src_gptr = cur_in_first.dart_gptr();
+                     "unit:",  run_first->unit,
+                     "get elements:", run_first->nelem);
       dart_handle_t handle;
-      dash::internal::get_handle(src_gptr, dest_ptr, num_copy_elem, &handle);
-      num_elem_copied += num_copy_elem;
+      dash::internal::get_handle(
+        (in_first + run_first->offset).global().dart_gptr(),
+        out_first + run_first->offset,
+        run_first->nelem,
+        &handle);
+      if (handle != DART_HANDLE_NULL) {
+        handles.push_back(handle);
+      }
+    } else {
+      // Runs are ordered by output offset, the run with the lowest local
+      // index is the base of the source data type:
+      auto src_base = std::min_element(run_first, run_last,
+                        [](const copy_run & a, const copy_run & b) {
+                          return a.l_index < b.l_index;
+                        });
+      src_offsets.clear();
+      dst_offsets.clear();
+      blocklens.clear();
+      size_type num_unit_elem = 0;
+      for (auto run = run_first; run != run_last; ++run) {
+        src_offsets.push_back(
+          (run->l_index - src_base->l_index) * ds_value.nelem);
+        dst_offsets.push_back(
+          (run->offset - run_first->offset) * ds_value.nelem);
+        blocklens.push_back(run->nelem * ds_value.nelem);
+        num_unit_elem += run->nelem;
+      }
+      DASH_LOG_TRACE("dash::copy_impl",
+                     "unit:",          run_first->unit,
+                     "runs:",          blocklens.size(),
+                     "get elements:",  num_unit_elem);
+      dart_datatype_t src_type;
+      dart_datatype_t dst_type;
+      DASH_ASSERT_RETURNS(
+        dart_type_create_indexed(ds_value.dtype, blocklens.size(),
+                                 blocklens.data(), src_offsets.data(),
+                                 &src_type),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_type_create_indexed(ds_value.dtype, blocklens.size(),
+                                 blocklens.data(), dst_offsets.data(),
+                                 &dst_type),
+        DART_OK);
+      dart_handle_t handle;
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(out_first + run_first->offset,
+                        (in_first + src_base->offset).global().dart_gptr(),
+                        num_unit_elem * ds_value.nelem,
+                        src_type,
+                        dst_type,
+                        &handle),
+        DART_OK);
+      // Data types may be destroyed while the transfer is pending:
+      DASH_ASSERT_RETURNS(dart_type_destroy(&src_type), DART_OK);
+      DASH_ASSERT_RETURNS(dart_type_destroy(&dst_type), DART_OK);
       if (handle != DART_HANDLE_NULL) {
         handles.push_back(handle);
       }
     }
+    run_first = run_last;
   }
 
-  ValueType * out_last = out_first + num_elem_copied;
+  ValueType * out_last = out_first + num_elem_total;
   DASH_LOG_TRACE_VAR("dash::copy_impl >", out_last);
   return out_last;
 }
@@ -277,6 +436,7 @@ dash::Future<ValueType *> copy_async(
   const auto & team = in_first.team();
 
   DASH_LOG_TRACE("dash::copy_async()", "async, global to local");
+  DASH_EVENT_TRACE_SCOPE("dash::copy_async");
   if (in_first == in_last) {
     DASH_LOG_TRACE("dash::copy_async", "input range empty");
     return dash::Future<ValueType *>(out_first);
@@ -336,8 +496,10 @@ dash::Future<ValueType *> copy_async(
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
+  // Check if global input range is partially local and the local subrange
+  // is contiguous in the input range:
+  if (num_local_elem > 0 &&
+      dash::internal::copy_local_range_is_contiguous(in_first, li_range_in)) {
     // Part of the input range is local, copy local input subrange to local
     // output range directly.
     auto pattern          = in_first.pattern();
@@ -447,8 +609,9 @@ dash::Future<ValueType *> copy_async(
                    "elements");
     out_last += (local_out_last - local_out_first);
   } else {
-    DASH_LOG_TRACE("dash::copy_async", "no local subrange");
-    // All elements in input range are remote
+    DASH_LOG_TRACE("dash::copy_async", "no contiguous local subrange");
+    // All elements in input range are remote or local elements are
+    // interleaved with remote elements:
     dash::internal::copy_impl(in_first,
                               in_last,
                               dest_first,
@@ -533,6 +696,7 @@ ValueType * copy(
                       <= l2_line_size;
 
   DASH_LOG_TRACE("dash::copy()", "blocking, global to local");
+  DASH_EVENT_TRACE_SCOPE("dash::copy");
 
   ValueType * dest_first = out_first;
   // Return value, initialize with begin of output range, indicating no
@@ -579,8 +743,10 @@ ValueType * copy(
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
+  // Check if global input range is partially local and the local subrange
+  // is contiguous in the input range:
+  if (num_local_elem > 0 &&
+      dash::internal::copy_local_range_is_contiguous(in_first, li_range_in)) {
     // Part of the input range is local, copy local input subrange to local
     // output range directly.
     auto pattern          = in_first.pattern();
@@ -690,8 +856,9 @@ ValueType * copy(
                                            handles);
     }
   } else {
-    DASH_LOG_TRACE("dash::copy", "no local subrange");
-    // All elements in input range are remote
+    DASH_LOG_TRACE("dash::copy", "no contiguous local subrange");
+    // All elements in input range are remote or local elements are
+    // interleaved with remote elements:
     out_last = dash::internal::copy_impl(in_first,
                                          in_last,
                                          dest_first,
@@ -727,6 +894,7 @@ dash::Future<GlobOutputIt> copy_async(
   ValueType    * in_last,
   GlobOutputIt   out_first)
 {
+  DASH_EVENT_TRACE_SCOPE("dash::copy_async");
   auto handles  = std::make_shared<std::vector<dart_handle_t>>();
   auto out_last = dash::internal::copy_impl(in_first,
                                             in_last,
@@ -799,6 +967,7 @@ GlobOutputIt copy(
   GlobOutputIt   out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, local to global");
+  DASH_EVENT_TRACE_SCOPE("dash::copy");
   // Return value, initialize with begin of output range, indicating no values
   // have been copied:
   GlobOutputIt out_last   = out_first;
@@ -889,6 +1058,410 @@ GlobOutputIt copy(
 
 
 
+// =========================================================================
+// Rectangular Views
+// =========================================================================
+
+namespace internal {
+
+/**
+ * Calls \c fn(unit, g_it, l_strides, b_base, b_strides, extent) for every
+ * intersection of the rectangular view with a block of the pattern, where
+ * \c g_it is a global iterator to the first element of the intersection,
+ * \c l_strides are its element strides in local memory of \c unit and
+ * \c b_base and \c b_strides are its offset and strides in a dense buffer
+ * of the view's extents.
+ */
+template <
+  class GlobIterType,
+  class ViewSpecType,
+  class PieceFunc >
+void copy_view_for_each_piece(
+  const GlobIterType & v_begin,
+  const ViewSpecType & viewspec,
+  PieceFunc            fn)
+{
+  typedef typename std::decay<decltype(v_begin.pattern())>::type pattern_t;
+  typedef typename pattern_t::index_type                        index_type;
+  constexpr std::size_t ndim = pattern_t::ndim();
+  typedef std::array<long long, ndim>                             coords_t;
+
+  const auto & pattern = v_begin.pattern();
+  coords_t v_offset;
+  coords_t v_extent;
+  std::array<dim_t, ndim> identity;
+  for (dim_t d = 0; d < ndim; ++d) {
+    v_offset[d] = viewspec.offset(d);
+    v_extent[d] = viewspec.extent(d);
+    identity[d] = d;
+  }
+  auto b_strides = packed_strides(v_extent);
+  auto g_begin   = v_begin.global();
+  for_each_block_in_rect(
+    pattern, v_offset, v_extent,
+    [&](long long, const coords_t & blk_offset, const coords_t & blk_extent) {
+      coords_t offset;
+      coords_t extent;
+      if (!rect_intersect(v_offset, v_extent, blk_offset, blk_extent,
+                          offset, extent)) {
+        return;
+      }
+      std::array<index_type, ndim> g_coords;
+      long long b_base = 0;
+      for (dim_t d = 0; d < ndim; ++d) {
+        g_coords[d] = static_cast<index_type>(offset[d]);
+        b_base     += (offset[d] - v_offset[d]) * b_strides[d];
+      }
+      coords_t l_strides;
+      block_local_strides(pattern, offset, extent, identity, l_strides);
+      auto g_it = g_begin + (pattern.memory_layout().at(g_coords) -
+                             g_begin.pos());
+      fn(pattern.unit_at(g_coords), g_it, l_strides, b_base, b_strides,
+         extent);
+    });
+}
+
+/**
+ * Block lengths and offsets of the contiguous runs of a rectangle with the
+ * given extents in local memory and in the dense buffer, relative to the
+ * rectangle's first element and scaled by \c scale elements of the basic
+ * data type per value.
+ */
+template <std::size_t NumDimensions>
+void copy_view_runs(
+  const std::array<long long, NumDimensions> & extent,
+  const std::array<long long, NumDimensions> & l_strides,
+  const std::array<long long, NumDimensions> & b_strides,
+  size_t                                       scale,
+  std::vector<size_t>                        & l_offsets,
+  std::vector<size_t>                        & b_offsets,
+  std::vector<size_t>                        & blocklens)
+{
+  const dim_t last   = NumDimensions - 1;
+  const bool  contig = extent[last] == 1 || l_strides[last] == 1;
+  // Dimensions iterated element-wise, runs span the last dimension if
+  // it is contiguous in local memory:
+  const dim_t outer  = contig ? last : NumDimensions;
+  const size_t run_len = contig ? extent[last] : 1;
+  l_offsets.clear();
+  b_offsets.clear();
+  blocklens.clear();
+  std::array<long long, NumDimensions> idx {{ }};
+  while (true) {
+    long long l_offs = 0;
+    long long b_offs = 0;
+    for (dim_t d = 0; d < outer; ++d) {
+      l_offs += idx[d] * l_strides[d];
+      b_offs += idx[d] * b_strides[d];
+    }
+    l_offsets.push_back(l_offs * scale);
+    b_offsets.push_back(b_offs * scale);
+    blocklens.push_back(run_len * scale);
+    dim_t d = outer;
+    while (d > 0 && ++idx[d-1] == extent[d-1]) {
+      idx[d-1] = 0;
+      --d;
+    }
+    if (d == 0) {
+      return;
+    }
+  }
+}
+
+template <typename ValueType, std::size_t NumDimensions>
+inline void copy_view_local(
+  std::false_type,
+  ValueType                                  * l_first,
+  const std::array<long long, NumDimensions> & l_strides,
+  ValueType                                  * b_first,
+  const std::array<long long, NumDimensions> & b_strides,
+  const std::array<long long, NumDimensions> & extent)
+{
+  copy_strided(l_first, l_strides, b_first, b_strides, extent);
+}
+
+template <typename ValueType, std::size_t NumDimensions>
+inline void copy_view_local(
+  std::true_type,
+  ValueType                                  * l_first,
+  const std::array<long long, NumDimensions> & l_strides,
+  const ValueType                            * b_first,
+  const std::array<long long, NumDimensions> & b_strides,
+  const std::array<long long, NumDimensions> & extent)
+{
+  copy_strided(b_first, b_strides, l_first, l_strides, extent);
+}
+
+template <typename ValueType>
+inline void copy_view_remote(
+  std::false_type,
+  dart_gptr_t       gptr,
+  ValueType       * b_first,
+  size_t            nelem,
+  dart_datatype_t   l_type,
+  dart_datatype_t   b_type,
+  dart_handle_t   * handle)
+{
+  DASH_ASSERT_RETURNS(
+    dart_get_handle(b_first, gptr, nelem, l_type, b_type, handle),
+    DART_OK);
+}
+
+template <typename ValueType>
+inline void copy_view_remote(
+  std::true_type,
+  dart_gptr_t       gptr,
+  const ValueType * b_first,
+  size_t            nelem,
+  dart_datatype_t   l_type,
+  dart_datatype_t   b_type,
+  dart_handle_t   * handle)
+{
+  DASH_ASSERT_RETURNS(
+    dart_put_handle(gptr, b_first, nelem, b_type, l_type, handle),
+    DART_OK);
+}
+
+/**
+ * Transfers between a rectangular view of a distributed matrix and a
+ * dense local buffer in row-major order of the view's extents, using a
+ * single strided or indexed transfer per intersected remote block.
+ */
+template <
+  bool     Put,
+  class    GlobIterType,
+  class    ViewSpecType,
+  typename BufferValueType >
+void copy_view_impl(
+  const GlobIterType         & v_begin,
+  const ViewSpecType         & viewspec,
+  BufferValueType            * buffer,
+  std::vector<dart_handle_t> & handles)
+{
+  typedef typename std::remove_const<BufferValueType>::type value_type;
+  typedef std::integral_constant<bool, Put>                 put_tag;
+  typedef typename std::decay<decltype(v_begin.pattern())>::type
+                                                            pattern_t;
+  typedef std::array<long long, pattern_t::ndim()>          coords_t;
+  typedef decltype(v_begin.global())                        g_iter_t;
+
+  DASH_LOG_TRACE("dash::copy_view_impl()", "put:", Put,
+                 "view size:", viewspec.size());
+  if (viewspec.size() == 0) {
+    return;
+  }
+  const auto myid = v_begin.pattern().team().myid();
+  // Elements of basic type per value, non-basic value types are
+  // transferred as bytes:
+  dash::dart_storage<value_type> ds_value(1);
+  std::vector<size_t> l_offsets;
+  std::vector<size_t> b_offsets;
+  std::vector<size_t> blocklens;
+
+  copy_view_for_each_piece(
+    v_begin, viewspec,
+    [&](team_unit_t unit, const g_iter_t & g_it, const coords_t & l_strides,
+        long long b_base, const coords_t & b_strides,
+        const coords_t & extent) {
+      DASH_LOG_TRACE("dash::copy_view_impl", "unit:", unit,
+                     "b_base:", b_base);
+      if (unit == myid) {
+        copy_view_local(put_tag(),
+                        const_cast<value_type *>(g_it.local()), l_strides,
+                        buffer + b_base, b_strides, extent);
+        return;
+      }
+      copy_view_runs(extent, l_strides, b_strides, ds_value.nelem,
+                     l_offsets, b_offsets, blocklens);
+      size_t nelem = 0;
+      for (auto len : blocklens) {
+        nelem += len;
+      }
+      dart_datatype_t l_type = ds_value.dtype;
+      dart_datatype_t b_type = ds_value.dtype;
+      if (blocklens.size() > 1) {
+        DASH_ASSERT_RETURNS(
+          dart_type_create_indexed(ds_value.dtype, blocklens.size(),
+                                   blocklens.data(), l_offsets.data(),
+                                   &l_type),
+          DART_OK);
+        DASH_ASSERT_RETURNS(
+          dart_type_create_indexed(ds_value.dtype, blocklens.size(),
+                                   blocklens.data(), b_offsets.data(),
+                                   &b_type),
+          DART_OK);
+      }
+      dart_handle_t handle;
+      copy_view_remote(put_tag(), g_it.dart_gptr(), buffer + b_base,
+                       nelem, l_type, b_type, &handle);
+      if (blocklens.size() > 1) {
+        // Data types may be destroyed while the transfer is pending:
+        DASH_ASSERT_RETURNS(dart_type_destroy(&l_type), DART_OK);
+        DASH_ASSERT_RETURNS(dart_type_destroy(&b_type), DART_OK);
+      }
+      if (handle != DART_HANDLE_NULL) {
+        handles.push_back(handle);
+      }
+    });
+}
+
+/**
+ * Future completing with the given result once all transfers referenced
+ * by \c handles completed.
+ */
+template <typename ResultT>
+dash::Future<ResultT> copy_handles_future(
+  std::shared_ptr<std::vector<dart_handle_t>> handles,
+  ResultT                                     result)
+{
+  if (handles->size() == 0) {
+    return dash::Future<ResultT>(result);
+  }
+  return dash::Future<ResultT>(
+    // wait
+    [=]() mutable {
+      DASH_ASSERT_RETURNS(
+        dart_waitall(handles->data(), handles->size()),
+        DART_OK);
+      handles->clear();
+      return result;
+    },
+    // test
+    [=](ResultT * out) mutable {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_testall(handles->data(), handles->size(), &flag),
+        DART_OK);
+      if (flag) {
+        handles->clear();
+        *out = result;
+      }
+      return (flag != 0);
+    },
+    // destroy
+    [=]() mutable {
+      for (auto & handle : *handles) {
+        DASH_ASSERT_RETURNS(dart_handle_free(&handle), DART_OK);
+      }
+    });
+}
+
+} // namespace internal
+
+/**
+ * Specialization of \c dash::copy as global-to-local blocking copy of a
+ * rectangular view of a matrix, e.g.
+ * \c matrix.sub<0>(r, nr).sub<1>(c, nc), to a dense local buffer.
+ * Elements are stored in row-major order of the view's extents.
+ *
+ * Issues a single strided or indexed transfer per block of the pattern
+ * intersecting the view.
+ *
+ * \returns  Pointer past the last element written to the buffer.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ViewType,
+  typename ValueType >
+auto copy(
+  const ViewType & in_view,
+  ValueType      * out_first)
+-> decltype(in_view.viewspec(), static_cast<ValueType *>(nullptr))
+{
+  DASH_LOG_TRACE("dash::copy()", "blocking, global view to local");
+  DASH_EVENT_TRACE_SCOPE("dash::copy");
+  std::vector<dart_handle_t> handles;
+  dash::internal::copy_view_impl<false>(
+    in_view.begin(), in_view.viewspec(), out_first, handles);
+  if (handles.size() > 0) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall_local(handles.data(), handles.size()),
+      DART_OK);
+  }
+  return out_first + in_view.viewspec().size();
+}
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-local copy of a
+ * rectangular view of a matrix to a dense local buffer.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ViewType,
+  typename ValueType >
+auto copy_async(
+  const ViewType & in_view,
+  ValueType      * out_first)
+-> decltype(in_view.viewspec(), dash::Future<ValueType *>(out_first))
+{
+  DASH_LOG_TRACE("dash::copy_async()", "async, global view to local");
+  DASH_EVENT_TRACE_SCOPE("dash::copy_async");
+  auto handles = std::make_shared<std::vector<dart_handle_t>>();
+  dash::internal::copy_view_impl<false>(
+    in_view.begin(), in_view.viewspec(), out_first, *handles);
+  return dash::internal::copy_handles_future<ValueType *>(
+           handles,
+           out_first + in_view.viewspec().size());
+}
+
+/**
+ * Specialization of \c dash::copy as local-to-global blocking copy of a
+ * dense local buffer to a rectangular view of a matrix.
+ * Elements in the buffer are expected in row-major order of the view's
+ * extents.
+ *
+ * \returns  Pointer past the last element read from the buffer.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class    ViewType >
+auto copy(
+  const ValueType * in_first,
+  ViewType          out_view)
+-> decltype(out_view.viewspec(), static_cast<const ValueType *>(nullptr))
+{
+  DASH_LOG_TRACE("dash::copy()", "blocking, local to global view");
+  DASH_EVENT_TRACE_SCOPE("dash::copy");
+  std::vector<dart_handle_t> handles;
+  dash::internal::copy_view_impl<true>(
+    out_view.begin(), out_view.viewspec(), in_first, handles);
+  if (handles.size() > 0) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(handles.data(), handles.size()),
+      DART_OK);
+  }
+  return in_first + out_view.viewspec().size();
+}
+
+/**
+ * Variant of \c dash::copy as asynchronous local-to-global copy of a
+ * dense local buffer to a rectangular view of a matrix.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class    ViewType >
+auto copy_async(
+  const ValueType * in_first,
+  ViewType          out_view)
+-> decltype(out_view.viewspec(),
+            dash::Future<const ValueType *>(in_first))
+{
+  DASH_LOG_TRACE("dash::copy_async()", "async, local to global view");
+  DASH_EVENT_TRACE_SCOPE("dash::copy_async");
+  auto handles = std::make_shared<std::vector<dart_handle_t>>();
+  dash::internal::copy_view_impl<true>(
+    out_view.begin(), out_view.viewspec(), in_first, *handles);
+  return dash::internal::copy_handles_future<const ValueType *>(
+           handles,
+           in_first + out_view.viewspec().size());
+}
+
 // =========================================================================
 // Other Specializations
 // =========================================================================
@@ -953,6 +1526,7 @@ GlobOutputIt copy(
   GlobOutputIt  out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
+  DASH_EVENT_TRACE_SCOPE("dash::copy");
 
   // TODO:
   // - Implement adapter for local-to-global dash::copy here
@@ -7,6 +7,8 @@
 #include <dash/dart/if/dart_types.h>
 
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 
 /**
@@ -45,17 +47,40 @@ public:
   typedef ValueType value_type;
 
 public:
-  constexpr typename std::enable_if< enabled, dart_operation_t >::type
+  template <bool enabled_ = enabled>
+  constexpr typename std::enable_if< enabled_, dart_operation_t >::type
   dart_operation() const {
     return _op;
   }
 
-  constexpr typename std::enable_if< enabled, OpKind >::type
+  template <bool enabled_ = enabled>
+  constexpr typename std::enable_if< enabled_, OpKind >::type
   op_kind() const {
     return _kind;
   }
 };
 
+/**
+ * Type trait indicating whether a binary operation maps to a
+ * \c dart_operation_t, i.e. provides an enabled \c dart_operation().
+ * Shared by all algorithms dispatching reduce operations to DART.
+ */
+template <class BinaryOp>
+struct has_dart_operation_impl
+{
+  template <class U>
+  static auto test(U *)
+    -> decltype(std::declval<const U &>().dart_operation());
+  template <typename>
+  static auto test(...) -> std::false_type;
+
+  using type = typename std::is_same<
+                 dart_operation_t, decltype(test<BinaryOp>(0))>::type;
+};
+
+template <class BinaryOp>
+struct has_dart_operation : has_dart_operation_impl<BinaryOp>::type {};
+
 } // namespace internal
 
 /**
@@ -0,0 +1,390 @@
+#ifndef DASH__ALGORITHM__REDISTRIBUTE_H__INCLUDED
+#define DASH__ALGORITHM__REDISTRIBUTE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/util/EventTrace.h>
+
+#include <dash/algorithm/internal/PatternBlocks.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Rectangular section of a distributed matrix that is contained in a
+ * single block of the source pattern and a single block of the
+ * destination pattern of \c dash::redistribute.
+ *
+ * Offsets and extents are specified in destination coordinates.
+ */
+template <std::size_t NumDimensions>
+struct redistribute_piece
+{
+  /// Unit owning the piece in the source (receiver) or destination
+  /// (sender) pattern.
+  dart_unit_t                              peer;
+  /// Global index of the source block containing the piece.
+  long long                                src_block;
+  /// Global index of the destination block containing the piece.
+  long long                                dst_block;
+  std::array<long long, NumDimensions>     offset;
+  std::array<long long, NumDimensions>     extent;
+
+  size_t size() const
+  {
+    size_t nelem = 1;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      nelem *= static_cast<size_t>(extent[d]);
+    }
+    return nelem;
+  }
+
+  /// Pieces are exchanged ordered by peer unit and block indices so that
+  /// sender and receiver agree on the layout of the packed data.
+  bool operator<(const redistribute_piece & other) const
+  {
+    return std::tie(peer, src_block, dst_block) <
+           std::tie(other.peer, other.src_block, other.dst_block);
+  }
+};
+
+/**
+ * Implementation of \c dash::redistribute and \c dash::transpose.
+ *
+ * Element \c (i_0, ..., i_n) of \c dst is assigned the element of \c src
+ * at coordinates \c i' with \c i'[perm[d]] = i_d.
+ */
+template <class SrcMatrixT, class DstMatrixT, std::size_t NumDimensions>
+void redistribute_permuted(
+  const SrcMatrixT                       & src,
+  DstMatrixT                             & dst,
+  const std::array<dim_t, NumDimensions> & perm,
+  const char                             * context)
+{
+  DASH_EVENT_TRACE_SCOPE("dash::redistribute");
+  typedef typename DstMatrixT::value_type        value_t;
+  typedef redistribute_piece<NumDimensions>      piece_t;
+  typedef std::array<long long, NumDimensions>   coords_t;
+
+  static_assert(
+    std::is_same<typename std::remove_const<
+                   typename SrcMatrixT::value_type>::type,
+                 value_t>::value,
+    "dash::redistribute requires identical element types");
+  static_assert(std::is_trivially_copyable<value_t>::value,
+                "dash::redistribute requires trivially copyable "
+                "element type");
+
+  auto & src_pattern = src.pattern();
+  auto & dst_pattern = dst.pattern();
+  auto & team        = dst.team();
+
+  DASH_LOG_DEBUG(context, "perm:", perm);
+  if (src.team().dart_id() != team.dart_id()) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      context << ": source and destination must be allocated in the "
+              << "same team");
+  }
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    if (dst_pattern.extent(d) != src_pattern.extent(perm[d])) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        context << ": extent " << dst_pattern.extent(d) << " of "
+                << "destination in dimension " << d << " does not match "
+                << "extent " << src_pattern.extent(perm[d]) << " of "
+                << "source in dimension " << perm[d]);
+    }
+  }
+  if (dst_pattern.size() == 0) {
+    return;
+  }
+
+  std::array<dim_t, NumDimensions> identity;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    identity[d] = d;
+  }
+  auto to_dst = [&](const coords_t & s) {
+    coords_t c;
+    for (dim_t d = 0; d < NumDimensions; ++d) { c[d] = s[perm[d]]; }
+    return c;
+  };
+  auto to_src = [&](const coords_t & c) {
+    coords_t s;
+    for (dim_t d = 0; d < NumDimensions; ++d) { s[perm[d]] = c[d]; }
+    return s;
+  };
+
+  dart_unit_t myid   = team.myid().id;
+  size_t      nunits = team.size();
+
+  // Pieces of local source blocks, by destination block:
+  std::vector<piece_t> send_pieces;
+  for (size_t lb = 0; lb < src_pattern.local_blockspec().size(); ++lb) {
+    auto     l_vs = src_pattern.local_block(lb);
+    coords_t l_offset;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      l_offset[d] = l_vs.offset(d);
+    }
+    // Use global block metadata, local block extents may be truncated:
+    long long s_block = block_index_at_coords(src_pattern, l_offset);
+    auto      s_vs    = src_pattern.block(s_block);
+    coords_t  s_offset;
+    coords_t  s_extent;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      s_offset[d] = s_vs.offset(d);
+      s_extent[d] = s_vs.extent(d);
+    }
+    coords_t offset = to_dst(s_offset);
+    coords_t extent = to_dst(s_extent);
+    for_each_block_in_rect(
+      dst_pattern, offset, extent,
+      [&](long long d_block, const coords_t & d_offset,
+          const coords_t & d_extent) {
+        piece_t piece;
+        if (!rect_intersect(offset, extent, d_offset, d_extent,
+                                    piece.offset, piece.extent)) {
+          return;
+        }
+        std::array<typename DstMatrixT::index_type, NumDimensions> c;
+        for (dim_t d = 0; d < NumDimensions; ++d) {
+          c[d] = d_offset[d];
+        }
+        piece.peer      = dst_pattern.unit_at(c).id;
+        piece.src_block = s_block;
+        piece.dst_block = d_block;
+        send_pieces.push_back(piece);
+      });
+  }
+
+  // Pieces of local destination blocks, by source block:
+  std::vector<piece_t> recv_pieces;
+  for (size_t lb = 0; lb < dst_pattern.local_blockspec().size(); ++lb) {
+    auto     l_vs = dst_pattern.local_block(lb);
+    coords_t l_offset;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      l_offset[d] = l_vs.offset(d);
+    }
+    long long d_block = block_index_at_coords(dst_pattern, l_offset);
+    auto      d_vs    = dst_pattern.block(d_block);
+    coords_t  d_offset;
+    coords_t  d_extent;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      d_offset[d] = d_vs.offset(d);
+      d_extent[d] = d_vs.extent(d);
+    }
+    coords_t offset = to_src(d_offset);
+    coords_t extent = to_src(d_extent);
+    for_each_block_in_rect(
+      src_pattern, offset, extent,
+      [&](long long s_block, const coords_t & s_offset,
+          const coords_t & s_extent) {
+        coords_t p_offset;
+        coords_t p_extent;
+        if (!rect_intersect(offset, extent, s_offset, s_extent,
+                                    p_offset, p_extent)) {
+          return;
+        }
+        std::array<typename SrcMatrixT::index_type, NumDimensions> c;
+        for (dim_t d = 0; d < NumDimensions; ++d) {
+          c[d] = s_offset[d];
+        }
+        dart_unit_t peer = src_pattern.unit_at(c).id;
+        if (peer == myid) {
+          // Copied locally by sender side:
+          return;
+        }
+        piece_t piece;
+        piece.peer      = peer;
+        piece.src_block = s_block;
+        piece.dst_block = d_block;
+        piece.offset    = to_dst(p_offset);
+        piece.extent    = to_dst(p_extent);
+        recv_pieces.push_back(piece);
+      });
+  }
+  std::sort(send_pieces.begin(), send_pieces.end());
+  std::sort(recv_pieces.begin(), recv_pieces.end());
+  DASH_LOG_TRACE(context, "pieces to send:", send_pieces.size(),
+                 "to receive:", recv_pieces.size());
+
+  const value_t * src_local = src.lbegin();
+  value_t       * dst_local = dst.lbegin();
+
+  // Pack send buffer, local pieces are copied directly:
+  std::vector<size_t> nsend(nunits, 0);
+  std::vector<size_t> send_displs(nunits, 0);
+  size_t nsend_total = 0;
+  for (const auto & piece : send_pieces) {
+    if (piece.peer != myid) {
+      nsend[piece.peer] += piece.size();
+      nsend_total       += piece.size();
+    }
+  }
+  std::vector<value_t> send_buf(nsend_total);
+  for (size_t u = 1; u < nunits; ++u) {
+    send_displs[u] = send_displs[u-1] + nsend[u-1];
+  }
+  size_t send_pos = 0;
+  for (const auto & piece : send_pieces) {
+    coords_t  src_strides;
+    long long src_base = block_local_strides(
+                           src_pattern, to_src(piece.offset), piece.extent,
+                           perm, src_strides);
+    if (piece.peer == myid) {
+      coords_t  dst_strides;
+      long long dst_base = block_local_strides(
+                             dst_pattern, piece.offset, piece.extent,
+                             identity, dst_strides);
+      copy_strided(
+        src_local + src_base, src_strides,
+        dst_local + dst_base, dst_strides,
+        piece.extent);
+    } else {
+      copy_strided(
+        src_local + src_base, src_strides,
+        send_buf.data() + send_pos,
+        packed_strides(piece.extent),
+        piece.extent);
+      send_pos += piece.size();
+    }
+  }
+
+  std::vector<size_t> nrecv(nunits, 0);
+  std::vector<size_t> recv_displs(nunits, 0);
+  size_t nrecv_total = 0;
+  for (const auto & piece : recv_pieces) {
+    nrecv[piece.peer] += piece.size();
+    nrecv_total       += piece.size();
+  }
+  for (size_t u = 1; u < nunits; ++u) {
+    recv_displs[u] = recv_displs[u-1] + nrecv[u-1];
+  }
+  std::vector<value_t> recv_buf(nrecv_total);
+
+  // Exchange counts and displacements in bytes:
+  for (size_t u = 0; u < nunits; ++u) {
+    nsend[u]       *= sizeof(value_t);
+    send_displs[u] *= sizeof(value_t);
+    nrecv[u]       *= sizeof(value_t);
+    recv_displs[u] *= sizeof(value_t);
+  }
+  // Units may keep all their elements locally, data() of empty buffers
+  // must not be passed as it may be NULL:
+  value_t send_dummy;
+  value_t recv_dummy;
+  DASH_ASSERT_RETURNS(
+    dart_alltoallv(send_buf.empty() ? &send_dummy : send_buf.data(),
+                   nsend.data(), send_displs.data(),
+                   DART_TYPE_BYTE,
+                   recv_buf.empty() ? &recv_dummy : recv_buf.data(),
+                   nrecv.data(), recv_displs.data(),
+                   team.dart_id()),
+    DART_OK);
+
+  // Unpack received pieces:
+  size_t recv_pos = 0;
+  for (const auto & piece : recv_pieces) {
+    coords_t  dst_strides;
+    long long dst_base = block_local_strides(
+                           dst_pattern, piece.offset, piece.extent,
+                           identity, dst_strides);
+    copy_strided(
+      recv_buf.data() + recv_pos,
+      packed_strides(piece.extent),
+      dst_local + dst_base, dst_strides,
+      piece.extent);
+    recv_pos += piece.size();
+  }
+
+  // Destination elements may be accessed remotely after return:
+  team.barrier();
+  DASH_LOG_DEBUG(context, "finished");
+}
+
+} // namespace internal
+
+/**
+ * Copies all elements of a distributed matrix or array to another matrix
+ * or array of identical extents but arbitrary pattern, e.g. from a
+ * blocked to a block-cyclic or tiled distribution.
+ *
+ * For every local block, units compute the intersections with the blocks
+ * of the other pattern from the patterns' block metadata.
+ * Every overlap is packed once and all overlaps are exchanged in a single
+ * all-to-all operation, no element is accessed one-sidedly.
+ *
+ * Collective operation, both containers must be allocated in the same
+ * team and the patterns must arrange blocks in a regular grid (block
+ * \c b in dimension \c d starts at element \c b * blocksize(d)).
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class SrcMatrixT, class DstMatrixT>
+void redistribute(
+  /// Source matrix or array.
+  const SrcMatrixT & src,
+  /// Destination matrix or array, must have the same extents as \c src.
+  DstMatrixT       & dst)
+{
+  constexpr dim_t ndim = DstMatrixT::pattern_type::ndim();
+  static_assert(SrcMatrixT::pattern_type::ndim() == ndim,
+                "dash::redistribute requires containers with identical "
+                "number of dimensions");
+  std::array<dim_t, ndim> perm;
+  for (dim_t d = 0; d < ndim; ++d) {
+    perm[d] = d;
+  }
+  dash::internal::redistribute_permuted(
+    src, dst, perm, "dash::redistribute()");
+}
+
+/**
+ * Transposes a distributed matrix: element \c (j, i) of \c dst is
+ * assigned element \c (i, j) of \c src.
+ * For matrices with more than two dimensions, the order of dimensions is
+ * reversed.
+ *
+ * The patterns of \c src and \c dst are arbitrary, data is exchanged
+ * like in \c dash::redistribute.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class SrcMatrixT, class DstMatrixT>
+void transpose(
+  /// Source matrix.
+  const SrcMatrixT & src,
+  /// Destination matrix, its extents must be those of \c src in reverse
+  /// order.
+  DstMatrixT       & dst)
+{
+  constexpr dim_t ndim = DstMatrixT::pattern_type::ndim();
+  static_assert(SrcMatrixT::pattern_type::ndim() == ndim,
+                "dash::transpose requires matrices with identical "
+                "number of dimensions");
+  std::array<dim_t, ndim> perm;
+  for (dim_t d = 0; d < ndim; ++d) {
+    perm[d] = ndim - 1 - d;
+  }
+  dash::internal::redistribute_permuted(
+    src, dst, perm, "dash::transpose()");
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REDISTRIBUTE_H__INCLUDED
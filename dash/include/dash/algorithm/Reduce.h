@@ -0,0 +1,444 @@
+#ifndef DASH__ALGORITHM__REDUCE_H__
+#define DASH__ALGORITHM__REDUCE_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/util/UnitLocality.h>
+#include <dash/internal/Logging.h>
+
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Whether values of the given type can be reduced by \c dart_allreduce.
+ */
+template <typename ValueType>
+struct is_dart_reducible
+: std::integral_constant<bool,
+    std::is_arithmetic<ValueType>::value &&
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED >
+{ };
+
+/**
+ * Identity element of a DART reduce operation on values of type
+ * \c ValueType. Operations without identity element, like
+ * \c DART_OP_REPLACE, cannot be used in DART reductions and are mapped to
+ * \c DART_OP_UNDEFINED.
+ */
+template <
+  dart_operation_t Op,
+  class            ValueType,
+  class            Enable = void >
+struct reduce_dart_identity {
+  static constexpr dart_operation_t value = DART_OP_UNDEFINED;
+};
+
+template <class ValueType>
+struct reduce_dart_identity<DART_OP_SUM, ValueType> {
+  static constexpr dart_operation_t value = DART_OP_SUM;
+  static ValueType identity() { return ValueType(0); }
+};
+
+template <class ValueType>
+struct reduce_dart_identity<DART_OP_PROD, ValueType> {
+  static constexpr dart_operation_t value = DART_OP_PROD;
+  static ValueType identity() { return ValueType(1); }
+};
+
+template <class ValueType>
+struct reduce_dart_identity<DART_OP_MIN, ValueType> {
+  static constexpr dart_operation_t value = DART_OP_MIN;
+  static ValueType identity() {
+    return std::numeric_limits<ValueType>::max();
+  }
+};
+
+template <class ValueType>
+struct reduce_dart_identity<DART_OP_MAX, ValueType> {
+  static constexpr dart_operation_t value = DART_OP_MAX;
+  static ValueType identity() {
+    return std::numeric_limits<ValueType>::lowest();
+  }
+};
+
+template <class ValueType>
+struct reduce_dart_identity<
+         DART_OP_BAND, ValueType,
+         typename std::enable_if<
+           std::is_integral<ValueType>::value >::type > {
+  static constexpr dart_operation_t value = DART_OP_BAND;
+  static ValueType identity() { return ~ValueType(0); }
+};
+
+template <class ValueType>
+struct reduce_dart_identity<
+         DART_OP_BOR, ValueType,
+         typename std::enable_if<
+           std::is_integral<ValueType>::value >::type > {
+  static constexpr dart_operation_t value = DART_OP_BOR;
+  static ValueType identity() { return ValueType(0); }
+};
+
+template <class ValueType>
+struct reduce_dart_identity<
+         DART_OP_BXOR, ValueType,
+         typename std::enable_if<
+           std::is_integral<ValueType>::value >::type > {
+  static constexpr dart_operation_t value = DART_OP_BXOR;
+  static ValueType identity() { return ValueType(0); }
+};
+
+/**
+ * DART reduce operation equivalent to a binary operation on values of type
+ * \c ValueType, and the operation's identity element.
+ * The DART operation is taken from \c dart_operation() of the binary
+ * operation, see \c dash::internal::has_dart_operation. Binary operations
+ * without an equivalent DART operation are mapped to
+ * \c DART_OP_UNDEFINED.
+ */
+template <
+  class BinaryOperation,
+  class ValueType,
+  class Enable = void >
+struct reduce_dart_operation {
+  static constexpr dart_operation_t value = DART_OP_UNDEFINED;
+};
+
+template <class BinaryOperation, class ValueType>
+struct reduce_dart_operation<
+         BinaryOperation, ValueType,
+         typename std::enable_if<
+           is_dart_reducible<ValueType>::value &&
+           has_dart_operation<BinaryOperation>::value >::type >
+: reduce_dart_identity<BinaryOperation().dart_operation(), ValueType>
+{ };
+
+template <class ValueType>
+struct reduce_dart_operation<std::plus<ValueType>, ValueType>
+: reduce_dart_operation<dash::plus<ValueType>, ValueType>
+{ };
+
+template <class ValueType>
+struct reduce_dart_operation<std::multiplies<ValueType>, ValueType>
+: reduce_dart_operation<dash::multiply<ValueType>, ValueType>
+{ };
+
+/**
+ * Partial result of a reduction, invalid if no values have been reduced.
+ */
+template <typename ValueType>
+struct reduce_partial {
+  ValueType value;
+  bool      valid;
+};
+
+template <typename ValueType, class BinaryOperation>
+reduce_partial<ValueType> reduce_combine(
+  const reduce_partial<ValueType> & lhs,
+  const reduce_partial<ValueType> & rhs,
+  BinaryOperation                   op)
+{
+  if (!lhs.valid) { return rhs; }
+  if (!rhs.valid) { return lhs; }
+  return reduce_partial<ValueType> { op(lhs.value, rhs.value), true };
+}
+
+/**
+ * Reduce the transformed values in a local range.
+ * The range is partitioned to OpenMP threads if available, partial results
+ * of partitions are combined in partition order.
+ *
+ * \return  The reduced value, invalid if the range is empty.
+ */
+template <
+  class ValueType,
+  class LocalInputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+reduce_partial<ValueType> local_transform_reduce(
+  LocalInputIt    l_first,
+  LocalInputIt    l_last,
+  BinaryOperation reduce_op,
+  UnaryOperation  transform_op)
+{
+  typedef reduce_partial<ValueType> partial_t;
+  auto l_size = std::distance(l_first, l_last);
+  if (l_size <= 0) {
+    return partial_t { ValueType(), false };
+  }
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto n_threads = uloc.num_domain_threads();
+  DASH_LOG_DEBUG("dash::local_transform_reduce",
+                 "thread capacity:", n_threads);
+  if (n_threads > 1 && l_size > n_threads) {
+    // Partial results are written once per thread so they do not have to
+    // be aligned to cache lines:
+    std::vector<partial_t> partials_t(
+                             n_threads,
+                             partial_t { ValueType(), false });
+    // Partitions are distributed to threads in a worksharing loop, so all
+    // partitions are reduced if fewer threads than requested are granted:
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for (int t = 0; t < n_threads; ++t) {
+      auto t_first = (l_size * t)       / n_threads;
+      auto t_last  = (l_size * (t + 1)) / n_threads;
+      if (t_first < t_last) {
+        ValueType t_value = transform_op(*(l_first + t_first));
+        for (auto i = t_first + 1; i < t_last; ++i) {
+          t_value = reduce_op(t_value, transform_op(*(l_first + i)));
+        }
+        partials_t[t] = partial_t { t_value, true };
+      }
+    }
+    partial_t l_result = partials_t[0];
+    for (int t = 1; t < n_threads; ++t) {
+      l_result = reduce_combine(l_result, partials_t[t], reduce_op);
+    }
+    return l_result;
+  }
+#endif // DASH_ENABLE_OPENMP
+  ValueType l_value = transform_op(*l_first);
+  for (auto it = std::next(l_first); it != l_last; ++it) {
+    l_value = reduce_op(l_value, transform_op(*it));
+  }
+  return partial_t { l_value, true };
+}
+
+/**
+ * Combine the partial results of all units in the team using
+ * \c dart_allreduce.
+ */
+template <class ValueType, class BinaryOperation>
+reduce_partial<ValueType> team_reduce(
+  const reduce_partial<ValueType> & l_result,
+  BinaryOperation                   op,
+  dash::Team                      & team,
+  std::true_type                    /* dart_reducible */)
+{
+  typedef reduce_dart_operation<BinaryOperation, ValueType> dart_op_t;
+  // Units with empty local range contribute the operation's identity:
+  ValueType l_value = l_result.valid ? l_result.value : dart_op_t::identity();
+  ValueType g_value;
+  DASH_LOG_TRACE("dash::team_reduce", "dart_allreduce()");
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_value,
+      &g_value,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      dart_op_t::value,
+      team.dart_id()),
+    DART_OK);
+  return reduce_partial<ValueType> { g_value, true };
+}
+
+/**
+ * Combine the partial results of all units in the team by recursive
+ * doubling.
+ * Units exceeding the greatest power of two in the team size fold their
+ * result into a partner unit first and receive the final result from it.
+ */
+template <class ValueType, class BinaryOperation>
+reduce_partial<ValueType> team_reduce(
+  const reduce_partial<ValueType> & l_result,
+  BinaryOperation                   op,
+  dash::Team                      & team,
+  std::false_type                   /* dart_reducible */)
+{
+  typedef reduce_partial<ValueType> partial_t;
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::reduce requires a trivially copyable value type "
+                "for reduce operations without DART equivalent");
+  const int tag    = 0;
+  int       nunits = team.size();
+  int       myid   = team.myid().id;
+  int       p2     = 1;
+  while (p2 * 2 <= nunits) {
+    p2 *= 2;
+  }
+  int nfold = nunits - p2;
+
+  auto g_unit = [&](int u) { return team.global_id(team_unit_t(u)); };
+
+  partial_t result = l_result;
+  partial_t recv_partial;
+  if (myid >= p2) {
+    DASH_ASSERT_RETURNS(
+      dart_send(&result, sizeof(partial_t), DART_TYPE_BYTE, tag,
+                g_unit(myid - p2)),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_recv(&result, sizeof(partial_t), DART_TYPE_BYTE, tag,
+                g_unit(myid - p2)),
+      DART_OK);
+    return result;
+  }
+  if (myid < nfold) {
+    DASH_ASSERT_RETURNS(
+      dart_recv(&recv_partial, sizeof(partial_t), DART_TYPE_BYTE, tag,
+                g_unit(myid + p2)),
+      DART_OK);
+    result = reduce_combine(result, recv_partial, op);
+  }
+  for (int mask = 1; mask < p2; mask <<= 1) {
+    int partner = myid ^ mask;
+    DASH_ASSERT_RETURNS(
+      dart_sendrecv(&result,       sizeof(partial_t), DART_TYPE_BYTE, tag,
+                    g_unit(partner),
+                    &recv_partial, sizeof(partial_t), DART_TYPE_BYTE, tag,
+                    g_unit(partner)),
+      DART_OK);
+    // Combine in unit order so all units obtain identical results:
+    result = (partner < myid)
+             ? reduce_combine(recv_partial, result, op)
+             : reduce_combine(result, recv_partial, op);
+  }
+  if (myid < nfold) {
+    DASH_ASSERT_RETURNS(
+      dart_send(&result, sizeof(partial_t), DART_TYPE_BYTE, tag,
+                g_unit(myid + p2)),
+      DART_OK);
+  }
+  return result;
+}
+
+} // namespace internal
+
+/**
+ * Reduce the values in range \c [first, last) transformed by
+ * \c transform_op using the binary operation \c reduce_op.
+ *
+ * Collective operation, the result is available at all units in the
+ * team of the range.
+ *
+ * Local values are reduced by OpenMP threads if available. If
+ * \c reduce_op has an equivalent \c dart_operation_t for the value type
+ * (e.g. \c dash::plus, \c dash::max), partial results of units are
+ * combined in a single \c dart_allreduce. Otherwise, they are combined by
+ * recursive doubling which requires a trivially copyable value type.
+ * No global memory is allocated.
+ *
+ * The reduce operation must be associative and commutative.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) t(in[0]) (+) t(in[1]) (+) ... (+) t(in[n])
+ *
+ * \see      dash::reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ValueType transform_reduce(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  ValueType       init,
+  BinaryOperation reduce_op,
+  UnaryOperation  transform_op)
+{
+  typedef internal::reduce_dart_operation<BinaryOperation, ValueType>
+    dart_op_t;
+  typedef std::integral_constant<bool,
+            dart_op_t::value != DART_OP_UNDEFINED>
+    dart_reducible;
+
+  auto & team      = first.team();
+  auto index_range = dash::local_range(first, last);
+  DASH_LOG_DEBUG("dash::transform_reduce()",
+                 "local range size:", index_range.end - index_range.begin);
+
+  auto l_result = internal::local_transform_reduce<ValueType>(
+                    index_range.begin, index_range.end,
+                    reduce_op, transform_op);
+  auto g_result = internal::team_reduce(
+                    l_result, reduce_op, team, dart_reducible());
+
+  ValueType result = g_result.valid ? reduce_op(init, g_result.value)
+                                    : init;
+  DASH_LOG_DEBUG_VAR("dash::transform_reduce >", result);
+  return result;
+}
+
+/**
+ * Reduce the values in range \c [first, last) using the binary
+ * operation \c op.
+ *
+ * Collective operation, the result is available at all units in the
+ * team of the range.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * \see      dash::transform_reduce
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+ValueType reduce(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  ValueType       init,
+  BinaryOperation op = BinaryOperation())
+{
+  typedef typename std::decay<
+    typename dash::iterator_traits<GlobInputIt>::value_type>::type value_t;
+  return dash::transform_reduce(
+           first, last, init, op,
+           [](const value_t & value) -> ValueType { return value; });
+}
+
+/**
+ * Sum of the values in range \c [first, last).
+ *
+ * Collective operation, the result is available at all units in the
+ * team of the range.
+ *
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobInputIt>
+typename std::decay<
+  typename dash::iterator_traits<GlobInputIt>::value_type>::type
+reduce(
+  GlobInputIt     first,
+  GlobInputIt     last)
+{
+  typedef typename std::decay<
+    typename dash::iterator_traits<GlobInputIt>::value_type>::type value_t;
+  return dash::reduce(first, last, value_t(), dash::plus<value_t>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REDUCE_H__
@@ -6,7 +6,10 @@
 #include <dash/Pattern.h>
 #include <dash/Future.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/internal/GEMM.h>
 #include <dash/util/Trace.h>
+#include <dash/util/EventTrace.h>
+#include <dash/util/Config.h>
 
 #include <utility>
 
@@ -49,43 +52,23 @@ void mmult_local(
   MemArrange        storage);
 #else
 /**
- * Naive matrix multiplication for local multiplication of matrix blocks,
- * used only for tests and where MKL is not available.
+ * Matrix multiplication for local multiplication of matrix blocks via the
+ * built-in blocked GEMM kernel, used where MKL and BLAS are not available.
  */
 template<typename ValueType>
 void mmult_local(
-  /// Matrix to multiply, extents n x m
+  /// Matrix to multiply, m rows by k columns.
   const ValueType * A,
-  /// Matrix to multiply, extents m x p
+  /// Matrix to multiply, k rows by n columns.
   const ValueType * B,
-  /// Matrix to contain the multiplication result, extents n x p
+  /// Matrix to contain the multiplication result, m rows by n columns.
   ValueType       * C,
   long long         m,
   long long         n,
-  long long         p,
+  long long         k,
   MemArrange        storage)
 {
-#ifndef DEBUG
-  DASH_THROW(
-    dash::exception::RuntimeError,
-    "Called fallback implementation of DGEMM (only enabled in Debug)");
-#endif
-  ValueType c_sum = 0;
-  for (auto i = 0; i < n; ++i) {
-    // row i = 0...n
-    for (auto j = 0; j < p; ++j) {
-      // column j = 0...p
-      c_sum = C[i * p + j]; // = C[j][i]
-      for (auto k = 0; k < m; ++k) {
-        // k = 0...m
-        auto ik     = i * m + k;
-        auto kj     = k * m + j;
-        auto value  = A[ik] * B[kj];
-        c_sum      += value;
-      }
-      C[i * p + j] = c_sum; // C[j][i] = c_sum
-    }
-  }
+  dash::internal::gemm(A, B, C, m, n, k, storage);
 }
 #endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 
@@ -157,6 +140,7 @@ void summa(
   /// initialized with zeros
   MatrixTypeC & C)
 {
+  DASH_EVENT_TRACE_SCOPE("dash::summa");
   typedef typename MatrixTypeA::value_type   value_type;
   typedef typename MatrixTypeA::index_type   index_t;
   typedef typename MatrixTypeA::size_type    extent_t;
@@ -240,12 +224,16 @@ void summa(
   auto pattern_a    = A.pattern();
   auto pattern_b    = B.pattern();
   auto pattern_c    = C.pattern();
-  auto m = pattern_a.extent(0); // number of columns in A, rows in B
 #if DASH_ENABLE_TRACE_LOGGING
+  auto m = pattern_a.extent(0); // number of columns in A, rows in B
   auto n = pattern_a.extent(1); // number of rows in A and C
   auto p = pattern_b.extent(0); // number of columns in B and C
 #endif
   const dash::MemArrange memory_order = pattern_a.memory_order();
+  // Use built-in GEMM kernel for local block multiplication even if MKL
+  // or BLAS is available:
+  const bool builtin_gemm = dash::util::Config::get<bool>(
+                              "DASH_SUMMA_BUILTIN_GEMM");
 
   DASH_ASSERT_EQ(
     pattern_a.extent(1),
@@ -272,17 +260,31 @@ void summa(
   auto block_size_m   = pattern_a.block(0).extent(0);
   auto block_size_n   = pattern_b.block(0).extent(1);
   auto block_size_p   = pattern_b.block(0).extent(0);
-  auto num_blocks_m   = m / block_size_m;
+  // Blocks of A and B must have identical extents in the inner dimension,
+  // otherwise prefetched blocks of B would overrun the local buffers:
+  if (pattern_a.block(0).extent(1) != block_size_p) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa(): "
+      "Block extents of first operand in dimension 1 do not match block "
+      "extents of second operand in dimension 0");
+  }
+  // Number of blocks in columns of A / rows of B:
+  auto num_blocks_k   = pattern_a.extent(1) / pattern_a.block(0).extent(1);
 #if DASH_ENABLE_TRACE_LOGGING
+  auto num_blocks_m   = m / block_size_m;
   auto num_blocks_n   = n / block_size_n;
   auto num_blocks_p   = p / block_size_p;
 #endif
   // Size of temporary local blocks
-  auto block_a_size   = block_size_n * block_size_m;
-  auto block_b_size   = block_size_m * block_size_p;
+  auto block_a_size   = block_size_m * block_size_p;
+  auto block_b_size   = block_size_p * block_size_n;
   // Number of units in rows and columns:
   auto teamspec       = C.pattern().teamspec();
   auto unit_ts_coords = teamspec.coords(unit_id);
+  // Every unit starts at a different block in the inner dimension:
+  index_t block_k_first = static_cast<index_t>(unit_ts_coords[0] %
+                                               num_blocks_k);
 
   DASH_LOG_TRACE("dash::summa", "blocks:",
                  "m:", num_blocks_m, "*", block_size_m,
@@ -331,18 +333,18 @@ void summa(
   auto     l_block_c_get       = C.local.block(0);
   auto     l_block_c_get_view  = l_block_c_get.begin().viewspec();
   index_t  l_block_c_get_row   = l_block_c_get_view.offset(1) / block_size_n;
-  index_t  l_block_c_get_col   = l_block_c_get_view.offset(0) / block_size_p;
+  index_t  l_block_c_get_col   = l_block_c_get_view.offset(0) / block_size_m;
   // Block coordinates of blocks in A and B to prefetch:
-  coords_t block_a_get_coords = coords_t {{ static_cast<index_t>(unit_ts_coords[0]),
-				   l_block_c_get_row }};
-  coords_t block_b_get_coords = coords_t {{ l_block_c_get_col,
-				   static_cast<index_t>(unit_ts_coords[0]) }};
+  coords_t block_a_get_coords = coords_t {{ l_block_c_get_col,
+                                            block_k_first }};
+  coords_t block_b_get_coords = coords_t {{ block_k_first,
+                                            l_block_c_get_row }};
   // Local block index of local submatrix of C for multiplication result of
   // currently prefetched blocks:
   auto     l_block_c_comp      = l_block_c_get;
   auto     l_block_c_comp_view = l_block_c_comp.begin().viewspec();
   index_t  l_block_c_comp_row  = l_block_c_comp_view.offset(1) / block_size_n;
-  index_t  l_block_c_comp_col  = l_block_c_comp_view.offset(0) / block_size_p;
+  index_t  l_block_c_comp_col  = l_block_c_comp_view.offset(0) / block_size_m;
   // Prefetch blocks from A and B for computation in next iteration:
   dash::Future<value_type *> get_a;
   dash::Future<value_type *> get_b;
@@ -425,7 +427,7 @@ void summa(
     l_block_c_comp      = C.local.block(lb);
     l_block_c_comp_view = l_block_c_comp.begin().viewspec();
     l_block_c_comp_row  = l_block_c_comp_view.offset(1) / block_size_n;
-    l_block_c_comp_col  = l_block_c_comp_view.offset(0) / block_size_p;
+    l_block_c_comp_col  = l_block_c_comp_view.offset(0) / block_size_m;
     // Block coordinates for next block multiplication result:
     l_block_c_get       = l_block_c_comp;
     l_block_c_get_view  = l_block_c_comp_view;
@@ -439,7 +441,7 @@ void summa(
     // -----------------------------------------------------------------------
     // Iterate blocks in columns of A / rows of B:
     // -----------------------------------------------------------------------
-    for (extent_t block_k = 0; block_k < num_blocks_m; ++block_k) {
+    for (extent_t block_k = 0; block_k < num_blocks_k; ++block_k) {
       DASH_LOG_TRACE("dash::summa", "summa.block.k", block_k,
                      "active local block in C:", lb);
 
@@ -448,23 +450,23 @@ void summa(
       // next iteration.
       // ---------------------------------------------------------------------
       bool last = (lb == num_local_blocks_c - 1) &&
-                  (block_k == num_blocks_m - 1);
+                  (block_k == num_blocks_k - 1);
       // Do not prefetch blocks in last iteration:
       if (!last) {
         index_t block_get_k = static_cast<index_t>(block_k + 1);
-        block_get_k = (block_get_k + unit_ts_coords[0]) % num_blocks_m;
+        block_get_k = (block_get_k + block_k_first) % num_blocks_k;
         // Block coordinate of local block in matrix C to prefetch:
-        if (block_k == num_blocks_m - 1) {
+        if (block_k == num_blocks_k - 1) {
           // Prefetch for next local block in matrix C:
-          block_get_k        = unit_ts_coords[0];
+          block_get_k        = block_k_first;
           l_block_c_get      = C.local.block(lb + 1);
           l_block_c_get_view = l_block_c_get.begin().viewspec();
           l_block_c_get_row  = l_block_c_get_view.offset(1) / block_size_n;
-          l_block_c_get_col  = l_block_c_get_view.offset(0) / block_size_p;
+          l_block_c_get_col  = l_block_c_get_view.offset(0) / block_size_m;
         }
         // Block coordinates of blocks in A and B to prefetch:
-        block_a_get_coords = coords_t {{ block_get_k, l_block_c_get_row }};
-        block_b_get_coords = coords_t {{ l_block_c_get_col, block_get_k }};
+        block_a_get_coords = coords_t {{ l_block_c_get_col, block_get_k }};
+        block_b_get_coords = coords_t {{ block_get_k, l_block_c_get_row }};
 
         block_a      = A.block(block_a_get_coords);
         block_a_lptr = block_a.begin().local();
@@ -512,14 +514,25 @@ void summa(
                      "view:", l_block_c_comp.begin().viewspec());
 
       trace.enter_state("multiply");
-      dash::internal::mmult_local<value_type>(
-          local_block_a_comp,
-          local_block_b_comp,
-          l_block_c_comp.begin().local(),
-          block_size_m,
-          block_size_n,
-          block_size_p,
-          memory_order);
+      if (builtin_gemm) {
+        dash::internal::gemm<value_type>(
+            local_block_a_comp,
+            local_block_b_comp,
+            l_block_c_comp.begin().local(),
+            block_size_m,
+            block_size_n,
+            block_size_p,
+            memory_order);
+      } else {
+        dash::internal::mmult_local<value_type>(
+            local_block_a_comp,
+            local_block_b_comp,
+            l_block_c_comp.begin().local(),
+            block_size_m,
+            block_size_n,
+            block_size_p,
+            memory_order);
+      }
       trace.exit_state("multiply");
 
       if (local_block_a_comp_bac != nullptr) {
@@ -0,0 +1,542 @@
+#ifndef DASH__ALGORITHM__SUMMA_25D_H_
+#define DASH__ALGORITHM__SUMMA_25D_H_
+
+#include <dash/Exception.h>
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Future.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/internal/GEMM.h>
+#include <dash/util/Trace.h>
+#include <dash/util/EventTrace.h>
+#include <dash/util/Config.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Assignment of a unit to its replication layer and to its position in
+ * the 2-dimensional grid of units in the layer in \c dash::summa_25d.
+ *
+ * The number of layers is the greatest divisor of the team size that
+ * does not exceed the requested replication factor, so all layers have
+ * the same grid of units. Layers consist of contiguous unit ranks.
+ * Units at the same grid position in all layers form a fiber.
+ */
+struct summa_25d_plan
+{
+  /// Number of replication layers.
+  long long num_layers;
+  /// Index of the unit's replication layer.
+  long long layer;
+  /// Number of units in every replication layer.
+  long long layer_size;
+  /// Extents of the grid of units in a layer.
+  long long grid_rows;
+  long long grid_cols;
+  /// Position of the unit in the grid of its layer.
+  long long grid_row;
+  long long grid_col;
+  /// Block rows of A and C assigned to the unit, [row_begin, row_end).
+  long long row_begin;
+  long long row_end;
+  /// Block columns of B and C assigned to the unit, [col_begin, col_end).
+  long long col_begin;
+  long long col_end;
+  /// Blocks in the inner dimension multiplied in the unit's layer,
+  /// [k_begin, k_end).
+  long long k_begin;
+  long long k_end;
+  /// Blocks in the inner dimension of the unit's tile of A,
+  /// [a_k_begin, a_k_end).
+  long long a_k_begin;
+  long long a_k_end;
+  /// Blocks in the inner dimension of the unit's tile of B,
+  /// [b_k_begin, b_k_end).
+  long long b_k_begin;
+  long long b_k_end;
+
+  long long num_rows() const { return row_end - row_begin; }
+  long long num_cols() const { return col_end - col_begin; }
+
+  /// Rank of the unit at the given layer and grid position in the team.
+  long long rank(long long l, long long row, long long col) const {
+    return l * layer_size + row * grid_cols + col;
+  }
+};
+
+/**
+ * First index of part \c part of \c parts balanced parts of the range
+ * \c [0, n).
+ */
+inline long long summa_25d_part_begin(
+  long long n,
+  long long parts,
+  long long part)
+{
+  return (part * n) / parts;
+}
+
+/**
+ * Part of \c parts balanced parts of the range \c [0, n) containing
+ * index \c i.
+ */
+inline long long summa_25d_part_of(
+  long long n,
+  long long parts,
+  long long i)
+{
+  return ((i + 1) * parts - 1) / n;
+}
+
+/**
+ * Creates the \c dash::summa_25d assignment of the unit with the given
+ * rank in a team of \c team_size units for a block grid of \c nb_rows x
+ * \c nb_k blocks in A and \c nb_k x \c nb_cols blocks in B.
+ */
+inline summa_25d_plan summa_25d_make_plan(
+  long long nb_rows,
+  long long nb_cols,
+  long long nb_k,
+  long long team_rank,
+  long long team_size,
+  long long replication)
+{
+  summa_25d_plan plan;
+  replication = std::max<long long>(1,
+                  std::min<long long>(replication, team_size));
+  plan.num_layers = 1;
+  for (long long c = replication; c > 1; --c) {
+    if (team_size % c == 0) {
+      plan.num_layers = c;
+      break;
+    }
+  }
+  plan.layer_size = team_size / plan.num_layers;
+  plan.layer      = team_rank / plan.layer_size;
+  // Most square grid of units in the layer:
+  plan.grid_rows  = 1;
+  for (long long d = 1; d * d <= plan.layer_size; ++d) {
+    if (plan.layer_size % d == 0) {
+      plan.grid_rows = d;
+    }
+  }
+  plan.grid_cols  = plan.layer_size / plan.grid_rows;
+  plan.grid_row   = (team_rank % plan.layer_size) / plan.grid_cols;
+  plan.grid_col   = (team_rank % plan.layer_size) % plan.grid_cols;
+
+  plan.row_begin  = summa_25d_part_begin(nb_rows, plan.grid_rows,
+                                         plan.grid_row);
+  plan.row_end    = summa_25d_part_begin(nb_rows, plan.grid_rows,
+                                         plan.grid_row + 1);
+  plan.col_begin  = summa_25d_part_begin(nb_cols, plan.grid_cols,
+                                         plan.grid_col);
+  plan.col_end    = summa_25d_part_begin(nb_cols, plan.grid_cols,
+                                         plan.grid_col + 1);
+  plan.k_begin    = summa_25d_part_begin(nb_k, plan.num_layers,
+                                         plan.layer);
+  plan.k_end      = summa_25d_part_begin(nb_k, plan.num_layers,
+                                         plan.layer + 1);
+  plan.a_k_begin  = summa_25d_part_begin(nb_k, plan.grid_cols,
+                                         plan.grid_col);
+  plan.a_k_end    = summa_25d_part_begin(nb_k, plan.grid_cols,
+                                         plan.grid_col + 1);
+  plan.b_k_begin  = summa_25d_part_begin(nb_k, plan.grid_rows,
+                                         plan.grid_row);
+  plan.b_k_end    = summa_25d_part_begin(nb_k, plan.grid_rows,
+                                         plan.grid_row + 1);
+  return plan;
+}
+
+/**
+ * Creates a DART team of the units with the given ranks in \c team.
+ * Collective operation on \c team, units may specify disjoint sets of
+ * ranks. No team is created for a single unit, \c DART_TEAM_NULL is
+ * returned instead.
+ */
+inline dart_team_t summa_25d_create_team(
+  dash::Team                   & team,
+  const std::vector<long long> & ranks)
+{
+  dart_group_t group;
+  dart_team_t  subteam = DART_TEAM_NULL;
+  DASH_ASSERT_RETURNS(dart_group_create(&group), DART_OK);
+  // Units in singleton sets join the collective with an empty group:
+  if (ranks.size() > 1) {
+    for (auto rank : ranks) {
+      DASH_ASSERT_RETURNS(
+        dart_group_addmember(
+          group,
+          team.global_id(
+            dash::team_unit_t(static_cast<dart_unit_t>(rank)))),
+        DART_OK);
+    }
+  }
+  DASH_ASSERT_RETURNS(
+    dart_team_create(team.dart_id(), group, &subteam),
+    DART_OK);
+  DASH_ASSERT_RETURNS(dart_group_destroy(&group), DART_OK);
+  return subteam;
+}
+
+/**
+ * Id of the unit with the given rank in \c team in its subteam
+ * \c subteam.
+ */
+inline dart_team_unit_t summa_25d_subteam_unit(
+  dash::Team  & team,
+  dart_team_t   subteam,
+  long long     rank)
+{
+  dart_team_unit_t unit;
+  DASH_ASSERT_RETURNS(
+    dart_team_unit_g2l(
+      subteam,
+      team.global_id(dash::team_unit_t(static_cast<dart_unit_t>(rank))),
+      &unit),
+    DART_OK);
+  return unit;
+}
+
+} // namespace internal
+
+/**
+ * Multiplies two matrices using the communication-avoiding 2.5D variant
+ * of the SUMMA algorithm.
+ *
+ * The units of the result matrix's team are arranged in \c c layers of
+ * identical 2-dimensional grids, where \c c is the greatest divisor of
+ * the team size not exceeding \c replication, see
+ * \c internal::summa_25d_make_plan.
+ * Units in the first layer load their tiles of A and B in the 2D SUMMA
+ * distribution and broadcast them to the units at the same grid position
+ * in the other layers, so the operands are replicated in every layer.
+ * Every layer then runs SUMMA on its slice of the inner dimension,
+ * broadcasting panels of A within rows and panels of B within columns of
+ * its grid. Partial results are reduced across layers to the first
+ * layer, which accumulates them into C like \c dash::summa.
+ *
+ * For \c P units, every unit communicates
+ * \c O(n^2 / sqrt(P * c)) elements in the SUMMA phase instead of
+ * \c O(n^2 / sqrt(P)) at the cost of \c c times the memory for operand
+ * tiles.
+ * Row, column and layer fiber teams are created from the team of C and
+ * destroyed before the function returns. They are created as DART teams
+ * instead of using \c dash::Team::split: a team can only be split once
+ * and only into chunks of contiguous units, but fibers, grid rows and
+ * grid columns are three different partitions of the team, and units in
+ * fibers and grid columns are not contiguous.
+ * Same matrix constraints as \c dash::summa.
+ */
+template<
+  typename MatrixTypeA,
+  typename MatrixTypeB,
+  typename MatrixTypeC
+>
+void summa_25d(
+  /// Matrix to multiply, extents n x m
+  MatrixTypeA & A,
+  /// Matrix to multiply, extents m x p
+  MatrixTypeB & B,
+  /// Matrix to contain the multiplication result, extents n x p,
+  /// initialized with zeros
+  MatrixTypeC & C,
+  /// Requested number of replication layers, summa_25d with a single
+  /// layer corresponds to 2D SUMMA
+  unsigned      replication)
+{
+  DASH_EVENT_TRACE_SCOPE("dash::summa_25d");
+  typedef typename MatrixTypeA::value_type   value_type;
+  typedef typename MatrixTypeA::index_type   index_t;
+  typedef std::array<index_t, 2>             coords_t;
+
+  static_assert(
+      std::is_floating_point<value_type>::value,
+      "dash::summa_25d expects matrix element type double or float");
+
+  DASH_LOG_DEBUG("dash::summa_25d()", "replication:", replication);
+  if (replication == 0) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_25d(): replication factor must be greater than 0");
+  }
+  if (!dash::check_pattern_constraints<
+         summa_pattern_partitioning_constraints,
+         summa_pattern_mapping_constraints,
+         summa_pattern_layout_constraints
+       >(A.pattern()) ||
+      !dash::check_pattern_constraints<
+         summa_pattern_partitioning_constraints,
+         summa_pattern_mapping_constraints,
+         summa_pattern_layout_constraints
+       >(B.pattern()) ||
+      !dash::check_pattern_constraints<
+         summa_pattern_partitioning_constraints,
+         summa_pattern_mapping_constraints,
+         summa_pattern_layout_constraints
+       >(C.pattern())) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_25d(): "
+      "matrix patterns do not match SUMMA constraints");
+  }
+
+  const auto & pattern_a = A.pattern();
+  const auto & pattern_b = B.pattern();
+  const dash::MemArrange memory_order = pattern_a.memory_order();
+  const bool builtin_gemm = dash::util::Config::get<bool>(
+                              "DASH_SUMMA_BUILTIN_GEMM");
+  const dart_datatype_t dtype = dash::dart_datatype<value_type>::value;
+
+  // Extents of blocks in A (bm x bk), B (bk x bn) and C (bm x bn):
+  long long bm   = pattern_a.block(0).extent(0);
+  long long bk   = pattern_a.block(0).extent(1);
+  long long bn   = pattern_b.block(0).extent(1);
+  DASH_ASSERT_EQ(
+    static_cast<long long>(pattern_b.block(0).extent(0)), bk,
+    "dash::summa_25d(): "
+    "Block extents of first operand in dimension 1 do not match block "
+    "extents of second operand in dimension 0");
+  long long nb_m = pattern_a.extent(0) / bm;
+  long long nb_k = pattern_a.extent(1) / bk;
+  long long nb_n = pattern_b.extent(1) / bn;
+
+  dash::Team & team = C.team();
+  auto plan = internal::summa_25d_make_plan(
+                nb_m, nb_n, nb_k, team.myid().id, team.size(), replication);
+  DASH_LOG_TRACE("dash::summa_25d", "layer:", plan.layer,
+                 "of", plan.num_layers,
+                 "grid:", plan.grid_row, ",", plan.grid_col,
+                 "rows:", plan.row_begin, "-", plan.row_end,
+                 "cols:", plan.col_begin, "-", plan.col_end,
+                 "k:",    plan.k_begin,   "-", plan.k_end);
+
+  dash::util::Trace trace("SUMMA25D");
+
+  // -------------------------------------------------------------------------
+  // Teams of the fiber, grid row and grid column of the unit:
+  // -------------------------------------------------------------------------
+  trace.enter_state("teams");
+  std::vector<long long> ranks;
+  for (long long l = 0; l < plan.num_layers; ++l) {
+    ranks.push_back(plan.rank(l, plan.grid_row, plan.grid_col));
+  }
+  dart_team_t fiber_team = internal::summa_25d_create_team(team, ranks);
+  ranks.clear();
+  for (long long col = 0; col < plan.grid_cols; ++col) {
+    ranks.push_back(plan.rank(plan.layer, plan.grid_row, col));
+  }
+  dart_team_t row_team   = internal::summa_25d_create_team(team, ranks);
+  ranks.clear();
+  for (long long row = 0; row < plan.grid_rows; ++row) {
+    ranks.push_back(plan.rank(plan.layer, row, plan.grid_col));
+  }
+  dart_team_t col_team   = internal::summa_25d_create_team(team, ranks);
+  dart_team_unit_t fiber_root = DART_UNDEFINED_TEAM_UNIT_ID;
+  if (plan.num_layers > 1) {
+    fiber_root = internal::summa_25d_subteam_unit(
+                   team, fiber_team,
+                   plan.rank(0, plan.grid_row, plan.grid_col));
+  }
+  trace.exit_state("teams");
+
+  // Tiles of A (block rows of the unit x blocks in the inner dimension
+  // of the grid column) and B (blocks in the inner dimension of the grid
+  // row x block columns of the unit) in the 2D SUMMA distribution.
+  // Blocks are stored by index in the inner dimension so every panel
+  // broadcast in a SUMMA step is contiguous.
+  const long long block_a_size = bm * bk;
+  const long long block_b_size = bk * bn;
+  const long long block_c_size = bm * bn;
+  const long long panel_a_size = plan.num_rows() * block_a_size;
+  const long long panel_b_size = plan.num_cols() * block_b_size;
+  std::vector<value_type> tile_a((plan.a_k_end - plan.a_k_begin) *
+                                 panel_a_size);
+  std::vector<value_type> tile_b((plan.b_k_end - plan.b_k_begin) *
+                                 panel_b_size);
+  std::vector<value_type> panel_a(panel_a_size);
+  std::vector<value_type> panel_b(panel_b_size);
+  std::vector<value_type> partial_c(plan.num_rows() * plan.num_cols() *
+                                    block_c_size, value_type(0));
+
+  // -------------------------------------------------------------------------
+  // Load tiles of A and B in the first layer:
+  // -------------------------------------------------------------------------
+  trace.enter_state("fetch");
+  if (plan.layer == 0) {
+    std::vector< dash::Future<value_type *> > gets;
+    for (long long k = plan.a_k_begin; k < plan.a_k_end; ++k) {
+      for (long long i = plan.row_begin; i < plan.row_end; ++i) {
+        auto block = A.block(coords_t {{ static_cast<index_t>(i),
+                                         static_cast<index_t>(k) }});
+        auto l_off = (k - plan.a_k_begin) * panel_a_size +
+                     (i - plan.row_begin) * block_a_size;
+        gets.push_back(dash::copy_async(block.begin(), block.end(),
+                                        tile_a.data() + l_off));
+      }
+    }
+    for (long long k = plan.b_k_begin; k < plan.b_k_end; ++k) {
+      for (long long j = plan.col_begin; j < plan.col_end; ++j) {
+        auto block = B.block(coords_t {{ static_cast<index_t>(k),
+                                         static_cast<index_t>(j) }});
+        auto l_off = (k - plan.b_k_begin) * panel_b_size +
+                     (j - plan.col_begin) * block_b_size;
+        gets.push_back(dash::copy_async(block.begin(), block.end(),
+                                        tile_b.data() + l_off));
+      }
+    }
+    for (auto & get : gets) {
+      get.wait();
+    }
+  }
+  trace.exit_state("fetch");
+
+  // -------------------------------------------------------------------------
+  // Replicate tiles of A and B across layers:
+  // -------------------------------------------------------------------------
+  trace.enter_state("replicate");
+  if (plan.num_layers > 1) {
+    if (!tile_a.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_bcast(tile_a.data(), tile_a.size(), dtype, fiber_root,
+                   fiber_team),
+        DART_OK);
+    }
+    if (!tile_b.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_bcast(tile_b.data(), tile_b.size(), dtype, fiber_root,
+                   fiber_team),
+        DART_OK);
+    }
+  }
+  trace.exit_state("replicate");
+
+  // -------------------------------------------------------------------------
+  // SUMMA on the layer's slice of the inner dimension:
+  // -------------------------------------------------------------------------
+  for (long long k = plan.k_begin; k < plan.k_end; ++k) {
+    // Grid column owning the panel of A and grid row owning the panel
+    // of B in the inner dimension k:
+    long long a_owner = internal::summa_25d_part_of(
+                          nb_k, plan.grid_cols, k);
+    long long b_owner = internal::summa_25d_part_of(
+                          nb_k, plan.grid_rows, k);
+    value_type * block_a_panel = panel_a.data();
+    value_type * block_b_panel = panel_b.data();
+    if (a_owner == plan.grid_col) {
+      block_a_panel = tile_a.data() +
+                      (k - plan.a_k_begin) * panel_a_size;
+    }
+    if (b_owner == plan.grid_row) {
+      block_b_panel = tile_b.data() +
+                      (k - plan.b_k_begin) * panel_b_size;
+    }
+
+    trace.enter_state("bcast");
+    if (plan.grid_cols > 1 && panel_a_size > 0) {
+      DASH_ASSERT_RETURNS(
+        dart_bcast(block_a_panel, panel_a_size, dtype,
+                   internal::summa_25d_subteam_unit(
+                     team, row_team,
+                     plan.rank(plan.layer, plan.grid_row, a_owner)),
+                   row_team),
+        DART_OK);
+    }
+    if (plan.grid_rows > 1 && panel_b_size > 0) {
+      DASH_ASSERT_RETURNS(
+        dart_bcast(block_b_panel, panel_b_size, dtype,
+                   internal::summa_25d_subteam_unit(
+                     team, col_team,
+                     plan.rank(plan.layer, b_owner, plan.grid_col)),
+                   col_team),
+        DART_OK);
+    }
+    trace.exit_state("bcast");
+
+    trace.enter_state("multiply");
+    for (long long i = 0; i < plan.num_rows(); ++i) {
+      for (long long j = 0; j < plan.num_cols(); ++j) {
+        value_type * block_c = partial_c.data() +
+                               (i * plan.num_cols() + j) * block_c_size;
+        const value_type * block_a = block_a_panel + i * block_a_size;
+        const value_type * block_b = block_b_panel + j * block_b_size;
+        if (builtin_gemm) {
+          dash::internal::gemm<value_type>(
+            block_a, block_b, block_c, bm, bn, bk, memory_order);
+        } else {
+          dash::internal::mmult_local<value_type>(
+            block_a, block_b, block_c, bm, bn, bk, memory_order);
+        }
+      }
+    }
+    trace.exit_state("multiply");
+  }
+
+  // -------------------------------------------------------------------------
+  // Reduce partial results across layers to the first layer:
+  // -------------------------------------------------------------------------
+  trace.enter_state("reduce");
+  std::vector<value_type> result_c;
+  if (plan.num_layers > 1 && !partial_c.empty()) {
+    if (plan.layer == 0) {
+      result_c.resize(partial_c.size());
+    }
+    DASH_ASSERT_RETURNS(
+      dart_reduce(partial_c.data(), result_c.data(), partial_c.size(),
+                  dtype, DART_OP_SUM, fiber_root, fiber_team),
+      DART_OK);
+  } else {
+    result_c.swap(partial_c);
+  }
+  trace.exit_state("reduce");
+
+  // -------------------------------------------------------------------------
+  // Accumulate results of the first layer into C:
+  // -------------------------------------------------------------------------
+  trace.enter_state("store");
+  if (plan.layer == 0) {
+    for (long long i = plan.row_begin; i < plan.row_end; ++i) {
+      for (long long j = plan.col_begin; j < plan.col_end; ++j) {
+        auto block = C.block(coords_t {{ static_cast<index_t>(i),
+                                         static_cast<index_t>(j) }});
+        const value_type * block_c = result_c.data() +
+                                     ((i - plan.row_begin) *
+                                      plan.num_cols() +
+                                      (j - plan.col_begin)) * block_c_size;
+        // Blocks are contiguous in the owner's local memory:
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(
+            block.begin().dart_gptr(),
+            block_c,
+            block_c_size,
+            dtype,
+            DART_OP_SUM),
+          DART_OK);
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_flush_all(C.begin().dart_gptr()),
+      DART_OK);
+  }
+  trace.exit_state("store");
+
+  DASH_ASSERT_RETURNS(dart_team_destroy(&col_team),   DART_OK);
+  DASH_ASSERT_RETURNS(dart_team_destroy(&row_team),   DART_OK);
+  DASH_ASSERT_RETURNS(dart_team_destroy(&fiber_team), DART_OK);
+
+  trace.enter_state("barrier");
+  C.barrier();
+  trace.exit_state("barrier");
+  DASH_LOG_TRACE("dash::summa_25d >", "finished");
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SUMMA_25D_H_
@@ -0,0 +1,829 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/util/UnitLocality.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Block of the local portion of a global range that is contiguous in
+ * global index space.
+ */
+struct scan_block {
+  /// Index of the block's first element in local memory.
+  int64_t l_index;
+  /// Offset of the block's first element relative to the beginning of
+  /// the global range.
+  int64_t offset;
+  /// Number of elements in the block.
+  int64_t size;
+};
+
+/**
+ * Resolve the local portion of the global range \c [first, last) at the
+ * active unit as blocks that are contiguous in global index space,
+ * ordered by their index in local memory.
+ * Adjacent blocks of the pattern are merged, so the local portion of
+ * one-dimensional blocked patterns consists of a single block.
+ */
+template <class GlobIter>
+std::vector<scan_block> scan_local_blocks(
+  GlobIter first,
+  GlobIter last)
+{
+  typedef typename GlobIter::pattern_type pattern_t;
+  typedef typename pattern_t::index_type  index_t;
+  auto &  pattern = first.pattern();
+  int64_t l_size  = pattern.local_size();
+  int64_t g_first = static_cast<int64_t>(first.gpos());
+  int64_t g_last  = g_first + (last - first);
+  // Global indices increase with local indices in one-dimensional
+  // patterns and elements of a block are contiguous in local memory, so
+  // local elements are traversed block by block. Otherwise, local
+  // elements are not ordered in global index space and are traversed
+  // one by one:
+  bool    ordered = (pattern_t::ndim() == 1);
+  int64_t bsize   = ordered ? static_cast<int64_t>(pattern.blocksize(0))
+                            : 1;
+  std::vector<scan_block> blocks;
+  for (int64_t l = 0; l < l_size; ) {
+    int64_t g   = pattern.global(static_cast<index_t>(l));
+    if (ordered && g >= g_last) {
+      break;
+    }
+    int64_t len = std::min<int64_t>(bsize - g % bsize, l_size - l);
+    if (len > 1 &&
+        pattern.global(static_cast<index_t>(l + len - 1)) != g + len - 1) {
+      len = 1;
+    }
+    // Intersection of the block with the global range:
+    int64_t g_begin = std::max<int64_t>(g, g_first);
+    int64_t g_end   = std::min<int64_t>(g + len, g_last);
+    if (g_begin < g_end) {
+      int64_t l_begin = l + (g_begin - g);
+      if (!blocks.empty() &&
+          blocks.back().l_index + blocks.back().size == l_begin &&
+          blocks.back().offset  + blocks.back().size == g_begin - g_first) {
+        blocks.back().size += g_end - g_begin;
+      } else {
+        blocks.push_back(
+          scan_block { l_begin, g_begin - g_first, g_end - g_begin });
+      }
+    }
+    l += len;
+  }
+  return blocks;
+}
+
+/**
+ * Whether every unit holds at most a single block of the pattern and
+ * blocks are assigned to units in ascending unit order, as in
+ * one-dimensional blocked patterns.
+ * In this case, the local portions of every range are contiguous and
+ * ordered by unit id so units can be combined in a DART prefix reduction.
+ * Only depends on the pattern and therefore evaluates to the same result
+ * at all units.
+ */
+template <class PatternType>
+bool scan_blocks_in_unit_order(const PatternType & pattern)
+{
+  typedef typename PatternType::index_type index_t;
+  if (PatternType::ndim() != 1) {
+    return false;
+  }
+  auto nblocks = pattern.blockspec().size();
+  if (nblocks > pattern.team().size()) {
+    return false;
+  }
+  for (index_t b = 0; b < static_cast<index_t>(nblocks); ++b) {
+    std::array<index_t, PatternType::ndim()> block_coords;
+    block_coords[0] = pattern.block(b).offset(0);
+    if (pattern.unit_at(block_coords).id != b) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Number of threads to scan a local range of the given size.
+ */
+inline int scan_num_threads(int64_t l_size)
+{
+#ifdef DASH_ENABLE_OPENMP
+  // Partitions should not be smaller than a few pages:
+  const int64_t min_partition_size = 1 << 12;
+  dash::util::UnitLocality uloc;
+  return static_cast<int>(
+           std::max<int64_t>(
+             1, std::min<int64_t>(uloc.num_domain_threads(),
+                                  l_size / min_partition_size)));
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Reduce the transformed values in the local range
+ * \c [l_first + begin, l_first + end) sequentially.
+ *
+ * \return  The reduced value, invalid for an empty range.
+ */
+template <
+  class ValueType,
+  class LocalInputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+reduce_partial<ValueType> local_scan_total(
+  LocalInputIt    l_first,
+  int64_t         begin,
+  int64_t         end,
+  BinaryOperation scan_op,
+  UnaryOperation  transform_op)
+{
+  if (begin >= end) {
+    return reduce_partial<ValueType> { ValueType(), false };
+  }
+  ValueType value = transform_op(*(l_first + begin));
+  for (auto i = begin + 1; i < end; ++i) {
+    value = scan_op(value, transform_op(*(l_first + i)));
+  }
+  return reduce_partial<ValueType> { value, true };
+}
+
+/**
+ * Reduce the transformed values in the partitions of a local range that
+ * are scanned by individual threads.
+ *
+ * \return  The reduced values of the partitions in partition order, invalid
+ *          for empty partitions.
+ */
+template <
+  class ValueType,
+  class LocalInputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+std::vector<reduce_partial<ValueType>> local_scan_partials(
+  LocalInputIt    l_first,
+  int64_t         l_size,
+  int             n_threads,
+  BinaryOperation scan_op,
+  UnaryOperation  transform_op)
+{
+  std::vector<reduce_partial<ValueType>> partials(n_threads);
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int t = 0; t < n_threads; ++t) {
+    // Reduce sequentially, this loop is already executed by a team of
+    // threads:
+    partials[t] = local_scan_total<ValueType>(
+                    l_first,
+                    (l_size * t)       / n_threads,
+                    (l_size * (t + 1)) / n_threads,
+                    scan_op, transform_op);
+  }
+  return partials;
+}
+
+/**
+ * Scan the transformed values in the local range
+ * \c [l_first + begin, l_first + end) sequentially, starting from the
+ * given prefix.
+ * Input and output range may be identical.
+ */
+template <
+  class ValueType,
+  class LocalInputIt,
+  class LocalOutputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+void local_transform_scan_range(
+  LocalInputIt                      l_first,
+  int64_t                           begin,
+  int64_t                           end,
+  LocalOutputIt                     l_out,
+  const reduce_partial<ValueType> & l_prefix,
+  BinaryOperation                   scan_op,
+  UnaryOperation                    transform_op,
+  bool                              inclusive)
+{
+  if (begin >= end) {
+    return;
+  }
+  auto acc = l_prefix;
+  if (!acc.valid) {
+    // Only possible in inclusive scans without initial value:
+    acc = reduce_partial<ValueType> {
+            transform_op(*(l_first + begin)), true };
+    *(l_out + begin) = acc.value;
+    ++begin;
+  }
+  ValueType value = acc.value;
+  if (inclusive) {
+    for (auto i = begin; i < end; ++i) {
+      value = scan_op(value, transform_op(*(l_first + i)));
+      *(l_out + i) = value;
+    }
+  } else {
+    for (auto i = begin; i < end; ++i) {
+      // Read input value before it is overwritten in in-place scans:
+      ValueType in_value = transform_op(*(l_first + i));
+      *(l_out + i) = value;
+      value = scan_op(value, in_value);
+    }
+  }
+}
+
+/**
+ * Scan the transformed values in a local range, starting from the given
+ * prefix.
+ * The range is partitioned to threads as in \c local_scan_partials.
+ * Input and output range may be identical.
+ */
+template <
+  class ValueType,
+  class LocalInputIt,
+  class LocalOutputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+void local_transform_scan(
+  LocalInputIt                                   l_first,
+  int64_t                                        l_size,
+  LocalOutputIt                                  l_out,
+  const reduce_partial<ValueType>              & l_prefix,
+  const std::vector<reduce_partial<ValueType>> & partials,
+  BinaryOperation                                scan_op,
+  UnaryOperation                                 transform_op,
+  bool                                           inclusive)
+{
+  int n_threads = static_cast<int>(partials.size());
+  // Prefix of every partition:
+  std::vector<reduce_partial<ValueType>> t_prefixes(n_threads);
+  t_prefixes[0] = l_prefix;
+  for (int t = 1; t < n_threads; ++t) {
+    t_prefixes[t] = reduce_combine(t_prefixes[t-1], partials[t-1], scan_op);
+  }
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int t = 0; t < n_threads; ++t) {
+    local_transform_scan_range(
+      l_first,
+      (l_size * t)       / n_threads,
+      (l_size * (t + 1)) / n_threads,
+      l_out, t_prefixes[t], scan_op, transform_op, inclusive);
+  }
+}
+
+/**
+ * Total of a block of a global range, identified by the block's offset
+ * relative to the beginning of the range.
+ */
+template <class ValueType>
+struct scan_block_total {
+  int64_t                   offset;
+  reduce_partial<ValueType> total;
+};
+
+/**
+ * Combine the totals of the blocks preceding every block in
+ * \c [l_first, l_first + l_count) in range order.
+ *
+ * \return  The combined totals of the preceding blocks of every block in
+ *          \c [l_first, l_first + l_count), invalid if no block precedes
+ *          it.
+ */
+template <class ValueType, class BinaryOperation>
+std::vector<reduce_partial<ValueType>> scan_block_prefixes(
+  const std::vector<scan_block_total<ValueType>> & blocks,
+  size_t                                           l_first,
+  size_t                                           l_count,
+  BinaryOperation                                  op)
+{
+  typedef reduce_partial<ValueType> partial_t;
+  // Blocks in range order:
+  std::vector<size_t> order(blocks.size());
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    order[b] = b;
+  }
+  std::sort(order.begin(), order.end(),
+            [&blocks](size_t a, size_t b) {
+              return blocks[a].offset < blocks[b].offset;
+            });
+  std::vector<partial_t> l_prefixes(l_count);
+  partial_t prefix { ValueType(), false };
+  for (auto b : order) {
+    if (b >= l_first && b < l_first + l_count) {
+      l_prefixes[b - l_first] = prefix;
+    }
+    prefix = reduce_combine(prefix, blocks[b].total, op);
+  }
+  return l_prefixes;
+}
+
+/**
+ * Combine the totals of the blocks preceding every local block of the
+ * active unit in range order, including preceding local blocks.
+ * The number of local blocks and the total of the first local block of
+ * all units are exchanged in a single \c dart_allgather. Totals of
+ * further blocks are exchanged in a \c dart_allgatherv only if any unit
+ * holds more than one block of the range, as in block-cyclic and tiled
+ * patterns.
+ */
+template <class ValueType, class BinaryOperation, class PatternType>
+std::vector<reduce_partial<ValueType>> team_exscan(
+  const std::vector<scan_block>                & l_blocks,
+  const std::vector<reduce_partial<ValueType>> & l_totals,
+  BinaryOperation                                op,
+  const PatternType                            & /* pattern */,
+  dash::Team                                   & team,
+  std::false_type                                /* dart_reducible */)
+{
+  typedef reduce_partial<ValueType>   partial_t;
+  typedef scan_block_total<ValueType> block_total_t;
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::transform_scan requires a trivially copyable "
+                "value type for scan operations without DART equivalent");
+  std::vector<block_total_t> l_block_totals(l_blocks.size());
+  for (size_t b = 0; b < l_blocks.size(); ++b) {
+    l_block_totals[b] = block_total_t { l_blocks[b].offset, l_totals[b] };
+  }
+  auto nunits = team.size();
+  if (nunits == 1) {
+    return scan_block_prefixes(l_block_totals, 0, l_blocks.size(), op);
+  }
+  struct unit_blocks_t {
+    int64_t       nblocks;
+    block_total_t first;
+  };
+  unit_blocks_t l_unit_blocks {
+    static_cast<int64_t>(l_blocks.size()),
+    l_blocks.empty()
+      ? block_total_t { 0, partial_t { ValueType(), false } }
+      : l_block_totals[0]
+  };
+  std::vector<unit_blocks_t> unit_blocks(nunits);
+  DASH_LOG_TRACE("dash::team_exscan", "dart_allgather()");
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_unit_blocks,
+      unit_blocks.data(),
+      sizeof(unit_blocks_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  // Offsets of the units' blocks in the list of all blocks:
+  std::vector<size_t> unit_nbytes(nunits);
+  std::vector<size_t> unit_displs(nunits);
+  size_t nblocks       = 0;
+  bool   single_blocks = true;
+  for (size_t u = 0; u < nunits; ++u) {
+    unit_displs[u] = nblocks * sizeof(block_total_t);
+    unit_nbytes[u] = unit_blocks[u].nblocks * sizeof(block_total_t);
+    nblocks       += unit_blocks[u].nblocks;
+    single_blocks &= (unit_blocks[u].nblocks <= 1);
+  }
+  std::vector<block_total_t> blocks(nblocks);
+  if (single_blocks) {
+    for (size_t u = 0; u < nunits; ++u) {
+      if (unit_blocks[u].nblocks > 0) {
+        blocks[unit_displs[u] / sizeof(block_total_t)] = unit_blocks[u].first;
+      }
+    }
+  } else {
+    DASH_LOG_TRACE("dash::team_exscan", "dart_allgatherv()",
+                   "blocks:", nblocks);
+    DASH_ASSERT_RETURNS(
+      dart_allgatherv(
+        // Send buffer must not be null, null is interpreted as in-place:
+        l_blocks.empty()
+          ? static_cast<const void *>(&l_unit_blocks)
+          : static_cast<const void *>(l_block_totals.data()),
+        l_block_totals.size() * sizeof(block_total_t),
+        DART_TYPE_BYTE,
+        blocks.data(),
+        unit_nbytes.data(),
+        unit_displs.data(),
+        team.dart_id()),
+      DART_OK);
+  }
+  return scan_block_prefixes(
+           blocks,
+           unit_displs[team.myid().id] / sizeof(block_total_t),
+           l_blocks.size(),
+           op);
+}
+
+/**
+ * Combine the totals of the blocks preceding every local block of the
+ * active unit in range order.
+ * Totals are combined in a single \c dart_exscan if local portions are
+ * single blocks ordered by unit id, otherwise as for operations without
+ * DART equivalent.
+ */
+template <class ValueType, class BinaryOperation, class PatternType>
+std::vector<reduce_partial<ValueType>> team_exscan(
+  const std::vector<scan_block>                & l_blocks,
+  const std::vector<reduce_partial<ValueType>> & l_totals,
+  BinaryOperation                                op,
+  const PatternType                            & pattern,
+  dash::Team                                   & team,
+  std::true_type                                 /* dart_reducible */)
+{
+  typedef reduce_dart_operation<BinaryOperation, ValueType> dart_op_t;
+  if (team.size() == 1 || !scan_blocks_in_unit_order(pattern)) {
+    return team_exscan(l_blocks, l_totals, op, pattern, team,
+                       std::false_type());
+  }
+  // Units with empty local range contribute the operation's identity:
+  ValueType l_value = l_totals.empty() ? dart_op_t::identity()
+                                       : l_totals[0].value;
+  ValueType g_prefix;
+  DASH_LOG_TRACE("dash::team_exscan", "dart_exscan()");
+  DASH_ASSERT_RETURNS(
+    dart_exscan(
+      &l_value,
+      &g_prefix,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      dart_op_t::value,
+      team.dart_id()),
+    DART_OK);
+  // Result at unit 0 is undefined:
+  return std::vector<reduce_partial<ValueType>>(
+           l_blocks.size(),
+           reduce_partial<ValueType> { g_prefix, team.myid().id > 0 });
+}
+
+/**
+ * Common implementation of inclusive and exclusive scans.
+ * Inclusive scans without initial value are specified by an invalid
+ * \c init.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+GlobOutputIt transform_scan(
+  GlobInputIt                       first,
+  GlobInputIt                       last,
+  GlobOutputIt                      d_first,
+  const reduce_partial<ValueType> & init,
+  BinaryOperation                   scan_op,
+  UnaryOperation                    transform_op,
+  bool                              inclusive)
+{
+  typedef reduce_partial<ValueType>                          partial_t;
+  typedef reduce_dart_operation<BinaryOperation, ValueType>  dart_op_t;
+  typedef std::integral_constant<bool,
+            dart_op_t::value != DART_OP_UNDEFINED>
+    dart_reducible;
+
+  auto & team   = first.team();
+  auto   g_size = last - first;
+  auto   d_last = d_first + g_size;
+
+  auto l_blocks     = internal::scan_local_blocks(first,   last);
+  auto l_out_blocks = internal::scan_local_blocks(d_first, d_last);
+  auto nblocks      = l_blocks.size();
+  bool same_distribution = (l_out_blocks.size() == nblocks);
+  int64_t l_size    = 0;
+  for (size_t b = 0; b < nblocks && same_distribution; ++b) {
+    same_distribution = (l_out_blocks[b].offset == l_blocks[b].offset &&
+                         l_out_blocks[b].size   == l_blocks[b].size);
+    l_size += l_blocks[b].size;
+  }
+  DASH_LOG_DEBUG("dash::transform_scan()",
+                 "inclusive:", inclusive,
+                 "local size:", l_size,
+                 "local blocks:", nblocks);
+  // The distribution check is local, all units agree on the result so
+  // that either all or no units throw:
+  int l_same_distribution = same_distribution;
+  int g_same_distribution = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_same_distribution,
+      &g_same_distribution,
+      1,
+      DART_TYPE_INT,
+      DART_OP_MIN,
+      team.dart_id()),
+    DART_OK);
+  if (!g_same_distribution) {
+    DASH_THROW(
+      dash::exception::NotImplemented,
+      "dash::transform_scan requires an output range distributed like "
+      "the input range");
+  }
+
+  auto l_first   = first.globmem().lbegin();
+  auto l_out     = d_first.globmem().lbegin();
+  int  n_threads = internal::scan_num_threads(l_size);
+  // A single local block is partitioned to threads, multiple local blocks
+  // are distributed to threads:
+  std::vector<partial_t> partials;
+  std::vector<partial_t> l_totals(nblocks);
+  if (nblocks == 1) {
+    partials = internal::local_scan_partials<ValueType>(
+                 l_first + l_blocks[0].l_index, l_size, n_threads,
+                 scan_op, transform_op);
+    l_totals[0] = partials[0];
+    for (int t = 1; t < n_threads; ++t) {
+      l_totals[0] = reduce_combine(l_totals[0], partials[t], scan_op);
+    }
+  } else {
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+    for (size_t b = 0; b < nblocks; ++b) {
+      l_totals[b] = internal::local_scan_total<ValueType>(
+                      l_first + l_blocks[b].l_index, 0, l_blocks[b].size,
+                      scan_op, transform_op);
+    }
+  }
+
+  auto l_prefixes = internal::team_exscan(
+                      l_blocks, l_totals, scan_op, first.pattern(), team,
+                      dart_reducible());
+
+  if (nblocks == 1) {
+    internal::local_transform_scan(
+      l_first + l_blocks[0].l_index, l_size,
+      l_out   + l_out_blocks[0].l_index,
+      reduce_combine(init, l_prefixes[0], scan_op),
+      partials, scan_op, transform_op, inclusive);
+  } else {
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+    for (size_t b = 0; b < nblocks; ++b) {
+      internal::local_transform_scan_range(
+        l_first + l_blocks[b].l_index, 0, l_blocks[b].size,
+        l_out   + l_out_blocks[b].l_index,
+        reduce_combine(init, l_prefixes[b], scan_op),
+        scan_op, transform_op, inclusive);
+    }
+  }
+  return d_last;
+}
+
+} // namespace internal
+
+/**
+ * Computes the prefix reduction of the values in range \c [first, last)
+ * transformed by \c transform_op using the binary operation \c scan_op
+ * and writes the result to the range beginning at \c d_first.
+ *
+ * Collective operation.
+ *
+ * Elements are scanned in global index order. The local portion of the
+ * range at every unit may consist of several blocks, as in block-cyclic
+ * and tiled patterns.
+ * The output range must be distributed like the input range, i.e. every
+ * element in the output range must be local at the unit holding the
+ * corresponding input element. Input and output range may be identical.
+ *
+ * Local values are scanned by OpenMP threads if available. Totals of the
+ * local blocks are exchanged in a collective operation and every block is
+ * scanned starting from the combined totals of its preceding blocks in
+ * global index order, so no element is accessed remotely:
+ * - If every unit holds a single block of the pattern in unit order and
+ *   \c scan_op has an equivalent \c dart_operation_t for the value type,
+ *   in a \c dart_exscan.
+ * - Otherwise, in a \c dart_allgather of the totals and offsets of all
+ *   units' blocks, which requires a trivially copyable value type.
+ *   Units holding more than one block exchange their block totals in an
+ *   additional \c dart_allgatherv.
+ *
+ * The scan operation must be associative.
+ *
+ * \return  Iterator to the element past the last element written.
+ *
+ * \see     dash::transform_exclusive_scan
+ * \see     dash::inclusive_scan
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class UnaryOperation,
+  class ValueType >
+GlobOutputIt transform_inclusive_scan(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  GlobOutputIt    d_first,
+  BinaryOperation scan_op,
+  UnaryOperation  transform_op,
+  ValueType       init)
+{
+  return internal::transform_scan(
+           first, last, d_first,
+           internal::reduce_partial<ValueType> { init, true },
+           scan_op, transform_op, true);
+}
+
+/**
+ * Computes the prefix reduction of the values in range \c [first, last)
+ * transformed by \c transform_op using the binary operation \c scan_op
+ * and writes the result to the range beginning at \c d_first.
+ * The \c i-th output element is the reduction of the first \c i input
+ * elements.
+ *
+ * Collective operation.
+ *
+ * \see     dash::transform_inclusive_scan
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+GlobOutputIt transform_inclusive_scan(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  GlobOutputIt    d_first,
+  BinaryOperation scan_op,
+  UnaryOperation  transform_op)
+{
+  typedef typename std::decay<
+    typename dash::iterator_traits<GlobOutputIt>::value_type>::type value_t;
+  return internal::transform_scan(
+           first, last, d_first,
+           internal::reduce_partial<value_t> { value_t(), false },
+           scan_op, transform_op, true);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the values in range
+ * \c [first, last) transformed by \c transform_op using the binary
+ * operation \c scan_op, starting from \c init, and writes the result to
+ * the range beginning at \c d_first.
+ * The \c i-th output element is the reduction of \c init and the first
+ * \c i-1 input elements.
+ *
+ * Collective operation, see \c dash::transform_inclusive_scan for
+ * requirements on the input and output ranges.
+ *
+ * \return  Iterator to the element past the last element written.
+ *
+ * \see     dash::transform_inclusive_scan
+ * \see     dash::exclusive_scan
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+GlobOutputIt transform_exclusive_scan(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  GlobOutputIt    d_first,
+  ValueType       init,
+  BinaryOperation scan_op,
+  UnaryOperation  transform_op)
+{
+  return internal::transform_scan(
+           first, last, d_first,
+           internal::reduce_partial<ValueType> { init, true },
+           scan_op, transform_op, false);
+}
+
+/**
+ * Computes the prefix reduction of the values in range \c [first, last)
+ * using the binary operation \c op and writes the result to the range
+ * beginning at \c d_first.
+ *
+ * Collective operation.
+ *
+ * Semantics:
+ *
+ *     out[i] = in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \see     dash::transform_inclusive_scan
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation = dash::plus<
+    typename std::decay<
+      typename dash::iterator_traits<GlobOutputIt>::value_type>::type> >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  GlobOutputIt    d_first,
+  BinaryOperation op = BinaryOperation())
+{
+  typedef typename std::decay<
+    typename dash::iterator_traits<GlobOutputIt>::value_type>::type value_t;
+  return dash::transform_inclusive_scan(
+           first, last, d_first, op,
+           [](const value_t & value) -> value_t { return value; });
+}
+
+/**
+ * Computes the prefix reduction of \c init and the values in range
+ * \c [first, last) using the binary operation \c op and writes the result
+ * to the range beginning at \c d_first.
+ *
+ * Collective operation.
+ *
+ * Semantics:
+ *
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \see     dash::transform_inclusive_scan
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  GlobOutputIt    d_first,
+  BinaryOperation op,
+  ValueType       init)
+{
+  return dash::transform_inclusive_scan(
+           first, last, d_first, op,
+           [](const ValueType & value) -> ValueType { return value; },
+           init);
+}
+
+/**
+ * Computes the exclusive prefix reduction of \c init and the values in
+ * range \c [first, last) using the binary operation \c op and writes the
+ * result to the range beginning at \c d_first.
+ *
+ * Collective operation.
+ *
+ * Semantics:
+ *
+ *     out[0] = init
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i-1]
+ *
+ * \see     dash::transform_exclusive_scan
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+GlobOutputIt exclusive_scan(
+  GlobInputIt     first,
+  GlobInputIt     last,
+  GlobOutputIt    d_first,
+  ValueType       init,
+  BinaryOperation op = BinaryOperation())
+{
+  return dash::transform_exclusive_scan(
+           first, last, d_first, init, op,
+           [](const ValueType & value) -> ValueType { return value; });
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
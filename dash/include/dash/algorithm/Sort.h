@@ -0,0 +1,406 @@
+#ifndef DASH__ALGORITHM__SORT_H__
+#define DASH__ALGORITHM__SORT_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Onesided.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Sort.h>
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/util/Trace.h>
+#include <dash/util/EventTrace.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Candidate for a splitter, references the element at local offset
+ * \c lidx of unit \c unit.
+ * The weight of a candidate is the size of the unit's remaining search
+ * window.
+ */
+template <typename ValueType>
+struct sort_splitter_candidate {
+  ValueType value;
+  int64_t   unit;
+  int64_t   lidx;
+  int64_t   weight;
+};
+
+/**
+ * Resolves the local split offsets in the sorted local range of every
+ * unit such that the number of elements preceding the split offsets of all
+ * units equals the specified global target ranks.
+ *
+ * Elements are ordered by value and, for equivalent values, by unit and
+ * local offset, so splits are exact for ranges with duplicate values.
+ * Splitters are found in a multi-way selection: in every round, each unit
+ * proposes the median of its remaining search window for every split, the
+ * weighted median of the proposals is used as pivot and the search windows
+ * are narrowed by the global rank of the pivot obtained from a single
+ * \c dart_allreduce.
+ *
+ * Collective operation.
+ *
+ * \return  Local offset of the split in the local range for every target
+ *          rank.
+ */
+template <class ValueType, class Compare>
+std::vector<int64_t> sort_find_splits(
+  const ValueType            * l_sorted,
+  int64_t                      l_size,
+  const std::vector<int64_t> & target_ranks,
+  Compare                      comp,
+  dash::Team                 & team)
+{
+  typedef sort_splitter_candidate<ValueType> candidate_t;
+
+  auto    nsplits = target_ranks.size();
+  auto    nunits  = team.size();
+  int64_t myid    = team.myid().id;
+
+  std::vector<int64_t> split_lo(nsplits, 0);
+  std::vector<int64_t> split_hi(nsplits, l_size);
+  std::vector<bool>    split_done(nsplits, false);
+  std::vector<int64_t> splits(nsplits, 0);
+
+  // Strict weak order of elements extended by unit and local offset:
+  auto cand_less = [&](const candidate_t & a, const candidate_t & b) {
+                     if (comp(a.value, b.value)) { return true;  }
+                     if (comp(b.value, a.value)) { return false; }
+                     return (a.unit < b.unit) ||
+                            (a.unit == b.unit && a.lidx < b.lidx);
+                   };
+
+  std::vector<candidate_t> l_candidates(nsplits);
+  std::vector<candidate_t> g_candidates(nsplits * nunits);
+  std::vector<candidate_t> pivots(nsplits);
+  std::vector<int64_t>     l_ranks(nsplits);
+  std::vector<int64_t>     g_ranks(nsplits);
+
+  std::size_t nsplits_open = nsplits;
+  int         round        = 0;
+  while (nsplits_open > 0) {
+    ++round;
+    for (std::size_t s = 0; s < nsplits; ++s) {
+      auto & cand = l_candidates[s];
+      cand.unit   = myid;
+      cand.weight = split_done[s] ? 0 : split_hi[s] - split_lo[s];
+      cand.lidx   = split_lo[s] + (split_hi[s] - split_lo[s]) / 2;
+      if (cand.weight > 0) {
+        cand.value = l_sorted[cand.lidx];
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        l_candidates.data(),
+        g_candidates.data(),
+        nsplits * sizeof(candidate_t),
+        DART_TYPE_BYTE,
+        team.dart_id()),
+      DART_OK);
+    // Select the weighted median of the candidates of all units as pivot:
+    std::vector<candidate_t> split_candidates;
+    for (std::size_t s = 0; s < nsplits; ++s) {
+      l_ranks[s] = 0;
+      if (split_done[s]) {
+        continue;
+      }
+      split_candidates.clear();
+      int64_t total_weight = 0;
+      for (std::size_t u = 0; u < nunits; ++u) {
+        const auto & cand = g_candidates[u * nsplits + s];
+        if (cand.weight > 0) {
+          split_candidates.push_back(cand);
+          total_weight += cand.weight;
+        }
+      }
+      if (split_candidates.empty()) {
+        // Search windows of all units are empty:
+        split_done[s] = true;
+        splits[s]     = split_lo[s];
+        --nsplits_open;
+        continue;
+      }
+      std::sort(split_candidates.begin(), split_candidates.end(), cand_less);
+      int64_t cumul_weight = 0;
+      for (const auto & cand : split_candidates) {
+        cumul_weight += cand.weight;
+        if (2 * cumul_weight >= total_weight) {
+          pivots[s] = cand;
+          break;
+        }
+      }
+      // Number of local elements preceding the pivot:
+      const auto & pivot = pivots[s];
+      if (myid == pivot.unit) {
+        l_ranks[s] = pivot.lidx;
+      } else if (myid < pivot.unit) {
+        l_ranks[s] = std::upper_bound(l_sorted, l_sorted + l_size,
+                                      pivot.value, comp) - l_sorted;
+      } else {
+        l_ranks[s] = std::lower_bound(l_sorted, l_sorted + l_size,
+                                      pivot.value, comp) - l_sorted;
+      }
+    }
+    if (nsplits_open == 0) {
+      break;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        l_ranks.data(),
+        g_ranks.data(),
+        nsplits,
+        dash::dart_datatype<int64_t>::value,
+        DART_OP_SUM,
+        team.dart_id()),
+      DART_OK);
+    for (std::size_t s = 0; s < nsplits; ++s) {
+      if (split_done[s]) {
+        continue;
+      }
+      if (g_ranks[s] == target_ranks[s]) {
+        split_done[s] = true;
+        splits[s]     = l_ranks[s];
+        --nsplits_open;
+      } else if (g_ranks[s] < target_ranks[s]) {
+        // Pivot and all preceding elements precede the split:
+        int64_t lo  = l_ranks[s] + (myid == pivots[s].unit ? 1 : 0);
+        split_lo[s] = std::min(split_hi[s], std::max(split_lo[s], lo));
+      } else {
+        // Pivot and all succeeding elements succeed the split:
+        split_hi[s] = std::max(split_lo[s], std::min(split_hi[s],
+                                                     l_ranks[s]));
+      }
+    }
+  }
+  DASH_LOG_TRACE("dash::sort_find_splits >", "rounds:", round);
+  return splits;
+}
+
+} // namespace internal
+
+/**
+ * Sorts the elements in the range \c [first, last) in ascending order
+ * with respect to the comparison function \c comp.
+ *
+ * Distributed sample sort with exact splitting:
+ *
+ * 1. Every unit sorts its local elements. Local sorting uses OpenMP
+ *    threads if available and radix sort for integral values if \c comp
+ *    is \c std::less.
+ * 2. Splitters are determined in a multi-way selection such that the
+ *    partition sent to every unit matches the unit's local portion of the
+ *    range exactly.
+ * 3. Partitions are exchanged in one-sided transfers directly into the
+ *    local memory of their target units.
+ * 4. Every unit merges the sorted partitions it received.
+ *
+ * The local portion of the range at every unit must be contiguous in
+ * global index space, as in one-dimensional blocked patterns.
+ * Elements must be trivially copyable, the sort is not stable.
+ *
+ * Collective operation.
+ *
+ * \complexity  O(n/p log n/p) local work and O(log n) rounds of
+ *              collective splitter selection for \c n elements and \c p
+ *              units.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class GlobRandomIt,
+  class Compare >
+void sort(
+  GlobRandomIt first,
+  GlobRandomIt last,
+  Compare      comp)
+{
+  typedef typename std::decay<
+    typename dash::iterator_traits<GlobRandomIt>::value_type>::type value_t;
+  typedef internal::is_radix_sortable<value_t, Compare> radix_sortable;
+
+  static_assert(std::is_trivially_copyable<value_t>::value,
+                "dash::sort requires trivially copyable element type");
+
+  dash::util::Trace trace("sort");
+  DASH_EVENT_TRACE_SCOPE("dash::sort");
+
+  auto & pattern = first.pattern();
+  auto & team    = first.team();
+  auto   nunits  = team.size();
+  auto   myid    = team.myid();
+
+  // Local portion of the range:
+  auto    l_idx_range = dash::local_index_range(first, last);
+  int64_t l_size      = l_idx_range.end - l_idx_range.begin;
+  value_t * l_first   = (l_size > 0)
+                        ? first.globmem().lbegin() + l_idx_range.begin
+                        : nullptr;
+  // Offset of the local portion relative to the beginning of the range:
+  int64_t l_offset    = 0;
+  bool    l_contig    = true;
+  if (l_size > 0) {
+    int64_t g_lbegin = pattern.global(l_idx_range.begin);
+    int64_t g_lend   = pattern.global(l_idx_range.end - 1) + 1;
+    l_offset = g_lbegin - static_cast<int64_t>(first.gpos());
+    l_contig = (g_lend - g_lbegin == l_size);
+  }
+  DASH_LOG_DEBUG("dash::sort()", "local size:", l_size,
+                 "offset:", l_offset);
+
+  // Local portions of all units, ordered by their offset in the range:
+  struct l_portion_t { int64_t offset; int64_t size; int64_t contig; };
+  l_portion_t l_portion { l_offset, l_size, l_contig };
+  std::vector<l_portion_t> portions(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_portion,
+      portions.data(),
+      sizeof(l_portion_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  for (const auto & portion : portions) {
+    if (!portion.contig) {
+      DASH_THROW(
+        dash::exception::NotImplemented,
+        "dash::sort requires local portions that are contiguous in "
+        "global index space");
+    }
+  }
+  std::vector<int> unit_order(nunits);
+  std::iota(unit_order.begin(), unit_order.end(), 0);
+  std::stable_sort(unit_order.begin(), unit_order.end(),
+                   [&](int a, int b) {
+                     return portions[a].offset < portions[b].offset;
+                   });
+
+  // Sort local elements in a buffer as local memory is overwritten by
+  // remote units in the exchange phase:
+  trace.enter_state("local_sort");
+  std::vector<value_t> l_sorted(l_first, l_first + l_size);
+  internal::local_sort(l_sorted.data(), l_sorted.data() + l_size,
+                       comp, radix_sortable());
+  trace.exit_state("local_sort");
+
+  if (nunits == 1) {
+    std::copy(l_sorted.begin(), l_sorted.end(), l_first);
+    return;
+  }
+
+  // Global rank of the first element of every unit's portion except the
+  // first one in range order:
+  std::vector<int64_t> target_ranks;
+  int64_t              rank = 0;
+  for (std::size_t k = 0; k < nunits - 1; ++k) {
+    rank += portions[unit_order[k]].size;
+    target_ranks.push_back(rank);
+  }
+
+  trace.enter_state("splitters");
+  auto splits = internal::sort_find_splits(
+                  l_sorted.data(), l_size, target_ranks, comp, team);
+  splits.insert(splits.begin(), 0);
+  splits.push_back(l_size);
+  trace.exit_state("splitters");
+
+  // Number of elements sent from every unit to every portion in range
+  // order:
+  std::vector<int64_t> l_send_counts(nunits);
+  for (std::size_t k = 0; k < nunits; ++k) {
+    l_send_counts[k] = splits[k + 1] - splits[k];
+  }
+  std::vector<int64_t> send_counts(nunits * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_send_counts.data(),
+      send_counts.data(),
+      nunits,
+      dash::dart_datatype<int64_t>::value,
+      team.dart_id()),
+    DART_OK);
+
+  // Write partitions to the local memory of their target units, ordered
+  // by source unit:
+  trace.enter_state("exchange");
+  dart_gptr_t gptr_last = DART_GPTR_NULL;
+  for (std::size_t k = 0; k < nunits; ++k) {
+    int64_t nsend = l_send_counts[k];
+    if (nsend == 0) {
+      continue;
+    }
+    int     target = unit_order[k];
+    int64_t offset = portions[target].offset;
+    for (int src = 0; src < myid.id; ++src) {
+      offset += send_counts[src * nunits + k];
+    }
+    const value_t * send_buf = l_sorted.data() + splits[k];
+    if (target == myid.id) {
+      std::copy(send_buf, send_buf + nsend,
+                l_first + (offset - l_offset));
+    } else {
+      gptr_last = (first + offset).dart_gptr();
+      dash::internal::put(gptr_last, send_buf, nsend);
+    }
+  }
+  if (!DART_GPTR_ISNULL(gptr_last)) {
+    DASH_ASSERT_RETURNS(
+      dart_flush_all(gptr_last),
+      DART_OK);
+  }
+  team.barrier();
+  trace.exit_state("exchange");
+
+  // Merge received partitions which are sorted runs in local memory:
+  trace.enter_state("merge");
+  int my_pos = std::find(unit_order.begin(), unit_order.end(), myid.id)
+               - unit_order.begin();
+  std::vector<std::size_t> run_offsets { 0 };
+  for (std::size_t src = 0; src < nunits; ++src) {
+    auto nrecv = send_counts[src * nunits + my_pos];
+    if (nrecv > 0) {
+      run_offsets.push_back(run_offsets.back() + nrecv);
+    }
+  }
+  internal::sort_merge_runs(l_first, run_offsets, comp);
+  trace.exit_state("merge");
+
+  team.barrier();
+  DASH_LOG_DEBUG("dash::sort >");
+}
+
+/**
+ * Sorts the elements in the range \c [first, last) in ascending order.
+ *
+ * \see dash::sort(GlobRandomIt, GlobRandomIt, Compare)
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class GlobRandomIt>
+void sort(
+  GlobRandomIt first,
+  GlobRandomIt last)
+{
+  typedef typename std::decay<
+    typename dash::iterator_traits<GlobRandomIt>::value_type>::type value_t;
+  dash::sort(first, last, std::less<value_t>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SORT_H__
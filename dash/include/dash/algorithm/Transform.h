@@ -12,6 +12,7 @@
 
 #include <dash/internal/Config.h>
 #include <dash/util/Trace.h>
+#include <dash/util/EventTrace.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -448,6 +449,7 @@ GlobOutputIt transform(
     GlobOutputIt    out_first,
     BinaryOperation binary_op)
 {
+  DASH_EVENT_TRACE_SCOPE("dash::transform");
   using InputIt_traits_t    = dash::iterator_traits<InputIt>;
   using InputIt_is_global_t = typename InputIt_traits_t::is_global_iterator;
 
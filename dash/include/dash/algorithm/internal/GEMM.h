@@ -0,0 +1,421 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Cache blocking parameters of the built-in GEMM kernel.
+ *
+ * A panel of \c KC x \c NC elements of B is packed once and shared by all
+ * threads, blocks of \c MC x \c KC elements of A are packed per thread
+ * and are meant to stay in L2 cache while the register tiles of C are
+ * computed.
+ */
+struct gemm_blocking
+{
+  enum : long long {
+    MC =   96,
+    KC =  256,
+    NC = 4096
+  };
+};
+
+/**
+ * Vector operations used by the GEMM micro-kernel, specialized for the
+ * SIMD instruction sets enabled at compile time.
+ * A \c width of 0 selects the scalar micro-kernel.
+ */
+template <typename ValueType>
+struct gemm_simd
+{
+  enum : int { width = 0 };
+};
+
+#if defined(__AVX__)
+
+template <>
+struct gemm_simd<double>
+{
+  typedef __m256d vec_t;
+  enum : int { width = 4 };
+
+  static inline vec_t zero()                   { return _mm256_setzero_pd(); }
+  static inline vec_t load(const double * p)   { return _mm256_loadu_pd(p);  }
+  static inline vec_t bcast(const double * p)  { return _mm256_broadcast_sd(p); }
+  static inline void  store(double * p, vec_t v) { _mm256_storeu_pd(p, v); }
+  static inline vec_t add(vec_t a, vec_t b)    { return _mm256_add_pd(a, b); }
+  static inline vec_t fmadd(vec_t a, vec_t b, vec_t c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+  }
+};
+
+template <>
+struct gemm_simd<float>
+{
+  typedef __m256 vec_t;
+  enum : int { width = 8 };
+
+  static inline vec_t zero()                   { return _mm256_setzero_ps(); }
+  static inline vec_t load(const float * p)    { return _mm256_loadu_ps(p);  }
+  static inline vec_t bcast(const float * p)   { return _mm256_broadcast_ss(p); }
+  static inline void  store(float * p, vec_t v) { _mm256_storeu_ps(p, v); }
+  static inline vec_t add(vec_t a, vec_t b)    { return _mm256_add_ps(a, b); }
+  static inline vec_t fmadd(vec_t a, vec_t b, vec_t c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+  }
+};
+
+#elif defined(__SSE2__)
+
+template <>
+struct gemm_simd<double>
+{
+  typedef __m128d vec_t;
+  enum : int { width = 2 };
+
+  static inline vec_t zero()                   { return _mm_setzero_pd(); }
+  static inline vec_t load(const double * p)   { return _mm_loadu_pd(p);  }
+  static inline vec_t bcast(const double * p)  { return _mm_load1_pd(p);  }
+  static inline void  store(double * p, vec_t v) { _mm_storeu_pd(p, v);  }
+  static inline vec_t add(vec_t a, vec_t b)    { return _mm_add_pd(a, b); }
+  static inline vec_t fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm_add_pd(_mm_mul_pd(a, b), c);
+  }
+};
+
+template <>
+struct gemm_simd<float>
+{
+  typedef __m128 vec_t;
+  enum : int { width = 4 };
+
+  static inline vec_t zero()                   { return _mm_setzero_ps(); }
+  static inline vec_t load(const float * p)    { return _mm_loadu_ps(p);  }
+  static inline vec_t bcast(const float * p)   { return _mm_load1_ps(p);  }
+  static inline void  store(float * p, vec_t v) { _mm_storeu_ps(p, v);   }
+  static inline vec_t add(vec_t a, vec_t b)    { return _mm_add_ps(a, b); }
+  static inline vec_t fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+  }
+};
+
+#endif // defined(__AVX__) / defined(__SSE2__)
+
+/**
+ * Register-tiled micro-kernel computing \c C += \c A x \c B for a tile of
+ * \c MR x \c NR elements of C from packed panels of A (\c MR values per
+ * step) and B (\c NR values per step).
+ *
+ * SIMD variant, every row of the tile is held in two vector registers.
+ */
+template <
+  typename ValueType,
+  int      Width = gemm_simd<ValueType>::width >
+struct gemm_kernel
+{
+  typedef gemm_simd<ValueType>     simd;
+  typedef typename simd::vec_t     vec_t;
+
+  enum : int {
+    MR = 4,
+    NR = 2 * Width
+  };
+
+  static inline void run(
+    long long         kc,
+    const ValueType * a,
+    const ValueType * b,
+    ValueType       * c,
+    long long         ldc)
+  {
+    vec_t acc[MR][2];
+    for (int i = 0; i < MR; ++i) {
+      acc[i][0] = simd::zero();
+      acc[i][1] = simd::zero();
+    }
+    for (long long p = 0; p < kc; ++p) {
+      vec_t b0 = simd::load(b);
+      vec_t b1 = simd::load(b + Width);
+      for (int i = 0; i < MR; ++i) {
+        vec_t ai  = simd::bcast(a + i);
+        acc[i][0] = simd::fmadd(ai, b0, acc[i][0]);
+        acc[i][1] = simd::fmadd(ai, b1, acc[i][1]);
+      }
+      a += MR;
+      b += NR;
+    }
+    for (int i = 0; i < MR; ++i) {
+      ValueType * c_row = c + i * ldc;
+      simd::store(c_row,         simd::add(simd::load(c_row), acc[i][0]));
+      simd::store(c_row + Width, simd::add(simd::load(c_row + Width),
+                                           acc[i][1]));
+    }
+  }
+};
+
+/**
+ * Register-tiled micro-kernel, scalar variant used for value types without
+ * SIMD specialization.
+ */
+template <typename ValueType>
+struct gemm_kernel<ValueType, 0>
+{
+  enum : int {
+    MR = 4,
+    NR = 4
+  };
+
+  static inline void run(
+    long long         kc,
+    const ValueType * a,
+    const ValueType * b,
+    ValueType       * c,
+    long long         ldc)
+  {
+    ValueType acc[MR][NR];
+    for (int i = 0; i < MR; ++i) {
+      for (int j = 0; j < NR; ++j) {
+        acc[i][j] = ValueType();
+      }
+    }
+    for (long long p = 0; p < kc; ++p) {
+      for (int i = 0; i < MR; ++i) {
+        for (int j = 0; j < NR; ++j) {
+          acc[i][j] += a[i] * b[j];
+        }
+      }
+      a += MR;
+      b += NR;
+    }
+    for (int i = 0; i < MR; ++i) {
+      for (int j = 0; j < NR; ++j) {
+        c[i * ldc + j] += acc[i][j];
+      }
+    }
+  }
+};
+
+/**
+ * Packs the \c mc x \c kc block of row-major matrix A at \c a into
+ * micro-panels of \c MR rows, zero-padded to a multiple of \c MR.
+ */
+template <typename ValueType, int MR>
+void gemm_pack_a(
+  long long         mc,
+  long long         kc,
+  const ValueType * a,
+  long long         lda,
+  ValueType       * buf)
+{
+  for (long long ir = 0; ir < mc; ir += MR) {
+    long long mr = std::min<long long>(MR, mc - ir);
+    for (long long p = 0; p < kc; ++p) {
+      for (long long i = 0; i < mr; ++i) {
+        buf[i] = a[(ir + i) * lda + p];
+      }
+      for (long long i = mr; i < MR; ++i) {
+        buf[i] = ValueType();
+      }
+      buf += MR;
+    }
+  }
+}
+
+/**
+ * Packs the \c NR columns starting at column \c jr of the \c kc x \c nc
+ * panel of row-major matrix B at \c b, zero-padded to \c NR columns.
+ */
+template <typename ValueType, int NR>
+void gemm_pack_b(
+  long long         kc,
+  long long         nc,
+  long long         jr,
+  const ValueType * b,
+  long long         ldb,
+  ValueType       * buf)
+{
+  long long nr = std::min<long long>(NR, nc - jr);
+  for (long long p = 0; p < kc; ++p) {
+    const ValueType * b_row = b + p * ldb + jr;
+    for (long long j = 0; j < nr; ++j) {
+      buf[j] = b_row[j];
+    }
+    for (long long j = nr; j < NR; ++j) {
+      buf[j] = ValueType();
+    }
+    buf += NR;
+  }
+}
+
+/**
+ * Computes \c C += \c A x \c B for packed blocks of A (\c mc x \c kc) and
+ * B (\c kc x \c nc) by applying the micro-kernel to every register tile
+ * of the \c mc x \c nc block of C.
+ */
+template <typename ValueType>
+void gemm_macro_kernel(
+  long long         mc,
+  long long         nc,
+  long long         kc,
+  const ValueType * a_buf,
+  const ValueType * b_buf,
+  ValueType       * c,
+  long long         ldc)
+{
+  typedef gemm_kernel<ValueType> kernel;
+  const int MR = kernel::MR;
+  const int NR = kernel::NR;
+
+  for (long long jr = 0; jr < nc; jr += NR) {
+    long long         nr     = std::min<long long>(NR, nc - jr);
+    const ValueType * b_pack = b_buf + jr * kc;
+    for (long long ir = 0; ir < mc; ir += MR) {
+      long long         mr     = std::min<long long>(MR, mc - ir);
+      const ValueType * a_pack = a_buf + ir * kc;
+      ValueType       * c_tile = c + ir * ldc + jr;
+      if (mr == MR && nr == NR) {
+        kernel::run(kc, a_pack, b_pack, c_tile, ldc);
+      } else {
+        // Edge tile, compute full tile on zero-padded panels and only
+        // accumulate its valid section:
+        ValueType tile[MR * NR];
+        std::fill(tile, tile + MR * NR, ValueType());
+        kernel::run(kc, a_pack, b_pack, tile, NR);
+        for (long long i = 0; i < mr; ++i) {
+          for (long long j = 0; j < nr; ++j) {
+            c_tile[i * ldc + j] += tile[i * NR + j];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Cache-blocked matrix multiplication \c C += \c A x \c B of row-major
+ * matrices A (\c m x \c k), B (\c k x \c n) and C (\c m x \c n) with
+ * leading dimensions \c lda, \c ldb and \c ldc.
+ *
+ * Blocks of C are distributed to OpenMP threads if enabled.
+ */
+template <typename ValueType>
+void gemm_row_major(
+  long long         m,
+  long long         n,
+  long long         k,
+  const ValueType * A,
+  long long         lda,
+  const ValueType * B,
+  long long         ldb,
+  ValueType       * C,
+  long long         ldc)
+{
+  typedef gemm_kernel<ValueType> kernel;
+  const int       MR = kernel::MR;
+  const int       NR = kernel::NR;
+  const long long MC = gemm_blocking::MC;
+  const long long KC = gemm_blocking::KC;
+  const long long NC = gemm_blocking::NC;
+
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return;
+  }
+  long long nc_max = std::min<long long>(NC, ((n + NR - 1) / NR) * NR);
+  long long kc_max = std::min<long long>(KC, k);
+  std::vector<ValueType> b_buf(kc_max * nc_max);
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel
+#endif
+  {
+    std::vector<ValueType> a_buf(kc_max * ((MC + MR - 1) / MR) * MR);
+
+    for (long long jc = 0; jc < n; jc += NC) {
+      long long nc = std::min<long long>(NC, n - jc);
+      long long np = (nc + NR - 1) / NR;
+      for (long long pc = 0; pc < k; pc += KC) {
+        long long kc = std::min<long long>(KC, k - pc);
+        const ValueType * b_panel = B + pc * ldb + jc;
+#ifdef DASH_ENABLE_OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for (long long jp = 0; jp < np; ++jp) {
+          gemm_pack_b<ValueType, NR>(
+            kc, nc, jp * NR, b_panel, ldb, b_buf.data() + jp * NR * kc);
+        }
+        // Implicit barrier: packed panel of B is complete.
+        long long nblocks = (m + MC - 1) / MC;
+#ifdef DASH_ENABLE_OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for (long long ib = 0; ib < nblocks; ++ib) {
+          long long ic = ib * MC;
+          long long mc = std::min<long long>(MC, m - ic);
+          gemm_pack_a<ValueType, MR>(
+            mc, kc, A + ic * lda + pc, lda, a_buf.data());
+          gemm_macro_kernel<ValueType>(
+            mc, nc, kc, a_buf.data(), b_buf.data(),
+            C + ic * ldc + jc, ldc);
+        }
+        // Implicit barrier: packed panel of B may be overwritten.
+      }
+    }
+  }
+}
+
+/**
+ * Built-in local matrix multiplication \c C += \c A x \c B of dense
+ * matrices A (\c m rows by \c k columns), B (\c k rows by \c n columns)
+ * and C (\c m rows by \c n columns) in the given storage order.
+ *
+ * Portable replacement for \c ?gemm of MKL or BLAS used by
+ * \c dash::summa if neither is available.
+ */
+template <typename ValueType>
+void gemm(
+  const ValueType * A,
+  const ValueType * B,
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage)
+{
+  DASH_LOG_TRACE("dash::internal::gemm()", "m:", m, "n:", n, "k:", k);
+  if (storage == dash::ROW_MAJOR) {
+    gemm_row_major(m, n, k, A, k, B, n, C, n);
+  } else {
+    // Column-major matrices are their row-major transposes, compute
+    // C^T += B^T x A^T:
+    gemm_row_major(n, m, k, B, k, A, m, C, m);
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
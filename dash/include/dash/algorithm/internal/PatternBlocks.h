@@ -0,0 +1,228 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PATTERN_BLOCKS_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PATTERN_BLOCKS_H__INCLUDED
+
+#include <dash/Types.h>
+
+#include <algorithm>
+#include <array>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Global index of the block at the given block coordinates, blocks are
+ * enumerated in row-major order.
+ */
+template <class PatternT, std::size_t NumDimensions>
+long long block_index_at_block_coords(
+  const PatternT                             & pattern,
+  const std::array<long long, NumDimensions> & b_coords)
+{
+  auto      blockspec = pattern.blockspec();
+  long long g_block   = 0;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    g_block = g_block * blockspec.extent(d) + b_coords[d];
+  }
+  return g_block;
+}
+
+/**
+ * Global index of the block of the pattern containing the element at
+ * the given global coordinates.
+ */
+template <class PatternT, std::size_t NumDimensions>
+long long block_index_at_coords(
+  const PatternT                             & pattern,
+  const std::array<long long, NumDimensions> & g_coords)
+{
+  std::array<long long, NumDimensions> b_coords;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    b_coords[d] = g_coords[d] / pattern.blocksize(d);
+  }
+  return block_index_at_block_coords(pattern, b_coords);
+}
+
+/**
+ * Calls \c fn(block_index, offsets, extents) for every block of the
+ * pattern that overlaps the rectangle at \c offset with the given
+ * extents, in row-major order of block coordinates.
+ *
+ * Requires a regular block grid, i.e. block \c b in dimension \c d
+ * starts at element \c b * pattern.blocksize(d).
+ */
+template <class PatternT, std::size_t NumDimensions, class BlockFunc>
+void for_each_block_in_rect(
+  const PatternT                             & pattern,
+  const std::array<long long, NumDimensions> & offset,
+  const std::array<long long, NumDimensions> & extent,
+  BlockFunc                                    fn)
+{
+  std::array<long long, NumDimensions> b_first;
+  std::array<long long, NumDimensions> b_last;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    if (extent[d] <= 0) {
+      return;
+    }
+    long long bs = pattern.blocksize(d);
+    b_first[d]   = offset[d] / bs;
+    b_last[d]    = (offset[d] + extent[d] - 1) / bs;
+  }
+  auto b_coords = b_first;
+  while (true) {
+    long long g_block = block_index_at_block_coords(pattern, b_coords);
+    auto      vs      = pattern.block(g_block);
+    std::array<long long, NumDimensions> b_offset;
+    std::array<long long, NumDimensions> b_extent;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      b_offset[d] = vs.offset(d);
+      b_extent[d] = vs.extent(d);
+    }
+    fn(g_block, b_offset, b_extent);
+    // Advance to next block, last dimension first:
+    dim_t d = NumDimensions;
+    while (d > 0) {
+      --d;
+      if (++b_coords[d] <= b_last[d]) {
+        break;
+      }
+      b_coords[d] = b_first[d];
+      if (d == 0) {
+        return;
+      }
+    }
+  }
+}
+
+/**
+ * Intersection of two rectangles, returns \c false if it is empty.
+ */
+template <std::size_t NumDimensions>
+bool rect_intersect(
+  const std::array<long long, NumDimensions> & a_offset,
+  const std::array<long long, NumDimensions> & a_extent,
+  const std::array<long long, NumDimensions> & b_offset,
+  const std::array<long long, NumDimensions> & b_extent,
+  std::array<long long, NumDimensions>       & offset,
+  std::array<long long, NumDimensions>       & extent)
+{
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    long long first = std::max(a_offset[d], b_offset[d]);
+    long long last  = std::min(a_offset[d] + a_extent[d],
+                               b_offset[d] + b_extent[d]);
+    if (last <= first) {
+      return false;
+    }
+    offset[d] = first;
+    extent[d] = last - first;
+  }
+  return true;
+}
+
+/**
+ * Local offset of the element at global coordinates \c g_coords in the
+ * pattern and the local offset distances of its neighbors in every
+ * dimension of a rectangle with the given extents.
+ * Dimension \c d of the rectangle corresponds to dimension \c perm[d] of
+ * the pattern.
+ *
+ * Local memory is affine within a block, so the strides are valid for
+ * any rectangle contained in a single block.
+ */
+template <class PatternT, std::size_t NumDimensions>
+long long block_local_strides(
+  const PatternT                             & pattern,
+  const std::array<long long, NumDimensions> & g_coords,
+  const std::array<long long, NumDimensions> & extent,
+  const std::array<dim_t, NumDimensions>     & perm,
+  std::array<long long, NumDimensions>       & strides)
+{
+  typedef typename PatternT::index_type index_t;
+  std::array<index_t, NumDimensions> coords;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    coords[d] = static_cast<index_t>(g_coords[d]);
+  }
+  long long base = pattern.local_index(coords).index;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    strides[d] = 0;
+    if (extent[d] > 1) {
+      auto next_coords = coords;
+      ++next_coords[perm[d]];
+      strides[d] = pattern.local_index(next_coords).index - base;
+    }
+  }
+  return base;
+}
+
+/**
+ * Copies the elements of a rectangle with the given extents from \c src
+ * to \c dst with element strides \c src_strides and \c dst_strides,
+ * unit-stride runs in the last dimension are copied in bulk.
+ */
+template <typename ValueType, std::size_t NumDimensions>
+void copy_strided(
+  const ValueType                            * src,
+  const std::array<long long, NumDimensions> & src_strides,
+  ValueType                                  * dst,
+  const std::array<long long, NumDimensions> & dst_strides,
+  const std::array<long long, NumDimensions> & extent)
+{
+  const dim_t     last   = NumDimensions - 1;
+  const long long nrun   = extent[last];
+  const bool      contig = (nrun == 1) ||
+                           (src_strides[last] == 1 &&
+                            dst_strides[last] == 1);
+  std::array<long long, NumDimensions> idx {{ }};
+  while (true) {
+    long long src_offs = 0;
+    long long dst_offs = 0;
+    for (dim_t d = 0; d < last; ++d) {
+      src_offs += idx[d] * src_strides[d];
+      dst_offs += idx[d] * dst_strides[d];
+    }
+    if (contig) {
+      std::copy(src + src_offs, src + src_offs + nrun, dst + dst_offs);
+    } else {
+      for (long long i = 0; i < nrun; ++i) {
+        dst[dst_offs + i * dst_strides[last]] =
+          src[src_offs + i * src_strides[last]];
+      }
+    }
+    // Advance to next run:
+    dim_t d = last;
+    while (d > 0) {
+      --d;
+      if (++idx[d] < extent[d]) {
+        break;
+      }
+      idx[d] = 0;
+      if (d == 0) {
+        return;
+      }
+    }
+    if (last == 0) {
+      return;
+    }
+  }
+}
+
+/**
+ * Strides of a dense row-major buffer with the given extents.
+ */
+template <std::size_t NumDimensions>
+std::array<long long, NumDimensions> packed_strides(
+  const std::array<long long, NumDimensions> & extent)
+{
+  std::array<long long, NumDimensions> strides;
+  long long stride = 1;
+  for (dim_t d = NumDimensions; d > 0; --d) {
+    strides[d-1] = stride;
+    stride      *= extent[d-1];
+  }
+  return strides;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PATTERN_BLOCKS_H__INCLUDED
@@ -0,0 +1,221 @@
+#ifndef DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Number of threads available to the active unit for local sorting.
+ */
+inline int sort_num_threads()
+{
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  return std::max(1, uloc.num_domain_threads());
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Merge consecutive sorted runs in a local range into a single sorted
+ * range.
+ * Runs are merged pairwise in a tree, merges on the same tree level are
+ * performed by OpenMP threads if available.
+ */
+template <class ValueType, class Compare>
+void sort_merge_runs(
+  ValueType                 * l_first,
+  /// Offsets of runs in the range, including the offset past the last run.
+  std::vector<std::size_t>    run_offsets,
+  Compare                     comp)
+{
+  while (run_offsets.size() > 2) {
+    int nmerges = static_cast<int>(run_offsets.size() - 1) / 2;
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for schedule(dynamic) \
+                num_threads(std::min(nmerges, sort_num_threads()))
+#endif
+    for (int m = 0; m < nmerges; ++m) {
+      std::inplace_merge(l_first + run_offsets[2 * m],
+                         l_first + run_offsets[2 * m + 1],
+                         l_first + run_offsets[2 * m + 2],
+                         comp);
+    }
+    std::vector<std::size_t> merged_offsets;
+    for (std::size_t r = 0; r < run_offsets.size(); r += 2) {
+      merged_offsets.push_back(run_offsets[r]);
+    }
+    if (merged_offsets.back() != run_offsets.back()) {
+      merged_offsets.push_back(run_offsets.back());
+    }
+    run_offsets.swap(merged_offsets);
+  }
+}
+
+/**
+ * Sort a local range using a comparison sort.
+ * The range is partitioned to OpenMP threads if available, sorted
+ * partitions are merged subsequently.
+ */
+template <class ValueType, class Compare>
+void local_sort(
+  ValueType * l_first,
+  ValueType * l_last,
+  Compare     comp,
+  std::false_type /* radix sortable */)
+{
+  std::size_t l_size    = l_last - l_first;
+  int         n_threads = sort_num_threads();
+  // Partitions should not be smaller than a few pages:
+  const std::size_t min_partition_size = 1 << 12;
+  n_threads = static_cast<int>(
+                std::min<std::size_t>(
+                  n_threads, 1 + l_size / min_partition_size));
+  if (n_threads <= 1) {
+    std::sort(l_first, l_last, comp);
+    return;
+  }
+  std::vector<std::size_t> run_offsets(n_threads + 1);
+  for (int t = 0; t <= n_threads; ++t) {
+    run_offsets[t] = (l_size * t) / n_threads;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int t = 0; t < n_threads; ++t) {
+    std::sort(l_first + run_offsets[t], l_first + run_offsets[t + 1], comp);
+  }
+  sort_merge_runs(l_first, run_offsets, comp);
+}
+
+/**
+ * Unsigned key of an integral value with identical order.
+ */
+template <class ValueType>
+inline typename std::make_unsigned<ValueType>::type
+radix_key(ValueType value)
+{
+  typedef typename std::make_unsigned<ValueType>::type key_t;
+  // Flip the sign bit of signed values so negative values precede
+  // positive values:
+  return std::is_signed<ValueType>::value
+         ? static_cast<key_t>(value) ^
+           (key_t(1) << (sizeof(ValueType) * 8 - 1))
+         : static_cast<key_t>(value);
+}
+
+/**
+ * Sort a local range of integral values in ascending order using a least
+ * significant digit radix sort with 8 bit digits.
+ * Digit histograms and the scatter phase are computed by OpenMP threads
+ * if available, passes are skipped if all values have identical digits.
+ */
+template <class ValueType, class Compare>
+void local_sort(
+  ValueType * l_first,
+  ValueType * l_last,
+  Compare     /* comp */,
+  std::true_type /* radix sortable */)
+{
+  static const int   radix  = 256;
+  const std::size_t  l_size = l_last - l_first;
+  if (l_size < 2) {
+    return;
+  }
+  int n_threads = static_cast<int>(
+                    std::min<std::size_t>(
+                      sort_num_threads(), 1 + l_size / (1 << 14)));
+  typedef std::array<std::size_t, radix> histogram_t;
+
+  std::vector<ValueType>   buffer(l_size);
+  std::vector<histogram_t> histograms(n_threads);
+  std::vector<std::size_t> part_offsets(n_threads + 1);
+  for (int t = 0; t <= n_threads; ++t) {
+    part_offsets[t] = (l_size * t) / n_threads;
+  }
+  ValueType * src = l_first;
+  ValueType * dst = buffer.data();
+  for (unsigned shift = 0; shift < sizeof(ValueType) * 8; shift += 8) {
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+    for (int t = 0; t < n_threads; ++t) {
+      histogram_t & hist = histograms[t];
+      hist.fill(0);
+      for (auto i = part_offsets[t]; i < part_offsets[t + 1]; ++i) {
+        ++hist[(radix_key(src[i]) >> shift) & (radix - 1)];
+      }
+    }
+    // Skip pass if all values have the same digit:
+    std::size_t max_digit_count = 0;
+    for (int d = 0; d < radix; ++d) {
+      std::size_t digit_count = 0;
+      for (int t = 0; t < n_threads; ++t) {
+        digit_count += histograms[t][d];
+      }
+      max_digit_count = std::max(max_digit_count, digit_count);
+    }
+    if (max_digit_count == l_size) {
+      continue;
+    }
+    // Exclusive prefix sum in (digit, thread) order yields the scatter
+    // offsets of every thread's partition, preserving stability:
+    std::size_t offset = 0;
+    for (int d = 0; d < radix; ++d) {
+      for (int t = 0; t < n_threads; ++t) {
+        std::size_t count = histograms[t][d];
+        histograms[t][d]  = offset;
+        offset           += count;
+      }
+    }
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+    for (int t = 0; t < n_threads; ++t) {
+      histogram_t & offsets = histograms[t];
+      for (auto i = part_offsets[t]; i < part_offsets[t + 1]; ++i) {
+        dst[offsets[(radix_key(src[i]) >> shift) & (radix - 1)]++] = src[i];
+      }
+    }
+    std::swap(src, dst);
+  }
+  if (src != l_first) {
+    std::copy(src, src + l_size, l_first);
+  }
+}
+
+/**
+ * Whether local ranges of values of the given type sorted by the given
+ * comparison function can be sorted by radix sort.
+ */
+template <class ValueType, class Compare>
+struct is_radix_sortable
+: std::integral_constant<bool,
+    std::is_integral<ValueType>::value &&
+    !std::is_same<ValueType, bool>::value &&
+    std::is_same<Compare, std::less<ValueType>>::value >
+{ };
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
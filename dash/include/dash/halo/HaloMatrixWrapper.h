@@ -7,7 +7,10 @@
 #include <dash/Pattern.h>
 #include <dash/halo/StencilOperator.h>
 #include <dash/memory/GlobStaticMem.h>
+#include <dash/util/EventTrace.h>
 
+#include <algorithm>
+#include <iterator>
 #include <type_traits>
 #include <vector>
 
@@ -15,6 +18,19 @@ namespace dash {
 
 namespace halo {
 
+/**
+ * Communication scheme used by \ref HaloMatrixWrapper to update the halo
+ * regions.
+ */
+enum class HaloExchange : uint8_t {
+  /// Every halo region is fetched from its owner with a separate get.
+  PULL,
+  /// Owners pack the boundary elements needed by a neighbor into a
+  /// contiguous buffer and put it to the neighbor. The communication plan
+  /// is computed once and replayed by every update.
+  PUSH
+};
+
 /**
  * As known from classic stencil algorithms, *boundaries* are the outermost
  * elements within a block that are requested by neighoring units.
@@ -246,6 +262,37 @@ public:
   HaloMatrixWrapper(MatrixT& matrix, const StencilSpecT&... stencil_spec)
   : HaloMatrixWrapper(matrix, GlobBoundSpec_t(), stencil_spec...) {}
 
+  /**
+   * Constructor that takes \ref Matrix, the \ref HaloExchange scheme used
+   * by all updates, a \ref GlobalBoundarySpec and a user defined number of
+   * stencil specifications (\ref StencilSpec).
+   *
+   * Collective operation, the communication plan of
+   * \c HaloExchange::PUSH is set up among all units in the team of the
+   * matrix.
+   */
+  template <typename... StencilSpecT>
+  HaloMatrixWrapper(MatrixT& matrix, HaloExchange exchange,
+                    const GlobBoundSpec_t& cycle_spec,
+                    const StencilSpecT&... stencil_spec)
+  : HaloMatrixWrapper(matrix, cycle_spec, stencil_spec...) {
+    _exchange = exchange;
+    if(_exchange == HaloExchange::PUSH)
+      init_push_plan();
+  }
+
+  /**
+   * Constructor that takes \ref Matrix, the \ref HaloExchange scheme used
+   * by all updates and a user defined number of stencil specifications
+   * (\ref StencilSpec).
+   * The \ref GlobalBoundarySpec is set to default.
+   */
+  template <typename... StencilSpecT>
+  HaloMatrixWrapper(MatrixT& matrix, HaloExchange exchange,
+                    const StencilSpecT&... stencil_spec)
+  : HaloMatrixWrapper(matrix, exchange, GlobBoundSpec_t(), stencil_spec...) {
+  }
+
   HaloMatrixWrapper() = delete;
 
   ~HaloMatrixWrapper() {
@@ -253,6 +300,9 @@ public:
       dart_type_destroy(&dart_type);
     }
     _dart_types.clear();
+    if(!DART_GPTR_ISNULL(_push_plan.recv_buffer)) {
+      dart_team_memfree(_push_plan.recv_buffer);
+    }
   }
 
   /**
@@ -260,10 +310,24 @@ public:
    */
   const HaloBlock_t& halo_block() { return _haloblock; }
 
+  /**
+   * Returns the \ref HaloExchange scheme used by \c update and
+   * \c update_async
+   */
+  HaloExchange exchange() const { return _exchange; }
+
   /**
    * Initiates a blocking halo region update for all halo elements.
+   *
+   * Collective operation for \c HaloExchange::PUSH.
    */
   void update() {
+    DASH_EVENT_TRACE_SCOPE("dash::halo::update");
+    if(_exchange == HaloExchange::PUSH) {
+      push_halos();
+      wait();
+      return;
+    }
     for(auto& region : _region_data) {
       update_halo_intern(region.second);
     }
@@ -273,6 +337,8 @@ public:
   /**
    * Initiates a blocking halo region update for all halo elements within the
    * the given region.
+   * Single regions are always fetched from their owner regardless of the
+   * \ref HaloExchange scheme.
    */
   void update_at(region_index_t index) {
     auto it_find = _region_data.find(index);
@@ -284,8 +350,17 @@ public:
 
   /**
    * Initiates an asychronous halo region update for all halo elements.
+   *
+   * Collective operation for \c HaloExchange::PUSH, the boundary elements
+   * are packed before returning so the local block may be modified until
+   * \c wait is called.
    */
   void update_async() {
+    DASH_EVENT_TRACE_SCOPE("dash::halo::update_async");
+    if(_exchange == HaloExchange::PUSH) {
+      push_halos();
+      return;
+    }
     for(auto& region : _region_data) {
       update_halo_intern(region.second);
     }
@@ -294,6 +369,8 @@ public:
   /**
    * Initiates an asychronous halo region update for all halo elements within
    * the given region.
+   * Single regions are always fetched from their owner regardless of the
+   * \ref HaloExchange scheme.
    */
   void update_async_at(region_index_t index) {
     auto it_find = _region_data.find(index);
@@ -305,8 +382,13 @@ public:
   /**
    * Waits until all halo updates are finished. Only useful for asynchronous
    * halo updates.
+   *
+   * Collective operation for \c HaloExchange::PUSH.
    */
   void wait() {
+    DASH_EVENT_TRACE_SCOPE("dash::halo::wait");
+    if(_exchange == HaloExchange::PUSH)
+      wait_push();
     for(auto& region : _region_data) {
       dart_wait_local(&region.second.handle);
     }
@@ -319,7 +401,30 @@ public:
   void wait(region_index_t index) {
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end())
-      dart_wait_local(it_find->second.handle);
+      dart_wait_local(&it_find->second.handle);
+  }
+
+  /**
+   * Returns true if the halo update of the given halo region is finished.
+   * Only useful for asynchronous halo updates.
+   *
+   * For \c HaloExchange::PUSH, halo regions are not updated separately and
+   * this waits until all halo updates are finished, which is a collective
+   * operation.
+   */
+  bool test(region_index_t index) {
+    if(_exchange == HaloExchange::PUSH) {
+      wait_push();
+      return true;
+    }
+    auto it_find = _region_data.find(index);
+    if(it_find == _region_data.end())
+      return true;
+
+    int32_t flag;
+    DASH_ASSERT_RETURNS(dart_test_local(&it_find->second.handle, &flag),
+                        DART_OK);
+    return flag != 0;
   }
 
   /**
@@ -431,6 +536,8 @@ public:
   /**
    * Crates \ref StencilOperator for a given \ref StencilSpec.
    * Asserts whether the StencilSpec fits in the provided halo regions.
+   * \ref StencilOperator::apply updates the halos via this wrapper, which
+   * has to outlive the operator.
    */
   template <typename StencilSpecT>
   StencilOperator<Element_t, Pattern_t, StencilSpecT> stencil_operator(
@@ -442,8 +549,16 @@ public:
         "Stencil point extent higher than halo region extent.");
     }
 
-    return StencilOperator<Element_t, Pattern_t, StencilSpecT>(
-      &_haloblock, &_halomemory, stencil_spec, &_view_local);
+    using StencilOperator_t =
+      StencilOperator<Element_t, Pattern_t, StencilSpecT>;
+    typename StencilOperator_t::HaloUpdate halo_update{
+      [this]() { update_async(); },
+      [this](region_index_t index) { return test(index); },
+      [this]() { wait(); }
+    };
+
+    return StencilOperator_t(&_haloblock, &_halomemory, stencil_spec,
+                             &_view_local, halo_update);
   }
 
 private:
@@ -453,6 +568,188 @@ private:
     dart_handle_t                       handle = DART_HANDLE_NULL;
   };
 
+  /**
+   * Persistent plan of the \c HaloExchange::PUSH scheme.
+   * Per neighbor, the plan stores the local offsets of the elements to pack
+   * or the halo memory offsets of the elements to unpack, respectively.
+   * Receive buffers are double buffered so a single barrier per update
+   * separates unpacking from the next update of the neighbors.
+   */
+  struct PushPlan {
+    struct Neighbor {
+      team_unit_t                  unit;
+      // offsets in the local block (send) or in the halo memory (receive)
+      std::vector<pattern_index_t> offsets;
+      // offset of the packed elements in the send or receive buffer
+      pattern_size_t               buf_offset;
+      // offset of the packed elements in the receive buffer of the neighbor
+      pattern_size_t               dest_offset;
+    };
+
+    std::vector<Neighbor>      send;
+    std::vector<Neighbor>      recv;
+    std::vector<dart_handle_t> handles;
+    std::vector<Element_t>     send_buffer;
+    dart_gptr_t                recv_buffer   = DART_GPTR_NULL;
+    Element_t*                 recv_lbegin   = nullptr;
+    pattern_size_t             recv_capacity = 0;
+    int                        parity        = 0;
+    bool                       in_flight     = false;
+  };
+
+  void init_push_plan() {
+    auto& team   = _matrix.team();
+    auto  nunits = team.size();
+
+    // Offsets of halo elements in the local block of their owner and in the
+    // halo memory, grouped by owner
+    std::vector<std::vector<pattern_index_t>> req_local(nunits);
+    std::vector<std::vector<pattern_index_t>> req_halo(nunits);
+    for(const auto& region : _haloblock.halo_regions()) {
+      if(region.size() == 0 || region.is_custom_region())
+        continue;
+
+      pattern_index_t halo_offset =
+        std::distance(_halomemory.begin(),
+                      _halomemory.first_element_at(region.index()));
+      auto it_end = region.end();
+      for(auto it = region.begin(); it != it_end; ++it, ++halo_offset) {
+        auto lpos = it.lpos();
+        req_local[lpos.unit].push_back(lpos.index);
+        req_halo[lpos.unit].push_back(halo_offset);
+      }
+    }
+
+    std::vector<size_t> nrecv(nunits), recv_displs(nunits);
+    std::vector<size_t> nsend(nunits), send_displs(nunits);
+    std::vector<size_t> dest_displs(nunits);
+    size_t              nrecv_total = 0;
+    for(size_t u = 0; u < nunits; ++u) {
+      nrecv[u]       = req_local[u].size();
+      recv_displs[u] = nrecv_total;
+      nrecv_total += nrecv[u];
+    }
+    auto size_type = dash::dart_datatype<size_t>::value;
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(nrecv.data(), nsend.data(), 1, size_type, team.dart_id()),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(recv_displs.data(), dest_displs.data(), 1, size_type,
+                    team.dart_id()),
+      DART_OK);
+    size_t nsend_total = 0;
+    for(size_t u = 0; u < nunits; ++u) {
+      send_displs[u] = nsend_total;
+      nsend_total += nsend[u];
+    }
+
+    // Send the requested offsets to the owners
+    std::vector<pattern_index_t> requests;
+    requests.reserve(nrecv_total);
+    for(const auto& req : req_local)
+      requests.insert(requests.end(), req.begin(), req.end());
+    std::vector<pattern_index_t> packs(nsend_total);
+    // Units may receive no halo but still have to send, data() of empty
+    // buffers must not be passed as it may be NULL
+    pattern_index_t request_dummy;
+    pattern_index_t pack_dummy;
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(requests.empty() ? &request_dummy : requests.data(),
+                     nrecv.data(), recv_displs.data(),
+                     dash::dart_datatype<pattern_index_t>::value,
+                     packs.empty() ? &pack_dummy : packs.data(),
+                     nsend.data(), send_displs.data(),
+                     team.dart_id()),
+      DART_OK);
+
+    for(size_t u = 0; u < nunits; ++u) {
+      if(nsend[u] > 0) {
+        auto first = packs.begin() + send_displs[u];
+        _push_plan.send.push_back(
+          { team_unit_t(u),
+            std::vector<pattern_index_t>(first, first + nsend[u]),
+            static_cast<pattern_size_t>(send_displs[u]),
+            static_cast<pattern_size_t>(dest_displs[u]) });
+      }
+      if(nrecv[u] > 0) {
+        _push_plan.recv.push_back(
+          { team_unit_t(u), std::move(req_halo[u]),
+            static_cast<pattern_size_t>(recv_displs[u]), 0 });
+      }
+    }
+    _push_plan.handles.resize(_push_plan.send.size(), DART_HANDLE_NULL);
+    _push_plan.send_buffer.resize(nsend_total);
+
+    // Receive buffers have to be allocated symmetrically
+    size_t recv_capacity = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&nrecv_total, &recv_capacity, 1, size_type, DART_OP_MAX,
+                     team.dart_id()),
+      DART_OK);
+    _push_plan.recv_capacity = recv_capacity;
+    if(recv_capacity == 0)
+      return;
+
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team.dart_id(),
+                                 2 * recv_capacity * sizeof(Element_t),
+                                 DART_TYPE_BYTE, &_push_plan.recv_buffer),
+      DART_OK);
+    dart_gptr_t gptr = _push_plan.recv_buffer;
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, team.myid()), DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(gptr, reinterpret_cast<void**>(
+                                &_push_plan.recv_lbegin)),
+      DART_OK);
+  }
+
+  void push_halos() {
+    DASH_ASSERT_MSG(!_push_plan.in_flight,
+                    "Halo update initiated before previous update finished");
+    const Element_t* lbegin = _matrix.lbegin();
+    auto recv_offset = _push_plan.parity * _push_plan.recv_capacity;
+    auto handle      = _push_plan.handles.begin();
+    for(auto& neighbor : _push_plan.send) {
+      auto* buf = _push_plan.send_buffer.data() + neighbor.buf_offset;
+      auto* out = buf;
+      for(auto offset : neighbor.offsets)
+        *(out++) = lbegin[offset];
+
+      dart_gptr_t gptr = _push_plan.recv_buffer;
+      DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, neighbor.unit), DART_OK);
+      gptr.addr_or_offs.offset +=
+        (recv_offset + neighbor.dest_offset) * sizeof(Element_t);
+      auto ds = dart_storage<Element_t>(neighbor.offsets.size());
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(gptr, buf, ds.nelem, ds.dtype, ds.dtype, &*handle),
+        DART_OK);
+      ++handle;
+    }
+    _push_plan.in_flight = true;
+  }
+
+  void wait_push() {
+    if(!_push_plan.in_flight)
+      return;
+
+    DASH_ASSERT_RETURNS(
+      dart_waitall(_push_plan.handles.data(), _push_plan.handles.size()),
+      DART_OK);
+    // all elements have been pushed to this unit
+    _matrix.team().barrier();
+
+    const Element_t* buf_begin =
+      _push_plan.recv_lbegin + _push_plan.parity * _push_plan.recv_capacity;
+    auto halo_begin = _halomemory.begin();
+    for(const auto& neighbor : _push_plan.recv) {
+      auto* buf = buf_begin + neighbor.buf_offset;
+      for(auto offset : neighbor.offsets)
+        halo_begin[offset] = *(buf++);
+    }
+    _push_plan.parity ^= 1;
+    _push_plan.in_flight = false;
+  }
+
   void update_halo_intern(Data& data) {
     if(data.region.is_custom_region())
       return;
@@ -483,6 +780,8 @@ private:
   HaloMemory_t                   _halomemory;
   std::map<region_index_t, Data> _region_data;
   std::vector<dart_datatype_t>   _dart_types;
+  HaloExchange                   _exchange = HaloExchange::PULL;
+  PushPlan                       _push_plan;
 };
 
 }  // namespace halo
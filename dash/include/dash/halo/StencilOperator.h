@@ -3,6 +3,14 @@
 
 #include <dash/halo/iterator/StencilIterator.h>
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
 namespace dash {
 
 namespace halo {
@@ -293,19 +301,45 @@ public:
 
   using region_index_t = typename RegionSpec<NumDimensions>::region_index_t;
 
+  /// Values of all stencil points of an element passed to the kernel of
+  /// \ref apply
+  using StencilValues_t = std::array<ElementT, NumStencilPoints>;
+
+  /**
+   * Functions of the \ref HaloMatrixWrapper updating the halo memory used
+   * by \ref apply.
+   */
+  struct HaloUpdate {
+    /// initiates the update of all halo regions
+    std::function<void()>               update_async;
+    /// returns true if the given halo region is up to date
+    std::function<bool(region_index_t)> test;
+    /// waits until all halo regions are up to date
+    std::function<void()>               wait;
+  };
+
+private:
+  using RegionCoords_t = RegionCoords<NumDimensions>;
+  using BoundaryRegions_t =
+    std::array<std::vector<region_index_t>, 2 * NumDimensions>;
+
 public:
   /**
    * Constructor that takes a \ref HaloBlock, a \ref HaloMemory,
-   * a \ref StencilSpec and a local \ref ViewSpec
+   * a \ref StencilSpec, a local \ref ViewSpec and the functions updating
+   * the halo memory.
    */
   StencilOperator(const HaloBlock_t* haloblock, HaloMemory_t* halomemory,
                   const StencilSpecT& stencil_spec,
-                  const ViewSpec_t*   view_local)
+                  const ViewSpec_t*   view_local,
+                  const HaloUpdate&   halo_update = HaloUpdate())
   : inner(this), boundary(this), _halo_block(haloblock),
     _halo_memory(halomemory), _stencil_spec(stencil_spec),
     _view_local(view_local), _stencil_offsets(set_stencil_offsets()),
     _local_memory((ElementT*) _halo_block->globmem().lbegin()),
     _spec_views(*_halo_block, _stencil_spec, _view_local),
+    _halo_update(halo_update),
+    _bnd_halo_regions(set_boundary_halo_regions()),
     _begin(_local_memory, _halo_memory, &_stencil_spec, &_stencil_offsets,
            *_view_local, _spec_views.inner_with_boundaries(), 0),
     _end(_local_memory, _halo_memory, &_stencil_spec, &_stencil_offsets,
@@ -368,6 +402,55 @@ public:
    */
   const ViewSpec_t& view() const { return _spec_views.inner_with_boundaries(); }
 
+  /**
+   * Applies the stencil to all inner and boundary elements and overlaps the
+   * computation with the halo update.
+   *
+   * Initiates the halo update, computes the inner elements and then every
+   * boundary view as soon as the halo regions it depends on are up to date.
+   * For every element, the kernel is called with the value of the element
+   * and the values of all stencil points in the order of the
+   * \ref StencilSpec:
+   *
+   *     ElementT kernel(const ElementT& center, const StencilValues_t& values)
+   *
+   * and its result is written to \c out at the local offset of the element.
+   * \c out must provide space for all elements of the local block and must
+   * not overlap with it. Elements outside of the inner and boundary views
+   * are not written.
+   *
+   * Collective operation if the halo exchange of the creating
+   * \ref HaloMatrixWrapper is collective.
+   */
+  template <typename KernelT>
+  void apply(KernelT kernel, ElementT* out) {
+    if(_halo_update.update_async)
+      _halo_update.update_async();
+
+    apply_inner(kernel, out);
+
+    std::vector<dim_t> pending;
+    const auto& bnd_views = _spec_views.boundary_views();
+    for(dim_t v = 0; v < static_cast<dim_t>(bnd_views.size()); ++v) {
+      if(bnd_views[v].size() > 0)
+        pending.push_back(v);
+    }
+    while(!pending.empty()) {
+      auto it = pending.begin();
+      while(it != pending.end()) {
+        if(halo_regions_ready(*it)) {
+          apply_boundary(*it, kernel, out);
+          it = pending.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    if(_halo_update.wait)
+      _halo_update.wait();
+  }
+
   /*
   ElementT get_value_at_inner_local(
     const ElementCoords_t& coords, ElementT coefficient_center,
@@ -418,6 +501,129 @@ public:
   */
 
 private:
+  template <typename KernelT>
+  void apply_inner(KernelT& kernel, ElementT* out) {
+    const auto& view = _spec_views.inner();
+    if(view.size() == 0)
+      return;
+
+    // elements are computed line by line along the fastest dimension
+    constexpr dim_t dim_fast =
+      (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+    const signed_pattern_size_t line_size = view.extent(dim_fast);
+    const signed_pattern_size_t num_lines = view.size() / line_size;
+    const ElementT*             lmem      = _local_memory;
+    const auto&                 offsets   = _stencil_offsets;
+
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for(signed_pattern_size_t line = 0; line < num_lines; ++line) {
+      // coordinates of the first element of the line
+      ElementCoords_t       coords;
+      signed_pattern_size_t line_tmp = line;
+      if(MemoryArrange == ROW_MAJOR) {
+        coords[dim_fast] = view.offset(dim_fast);
+        for(dim_t d = NumDimensions - 1; d > 0;) {
+          --d;
+          coords[d] = view.offset(d) + line_tmp % view.extent(d);
+          line_tmp /= view.extent(d);
+        }
+      } else {
+        coords[dim_fast] = view.offset(dim_fast);
+        for(dim_t d = 1; d < NumDimensions; ++d) {
+          coords[d] = view.offset(d) + line_tmp % view.extent(d);
+          line_tmp /= view.extent(d);
+        }
+      }
+      const auto      offset = get_offset(coords);
+      const ElementT* center = lmem + offset;
+      ElementT*       res    = out + offset;
+      for(signed_pattern_size_t i = 0; i < line_size; ++i) {
+        StencilValues_t values;
+        for(auto p = 0; p < NumStencilPoints; ++p)
+          values[p] = center[i + offsets[p]];
+        res[i] = kernel(center[i], values);
+      }
+    }
+  }
+
+  template <typename KernelT>
+  void apply_boundary(dim_t view_index, KernelT& kernel, ElementT* out) {
+    const auto&    bnd_views = _spec_views.boundary_views();
+    pattern_size_t offset    = 0;
+    for(dim_t v = 0; v < view_index; ++v)
+      offset += bnd_views[v].size();
+
+    iterator_bnd    it(_local_memory, _halo_memory, &_stencil_spec,
+                       &_stencil_offsets, *_view_local, bnd_views, offset);
+    const auto      size = bnd_views[view_index].size();
+    StencilValues_t values;
+    for(pattern_size_t i = 0; i < size; ++i, ++it) {
+      for(auto p = 0; p < NumStencilPoints; ++p)
+        values[p] = it.value_at(p);
+      out[it.lpos()] = kernel(*it, values);
+    }
+  }
+
+  bool halo_regions_ready(dim_t view_index) {
+    if(!_halo_update.test)
+      return true;
+
+    for(auto index : _bnd_halo_regions[view_index]) {
+      if(!_halo_update.test(index))
+        return false;
+    }
+
+    return true;
+  }
+
+  /*
+   * Collects the halo regions accessed by the stencil points of the
+   * elements of every boundary view.
+   */
+  BoundaryRegions_t set_boundary_halo_regions() {
+    BoundaryRegions_t bnd_regions;
+    const auto&       bnd_views = _spec_views.boundary_views();
+    for(std::size_t v = 0; v < bnd_views.size() && v < bnd_regions.size();
+        ++v) {
+      const auto& view    = bnd_views[v];
+      auto&       indexes = bnd_regions[v];
+      if(view.size() == 0)
+        continue;
+
+      for(auto p = 0; p < NumStencilPoints; ++p) {
+        // region coordinates reached by the stencil point per dimension
+        std::array<std::array<bool, 3>, NumDimensions> reached{};
+        for(dim_t d = 0; d < NumDimensions; ++d) {
+          signed_pattern_size_t first = view.offset(d) + _stencil_spec[p][d];
+          signed_pattern_size_t last  = first + view.extent(d) - 1;
+          signed_pattern_size_t extent = _view_local->extent(d);
+          reached[d][0] = first < 0;
+          reached[d][1] = last >= 0 && first < extent;
+          reached[d][2] = last >= extent;
+        }
+        for(region_index_t index = 0; index < RegionCoords_t::MaxIndex;
+            ++index) {
+          auto coords = RegionCoords_t::coords(index);
+          bool valid  = true;
+          bool local  = true;
+          for(dim_t d = 0; d < NumDimensions; ++d) {
+            valid &= reached[d][coords[d]];
+            local &= (coords[d] == 1);
+          }
+          if(valid && !local)
+            indexes.push_back(index);
+        }
+      }
+      std::sort(indexes.begin(), indexes.end());
+      indexes.erase(std::unique(indexes.begin(), indexes.end()),
+                    indexes.end());
+    }
+
+    return bnd_regions;
+  }
+
   StencilOffsets_t set_stencil_offsets() {
     StencilOffsets_t stencil_offs;
     for(auto i = 0; i < NumStencilPoints; ++i) {
@@ -439,7 +645,7 @@ private:
     return stencil_offs;
   }
 
-  pattern_index_t get_offset(const ElementCoords_t& coords) {
+  pattern_index_t get_offset(const ElementCoords_t& coords) const {
     pattern_index_t offset = 0;
 
     if(MemoryArrange == ROW_MAJOR) {
@@ -469,6 +675,8 @@ private:
   StencilOffsets_t   _stencil_offsets;
   ElementT*          _local_memory;
   StencilSpecViews_t _spec_views;
+  HaloUpdate         _halo_update;
+  BoundaryRegions_t  _bnd_halo_regions;
 
   iterator       _begin;
   iterator       _end;
@@ -0,0 +1,425 @@
+#ifndef DASH__HALO_TEMPORALBLOCKING_H
+#define DASH__HALO_TEMPORALBLOCKING_H
+
+#include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/StencilOperator.h>
+
+#include <dash/Exception.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace dash {
+
+namespace halo {
+
+/**
+ * Computes multiple time steps of a stencil between two halo exchanges.
+ *
+ * The halo width is \c depth times the stencil radius. After every halo
+ * exchange the local block and its halos are copied into a padded local
+ * buffer and up to \c depth time steps are computed locally. The region
+ * computed per time step shrinks by the stencil radius, so the local block
+ * is valid after the last step. Redundant computation in the halo regions
+ * trades for \c depth times fewer messages.
+ *
+ * Elements at global borders are handled like in \ref StencilOperator:
+ * with \c BoundaryProp::NONE, elements whose stencil points leave the
+ * matrix keep their value, with \c BoundaryProp::CUSTOM the custom halo
+ * values are constant over all time steps.
+ *
+ * Example for a five-point stencil computing four time steps per halo
+ * exchange:
+ *
+ *     TemporalBlocking<Matrix_t, StencilSpec_t> blocking(
+ *       matrix, bound_spec, stencil_spec, 4);
+ *     blocking.run(
+ *       [](const double& center, const std::array<double, 4>& values) {
+ *         return 0.2 * (center + values[0] + values[1] + values[2]
+ *                       + values[3]);
+ *       },
+ *       num_steps);
+ */
+template <typename MatrixT, typename StencilSpecT>
+class TemporalBlocking {
+private:
+  using Pattern_t       = typename MatrixT::pattern_type;
+  using pattern_index_t = typename Pattern_t::index_type;
+  using pattern_size_t  = typename Pattern_t::size_type;
+  using signed_pattern_size_t =
+    typename std::make_signed<pattern_size_t>::type;
+
+  static constexpr auto NumDimensions    = Pattern_t::ndim();
+  static constexpr auto NumStencilPoints = StencilSpecT::num_stencil_points();
+  static constexpr auto MemoryArrange    = Pattern_t::memory_order();
+
+  using RegionCoords_t = RegionCoords<NumDimensions>;
+  using StencilPoint_t = typename StencilSpecT::StencilPoint_t;
+  using DeepStencilSpec_t =
+    StencilSpec<StencilPoint<NumDimensions>, RegionCoords_t::MaxIndex - 1>;
+  using Coords_t       = std::array<signed_pattern_size_t, NumDimensions>;
+
+public:
+  using Element_t        = typename MatrixT::value_type;
+  using HaloWrapper_t    = HaloMatrixWrapper<MatrixT>;
+  using GlobBoundSpec_t  = GlobalBoundarySpec<NumDimensions>;
+  using StencilValues_t  = std::array<Element_t, NumStencilPoints>;
+
+public:
+  /**
+   * Constructor that takes \ref Matrix, a \ref GlobalBoundarySpec, the
+   * \ref StencilSpec of one time step, the number of time steps computed
+   * per halo exchange and the \ref HaloExchange scheme.
+   *
+   * Collective operation. The halo width must not exceed the extent of the
+   * local block of any unit.
+   */
+  TemporalBlocking(MatrixT& matrix, const GlobBoundSpec_t& bound_spec,
+                   const StencilSpecT& stencil_spec, int depth,
+                   HaloExchange exchange = HaloExchange::PULL)
+  : _matrix(matrix), _bound_spec(bound_spec), _stencil_spec(stencil_spec),
+    _depth(depth), _radius(stencil_radius(stencil_spec)),
+    _width(checked_width(matrix, depth, _radius)),
+    _halo_wrapper(matrix, exchange, bound_spec,
+                  deep_stencil_spec(_width)) {
+    const auto& view_local = _halo_wrapper.view_local();
+    const auto& offsets    = _matrix.local.offsets();
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      _extents[d]        = view_local.extent(d);
+      _padded_extents[d] = _extents[d] + 2 * _width;
+      _offsets[d]        = offsets[d];
+    }
+    pattern_size_t padded_size = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      padded_size *= _padded_extents[d];
+    _buffers[0].resize(padded_size);
+    _buffers[1].resize(padded_size);
+
+    for(auto p = 0; p < NumStencilPoints; ++p) {
+      Coords_t point;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        point[d] = _stencil_spec[p][d];
+      _stencil_offsets[p] = padded_offset(point);
+    }
+  }
+
+  TemporalBlocking() = delete;
+
+  /**
+   * Number of time steps computed per halo exchange
+   */
+  int depth() const { return _depth; }
+
+  /**
+   * Width of the halo regions
+   */
+  int halo_width() const { return _width; }
+
+  /**
+   * Returns the underlying \ref HaloMatrixWrapper with halo regions of
+   * width \c depth times the stencil radius.
+   */
+  HaloWrapper_t& halo_wrapper() { return _halo_wrapper; }
+
+  /**
+   * Computes \c num_steps time steps with one halo exchange per \c depth
+   * time steps and stores the result in the local block of the matrix.
+   * The kernel has the signature of the kernel of
+   * \ref StencilOperator::apply.
+   *
+   * Collective operation.
+   */
+  template <typename KernelT>
+  void run(KernelT kernel, int num_steps) {
+    while(num_steps > 0) {
+      auto steps = std::min(num_steps, _depth);
+      step(kernel, steps);
+      num_steps -= steps;
+    }
+  }
+
+  /**
+   * Exchanges the halos once and computes \c num_steps time steps, at most
+   * \c depth.
+   *
+   * Collective operation.
+   */
+  template <typename KernelT>
+  void step(KernelT kernel, int num_steps) {
+    DASH_ASSERT_RANGE(1, num_steps, _depth, "Invalid number of time steps");
+    _halo_wrapper.update();
+    if(_halo_wrapper.exchange() == HaloExchange::PULL) {
+      // neighbors finished reading the local block
+      _matrix.team().barrier();
+    }
+
+    fill_buffer();
+    _buffers[1] = _buffers[0];
+
+    int current = 0;
+    for(int s = 1; s <= num_steps; ++s) {
+      Coords_t lo, hi;
+      compute_range((num_steps - s) * _radius, lo, hi);
+      sweep(kernel, _buffers[current].data(), _buffers[current ^ 1].data(),
+            lo, hi);
+      current ^= 1;
+    }
+
+    // copy the local block back to the matrix
+    Coords_t lo, hi;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      lo[d] = _width;
+      hi[d] = _width + _extents[d];
+    }
+    const Element_t* buffer = _buffers[current].data();
+    Element_t*       lmem   = _matrix.lbegin();
+    pattern_size_t   pos    = 0;
+    for_each_line(lo, hi, [&](pattern_size_t offset, pattern_size_t size) {
+      std::copy(buffer + offset, buffer + offset + size, lmem + pos);
+      pos += size;
+    });
+
+    if(_halo_wrapper.exchange() == HaloExchange::PULL) {
+      // local blocks are up to date before the next halo exchange
+      _matrix.team().barrier();
+    }
+  }
+
+private:
+  static int stencil_radius(const StencilSpecT& stencil_spec) {
+    int radius = 0;
+    for(const auto& point : stencil_spec.specs())
+      radius = std::max(radius, point.max());
+
+    return radius;
+  }
+
+  /*
+   * Stencil specification reaching all halo regions with the given width.
+   */
+  static DeepStencilSpec_t deep_stencil_spec(int width) {
+    typename DeepStencilSpec_t::StencilArray_t points;
+    std::size_t                                p = 0;
+    for(typename RegionCoords_t::region_index_t index = 0;
+        index < RegionCoords_t::MaxIndex; ++index) {
+      auto coords = RegionCoords_t::coords(index);
+      bool center = true;
+      StencilPoint<NumDimensions> point;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        point[d] = (static_cast<int>(coords[d]) - 1) * width;
+        center &= (coords[d] == 1);
+      }
+      if(!center)
+        points[p++] = point;
+    }
+
+    return DeepStencilSpec_t(points);
+  }
+
+  /**
+   * Validates depth and resulting halo width before the halo regions are
+   * allocated.
+   *
+   * Collective operation.
+   */
+  static int checked_width(MatrixT& matrix, int depth, int radius) {
+    if(depth <= 0) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "Depth " << depth << " of temporal blocking must be "
+                 "positive");
+    }
+    const int width = depth * radius;
+    size_t min_extent = matrix.local.extent(0);
+    for(dim_t d = 1; d < NumDimensions; ++d)
+      min_extent = std::min<size_t>(min_extent, matrix.local.extent(d));
+    size_t min_extent_all;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&min_extent, &min_extent_all, 1,
+                     dash::dart_datatype<size_t>::value, DART_OP_MIN,
+                     matrix.team().dart_id()),
+      DART_OK);
+    if(static_cast<size_t>(width) > min_extent_all) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "Halo width " << width << " of temporal blocking exceeds "
+                 "smallest local block extent " << min_extent_all);
+    }
+    return width;
+  }
+
+  signed_pattern_size_t padded_offset(const Coords_t& coords) const {
+    signed_pattern_size_t offset = 0;
+    if(MemoryArrange == ROW_MAJOR) {
+      offset = coords[0];
+      for(dim_t d = 1; d < NumDimensions; ++d)
+        offset = offset * _padded_extents[d] + coords[d];
+    } else {
+      offset = coords[NumDimensions - 1];
+      for(dim_t d = NumDimensions - 1; d > 0;) {
+        --d;
+        offset = offset * _padded_extents[d] + coords[d];
+      }
+    }
+
+    return offset;
+  }
+
+  /*
+   * Calls f(offset, size) for every line along the fastest dimension of the
+   * box [lo, hi) of the padded buffer in memory order.
+   */
+  template <typename FunctionT>
+  void for_each_line(const Coords_t& lo, const Coords_t& hi,
+                     FunctionT f) const {
+    constexpr dim_t dim_fast =
+      (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+    signed_pattern_size_t num_lines = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(hi[d] <= lo[d])
+        return;
+      if(d != dim_fast)
+        num_lines *= hi[d] - lo[d];
+    }
+    for(signed_pattern_size_t line = 0; line < num_lines; ++line)
+      f(padded_offset(line_coords(lo, hi, line)), hi[dim_fast] - lo[dim_fast]);
+  }
+
+  Coords_t line_coords(const Coords_t& lo, const Coords_t& hi,
+                       signed_pattern_size_t line) const {
+    Coords_t coords;
+    if(MemoryArrange == ROW_MAJOR) {
+      coords[NumDimensions - 1] = lo[NumDimensions - 1];
+      for(dim_t d = NumDimensions - 1; d > 0;) {
+        --d;
+        coords[d] = lo[d] + line % (hi[d] - lo[d]);
+        line /= hi[d] - lo[d];
+      }
+    } else {
+      coords[0] = lo[0];
+      for(dim_t d = 1; d < NumDimensions; ++d) {
+        coords[d] = lo[d] + line % (hi[d] - lo[d]);
+        line /= hi[d] - lo[d];
+      }
+    }
+
+    return coords;
+  }
+
+  /*
+   * Copies the local block and all halo regions into the padded buffer.
+   */
+  void fill_buffer() {
+    auto&    buffer = _buffers[0];
+    Coords_t lo, hi;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      lo[d] = _width;
+      hi[d] = _width + _extents[d];
+    }
+    const Element_t* lmem = _matrix.lbegin();
+    for_each_line(lo, hi, [&](pattern_size_t offset, pattern_size_t size) {
+      std::copy(lmem, lmem + size, buffer.begin() + offset);
+      lmem += size;
+    });
+
+    auto& halo_memory = _halo_wrapper.halo_memory();
+    for(const auto& region : _halo_wrapper.halo_block().halo_regions()) {
+      if(region.size() == 0)
+        continue;
+
+      const auto& spec = region.spec();
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        auto extent = region.view().extent(d);
+        if(spec[d] == 0)
+          lo[d] = _width - extent;
+        else if(spec[d] == 1)
+          lo[d] = _width;
+        else
+          lo[d] = _width + _extents[d];
+        hi[d] = lo[d] + extent;
+      }
+      auto it_halo = halo_memory.range_at(region.index()).first;
+      for_each_line(lo, hi, [&](pattern_size_t offset, pattern_size_t size) {
+        std::copy(it_halo, it_halo + size, buffer.begin() + offset);
+        it_halo += size;
+      });
+    }
+  }
+
+  /*
+   * Range [lo, hi) of the padded buffer computed in a time step that
+   * extends the local block by the given extension.
+   */
+  void compute_range(int extension, Coords_t& lo, Coords_t& hi) const {
+    auto minmax = _stencil_spec.minmax_distances();
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      lo[d] = _width - extension;
+      hi[d] = _width + _extents[d] + extension;
+      // padded buffer coordinates of the global border
+      signed_pattern_size_t border_lo = _width - _offsets[d];
+      signed_pattern_size_t border_hi =
+        border_lo + _matrix.pattern().extent(d);
+      if(_bound_spec[d] == BoundaryProp::CUSTOM) {
+        lo[d] = std::max(lo[d], border_lo);
+        hi[d] = std::min(hi[d], border_hi);
+      } else if(_bound_spec[d] == BoundaryProp::NONE) {
+        lo[d] = std::max(lo[d], border_lo - minmax[d].first);
+        hi[d] = std::min(hi[d], border_hi - minmax[d].second);
+      }
+    }
+  }
+
+  template <typename KernelT>
+  void sweep(KernelT& kernel, const Element_t* in, Element_t* out,
+             const Coords_t& lo, const Coords_t& hi) const {
+    constexpr dim_t dim_fast =
+      (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+    signed_pattern_size_t num_lines = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(hi[d] <= lo[d])
+        return;
+      if(d != dim_fast)
+        num_lines *= hi[d] - lo[d];
+    }
+    const signed_pattern_size_t line_size = hi[dim_fast] - lo[dim_fast];
+    const auto&                 offsets   = _stencil_offsets;
+
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for(signed_pattern_size_t line = 0; line < num_lines; ++line) {
+      const auto       offset = padded_offset(line_coords(lo, hi, line));
+      const Element_t* center = in + offset;
+      Element_t*       res    = out + offset;
+      for(signed_pattern_size_t i = 0; i < line_size; ++i) {
+        StencilValues_t values;
+        for(auto p = 0; p < NumStencilPoints; ++p)
+          values[p] = center[i + offsets[p]];
+        res[i] = kernel(center[i], values);
+      }
+    }
+  }
+
+private:
+  MatrixT&                                               _matrix;
+  const GlobBoundSpec_t                                  _bound_spec;
+  const StencilSpecT                                     _stencil_spec;
+  const int                                              _depth;
+  const int                                              _radius;
+  const int                                              _width;
+  HaloWrapper_t                                          _halo_wrapper;
+  Coords_t                                               _extents;
+  Coords_t                                               _padded_extents;
+  Coords_t                                               _offsets;
+  std::array<signed_pattern_size_t, NumStencilPoints>    _stencil_offsets;
+  std::array<std::vector<Element_t>, 2>                  _buffers;
+};
+
+}  // namespace halo
+
+}  // namespace dash
+
+#endif  // DASH__HALO_TEMPORALBLOCKING_H
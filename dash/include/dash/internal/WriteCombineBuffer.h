@@ -0,0 +1,372 @@
+#ifndef DASH__INTERNAL__WRITE_COMBINE_BUFFER_H__INCLUDED
+#define DASH__INTERNAL__WRITE_COMBINE_BUFFER_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Queue of asynchronous single-element writes to global memory that are
+ * combined per target unit.
+ *
+ * Writes are queued per target unit until \c commit, \c flush or
+ * \c flush_local is called or the queue of a unit exceeds the
+ * capacity. Queued writes to a unit are then sorted by address, repeated
+ * writes of the same element are reduced to the last written value and
+ * adjacent elements are merged to contiguous blocks. The blocks are
+ * transferred in a single contiguous put or in indexed puts of up to
+ * \c MaxBlocks blocks.
+ *
+ * Completion of all transfers is established by a single flush per target
+ * unit in \c flush. Transfers to a unit that have not been completed at
+ * the unit when further writes to the unit are issued are completed by a
+ * flush first, so later writes of an element take effect after earlier
+ * ones. Local completion only releases send buffers.
+ *
+ * All writes must refer to elements of type \c T in the same global
+ * memory segment.
+ */
+template <typename T>
+class WriteCombineBuffer
+{
+private:
+  typedef WriteCombineBuffer<T>  self_t;
+
+public:
+  typedef T                      value_type;
+
+  /// Default number of queued writes per unit before they are issued
+  static constexpr size_t DefaultCapacity = 4096;
+
+  /// Maximum number of blocks in a single indexed put
+  static constexpr size_t MaxBlocks       = 256;
+
+private:
+  struct write_t {
+    /// Byte offset of the target element in the segment
+    std::uint64_t offset;
+    T             value;
+  };
+
+  struct unit_queue {
+    /// Queued writes in order of their submission
+    std::vector<write_t>        writes;
+    /// Send buffers of issued transfers, released on local completion
+    std::vector<std::vector<T>> issued;
+    /// Whether issued transfers may not have completed at the unit
+    bool                        remote_pending = false;
+  };
+
+public:
+  explicit WriteCombineBuffer(size_t capacity = DefaultCapacity)
+  : _capacity(std::max<size_t>(capacity, 1))
+  { }
+
+  WriteCombineBuffer(const self_t & other)         = delete;
+  self_t & operator=(const self_t & other)         = delete;
+
+  /**
+   * Queue a write of \c value to the element referenced by \c gptr.
+   */
+  void push(dart_gptr_t gptr, const T & value)
+  {
+    if (DART_GPTR_ISNULL(_gptr)) {
+      _gptr = gptr;
+    }
+    DASH_ASSERT_MSG(gptr.segid == _gptr.segid &&
+                    gptr.teamid == _gptr.teamid,
+                    "WriteCombineBuffer: writes to different segments");
+    size_t unit = static_cast<size_t>(gptr.unitid);
+    if (_queues.size() <= unit) {
+      _queues.resize(unit + 1);
+    }
+    auto & queue = _queues[unit];
+    queue.writes.push_back(write_t { gptr.addr_or_offs.offset, value });
+    ++_num_writes;
+    if (queue.writes.size() >= _capacity) {
+      issue(unit);
+    }
+  }
+
+  /**
+   * Issue transfers of all queued writes without waiting for their
+   * completion.
+   */
+  void commit()
+  {
+    for (size_t u = 0; u < _queues.size(); ++u) {
+      if (!_queues[u].writes.empty()) {
+        issue(u);
+      }
+    }
+  }
+
+  /**
+   * Issue transfers of all queued writes and wait for their completion
+   * at the target units.
+   */
+  void flush()
+  {
+    commit();
+    complete(dart_flush, true);
+  }
+
+  /**
+   * Issue transfers of all queued writes and wait for their local
+   * completion.
+   */
+  void flush_local()
+  {
+    commit();
+    complete(dart_flush_local, false);
+  }
+
+  /**
+   * Release send buffers of transfers that have been completed at all
+   * units by a flush outside of this buffer.
+   */
+  void release()
+  {
+    bool empty = true;
+    for (auto & queue : _queues) {
+      queue.issued.clear();
+      queue.remote_pending = false;
+      empty = empty && queue.writes.empty();
+    }
+    if (empty) {
+      // allows to write to another segment
+      _gptr = DART_GPTR_NULL;
+    }
+  }
+
+  /**
+   * Release send buffers of transfers to the given unit that have been
+   * completed at the unit by a flush outside of this buffer.
+   */
+  void release(size_t unit)
+  {
+    if (unit < _queues.size()) {
+      _queues[unit].issued.clear();
+      _queues[unit].remote_pending = false;
+    }
+  }
+
+  /**
+   * Release send buffers of transfers that have been completed locally by
+   * a flush outside of this buffer.
+   * Transfers are still completed at their target units before further
+   * writes to the units are issued.
+   */
+  void release_local()
+  {
+    for (auto & queue : _queues) {
+      queue.issued.clear();
+    }
+  }
+
+  /**
+   * Release send buffers of transfers to the given unit that have been
+   * completed locally by a flush outside of this buffer.
+   */
+  void release_local(size_t unit)
+  {
+    if (unit < _queues.size()) {
+      _queues[unit].issued.clear();
+    }
+  }
+
+  /**
+   * Number of writes pushed to the queue.
+   */
+  size_t num_writes() const noexcept {
+    return _num_writes;
+  }
+
+  /**
+   * Number of put operations issued for the writes.
+   */
+  size_t num_transfers() const noexcept {
+    return _num_transfers;
+  }
+
+  /**
+   * Maximum number of queued writes per unit.
+   */
+  size_t capacity() const noexcept {
+    return _capacity;
+  }
+
+private:
+  /**
+   * Issue the queued writes to the given unit as contiguous or indexed
+   * puts.
+   */
+  void issue(size_t unit)
+  {
+    auto & queue  = _queues[unit];
+    auto & writes = queue.writes;
+    dart_gptr_t gptr = _gptr;
+    gptr.unitid      = static_cast<dart_unit_t>(unit);
+    if (queue.remote_pending) {
+      // Puts are not ordered, earlier transfers to the unit must complete
+      // at the unit before elements they wrote may be overwritten:
+      DASH_ASSERT_RETURNS(
+        dart_flush(gptr),
+        DART_OK);
+      queue.issued.clear();
+      queue.remote_pending = false;
+    }
+    // Sort by address, preserving the order of writes to the same element
+    // so the last written value takes effect:
+    std::stable_sort(writes.begin(), writes.end(),
+                     [](const write_t & a, const write_t & b) {
+                       return a.offset < b.offset;
+                     });
+    std::vector<T>             values;
+    // Blocks of contiguous elements as (element offset, number of elements)
+    // relative to the first write:
+    std::vector<std::pair<size_t, size_t>> blocks;
+    values.reserve(writes.size());
+    const std::uint64_t base = writes.front().offset;
+    for (const auto & w : writes) {
+      size_t elem_offset = (w.offset - base) / sizeof(T);
+      if (!blocks.empty()) {
+        auto & last = blocks.back();
+        if (last.first + last.second - 1 == elem_offset) {
+          // repeated write of the same element
+          values.back() = w.value;
+          continue;
+        }
+        if (last.first + last.second == elem_offset) {
+          values.push_back(w.value);
+          ++last.second;
+          continue;
+        }
+      }
+      values.push_back(w.value);
+      blocks.push_back(std::make_pair(elem_offset, size_t(1)));
+    }
+    writes.clear();
+    DASH_LOG_TRACE("WriteCombineBuffer.issue", "unit:", unit,
+                   "elements:", values.size(), "blocks:", blocks.size());
+
+    gptr.addr_or_offs.offset = base;
+
+    const T * src = values.data();
+    for (size_t b_first = 0; b_first < blocks.size();
+         b_first += MaxBlocks) {
+      size_t b_last = std::min(b_first + MaxBlocks, blocks.size());
+      put_blocks(gptr, src, blocks, b_first, b_last);
+      for (size_t b = b_first; b < b_last; ++b) {
+        src += blocks[b].second;
+      }
+    }
+    // send buffer must not be released before transfers completed:
+    queue.issued.push_back(std::move(values));
+    queue.remote_pending = true;
+  }
+
+  /**
+   * Put the values of blocks in range <tt>[b_first, b_last)</tt>.
+   */
+  void put_blocks(
+    dart_gptr_t                                    gptr,
+    const T                                      * src,
+    const std::vector<std::pair<size_t, size_t>> & blocks,
+    size_t                                         b_first,
+    size_t                                         b_last)
+  {
+    dash::dart_storage<T> ds(1);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, blocks[b_first].first * sizeof(T)),
+      DART_OK);
+    ++_num_transfers;
+    if (b_last - b_first == 1) {
+      DASH_ASSERT_RETURNS(
+        dart_put(gptr, src,
+                 ds.nelem * blocks[b_first].second,
+                 ds.dtype, ds.dtype),
+        DART_OK);
+      return;
+    }
+    std::vector<size_t> blocklens(b_last - b_first);
+    std::vector<size_t> offsets(b_last - b_first);
+    size_t              nelem = 0;
+    for (size_t b = b_first; b < b_last; ++b) {
+      blocklens[b - b_first] = ds.nelem * blocks[b].second;
+      offsets[b - b_first]   = ds.nelem *
+                               (blocks[b].first - blocks[b_first].first);
+      nelem                 += blocklens[b - b_first];
+    }
+    dart_datatype_t dst_type;
+    DASH_ASSERT_RETURNS(
+      dart_type_create_indexed(
+        ds.dtype, blocklens.size(), blocklens.data(), offsets.data(),
+        &dst_type),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_put(gptr, src, nelem, ds.dtype, dst_type),
+      DART_OK);
+    // types can be destroyed before completion of pending operations
+    DASH_ASSERT_RETURNS(
+      dart_type_destroy(&dst_type),
+      DART_OK);
+  }
+
+  /**
+   * Wait for completion of issued transfers to all units and release
+   * their send buffers. Transfers remain pending at their target units
+   * unless \c remote is set.
+   */
+  template <typename FlushFun>
+  void complete(FlushFun flush_fun, bool remote)
+  {
+    for (size_t u = 0; u < _queues.size(); ++u) {
+      auto & queue = _queues[u];
+      if (queue.issued.empty() && !(remote && queue.remote_pending)) {
+        continue;
+      }
+      dart_gptr_t gptr = _gptr;
+      gptr.unitid = static_cast<dart_unit_t>(u);
+      DASH_ASSERT_RETURNS(
+        flush_fun(gptr),
+        DART_OK);
+      queue.issued.clear();
+      if (remote) {
+        queue.remote_pending = false;
+      }
+    }
+  }
+
+private:
+  size_t                  _capacity;
+  /// Global pointer to the segment of written elements
+  dart_gptr_t             _gptr          = DART_GPTR_NULL;
+  std::vector<unit_queue> _queues;
+  size_t                  _num_writes    = 0;
+  size_t                  _num_transfers = 0;
+};
+
+template <typename T>
+constexpr size_t WriteCombineBuffer<T>::DefaultCapacity;
+
+template <typename T>
+constexpr size_t WriteCombineBuffer<T>::MaxBlocks;
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__INTERNAL__WRITE_COMBINE_BUFFER_H__INCLUDED
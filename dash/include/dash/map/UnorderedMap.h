@@ -8,6 +8,7 @@
 #include <dash/Array.h>
 #include <dash/Allocator.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
 
 #include <dash/memory/GlobHeapMem.h>
 
@@ -17,6 +18,8 @@
 #include <dash/map/UnorderedMapLocalIter.h>
 #include <dash/map/UnorderedMapGlobIter.h>
 
+#include <dash/map/internal/UnorderedMapBucketTable.h>
+
 #include <iterator>
 #include <utility>
 #include <limits>
@@ -168,6 +171,17 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+private:
+  typedef dash::internal::UnorderedMapBucketTable<
+            key_type, value_type, index_type>
+    local_bucket_table;
+  typedef dash::internal::UnorderedMapDirectory<index_type>
+    directory_table;
+  typedef typename directory_table::slot_type
+    directory_slot;
+  typedef dash::Array<directory_slot>
+    glob_directory_table;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -198,6 +212,19 @@ private:
   hasher                 _key_hash;
   /// Predicate for key comparison.
   key_equal              _key_equal;
+  /// Hash table of elements in local memory, maps keys to local offsets.
+  local_bucket_table     _local_buckets;
+  /// Directory entries of elements of all units with keys assigned to
+  /// the local unit.
+  directory_table        _directory;
+  /// Number of local elements registered in the directory.
+  size_type              _directory_lsize = 0;
+  /// Directories of all units published in global memory at every
+  /// commit, so a key is resolved by probing the directory of a single
+  /// unit.
+  glob_directory_table   _glob_directory;
+  /// Capacity of every unit's directory in \c _glob_directory.
+  size_type              _glob_directory_capacity = 0;
   /// Capacity of local buffer containing locally added node elements that
   /// have not been committed to global memory yet.
   /// Default is 4 KB.
@@ -278,6 +305,8 @@ public:
     if (_globmem != nullptr) {
       _globmem->commit();
     }
+    // Register committed local elements in the directory:
+    _publish_directory();
     // Accumulate local sizes of remote units:
     _local_sizes.barrier();
     _remote_size = 0;
@@ -347,6 +376,13 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Initialize empty bucket table and directory:
+    _local_buckets            = local_bucket_table(lcap);
+    _directory                = directory_table(lcap);
+    _directory_lsize          = 0;
+    _glob_directory_capacity  = 0;
+    _publish_directory();
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -394,6 +430,9 @@ public:
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
+    _local_buckets.clear();
+    _directory.clear();
+    _directory_lsize      = 0;
     _begin                = iterator();
     _end                  = _begin;
     DASH_LOG_TRACE_VAR("UnorderedMap.deallocate >", this);
@@ -582,14 +621,26 @@ public:
     return nelem;
   }
 
+  /**
+   * Resolve the element with the given key.
+   *
+   * Elements in local memory are resolved from the local bucket table.
+   * Otherwise, the directory of the unit the key's hash value is assigned
+   * to is probed, which references the element at the unit storing it.
+   * Elements inserted by remote units are visible after the next commit
+   * (\c barrier).
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found   = _end;
+    auto     hash    = _index_hash(key);
+    auto     lidx    = _local_buckets.find(hash, key, _key_equal);
+    if (lidx >= 0) {
+      found = iterator(this, _myid, lidx);
+    } else {
+      found = _find_at(_home_unit(hash), hash, key);
+    }
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -597,15 +648,56 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    const_iterator found = const_cast<self_t *>(this)->find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
 
+  /**
+   * Resolve the elements with the keys in the given range.
+   *
+   * Keys are resolved like in \c find, but all keys assigned to a unit's
+   * directory are looked up in a single batch:
+   * the unit's directory is transferred in a single operation if it is
+   * small relative to the number of keys, and candidate elements are read
+   * in non-blocking transfers that are completed together.
+   *
+   * \return  Output iterator past the last resolved element, elements
+   *          with a key not contained in the map are resolved to \c end().
+   */
+  template<class InputIterator, class OutputIterator>
+  OutputIterator find_many(
+    // Iterator at first key in the range to resolve.
+    InputIterator  first,
+    // Iterator past the last key in the range to resolve.
+    InputIterator  last,
+    // Output iterator at the first resolved element.
+    OutputIterator out)
+  {
+    DASH_LOG_TRACE("UnorderedMap.find_many()");
+    std::vector<key_type>    keys(first, last);
+    std::vector<std::size_t> hashes(keys.size());
+    std::vector<iterator>    found(keys.size(), _end);
+    auto nunits = _team->size();
+    // Keys not found in local memory, grouped by the unit holding their
+    // directory entry:
+    std::vector<std::vector<index_type>> home_keys(nunits);
+    for (index_type i = 0; i < static_cast<index_type>(keys.size()); ++i) {
+      hashes[i] = _index_hash(keys[i]);
+      auto lidx = _local_buckets.find(hashes[i], keys[i], _key_equal);
+      if (lidx >= 0) {
+        found[i] = iterator(this, _myid, lidx);
+      } else {
+        home_keys[_home_unit(hashes[i]).id].push_back(i);
+      }
+    }
+    for (int u = 0; u < nunits; ++u) {
+      _find_many_at(team_unit_t(u), keys, hashes, home_keys[u], found);
+    }
+    DASH_LOG_TRACE("UnorderedMap.find_many >");
+    return std::copy(found.begin(), found.end(), out);
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
@@ -644,6 +736,11 @@ public:
     return result;
   }
 
+  /**
+   * Insert the elements in the given range.
+   *
+   * \see insert_many
+   */
   template<class InputIterator>
   void insert(
     // Iterator at first value in the range to insert.
@@ -651,13 +748,62 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
-    for (auto it = first; it != last; ++it) {
-      insert(*it);
+    insert_many(first, last);
+  }
+
+  /**
+   * Insert the elements in the given range.
+   *
+   * Keys of the range are resolved in a single call of \c find_many.
+   * Storage for all new elements is reserved in a single update of the
+   * local size and at most one call of \c globmem.grow.
+   * Of elements with equivalent keys in the range, only the first is
+   * inserted.
+   * Elements inserted by remote units are visible after the next commit
+   * (\c barrier).
+   *
+   * \return  The number of inserted elements.
+   */
+  template<class InputIterator>
+  size_type insert_many(
+    // Iterator at first value in the range to insert.
+    InputIterator first,
+    // Iterator past the last value in the range to insert.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.insert_many()");
+    DASH_ASSERT(_globmem != nullptr);
+    std::vector<value_type> values(first, last);
+    std::vector<key_type>   keys;
+    keys.reserve(values.size());
+    for (const auto & value : values) {
+      keys.push_back(value.first);
+    }
+    std::vector<iterator> found(keys.size(), _end);
+    find_many(keys.begin(), keys.end(), found.begin());
+    // Values with keys not contained in the map, indexed in a temporary
+    // bucket table to skip duplicate keys in the range:
+    local_bucket_table      batch_buckets(values.size());
+    std::vector<index_type> new_values;
+    new_values.reserve(values.size());
+    for (index_type i = 0; i < static_cast<index_type>(values.size()); ++i) {
+      if (found[i] != _end) {
+        continue;
+      }
+      auto hash = _index_hash(keys[i]);
+      if (batch_buckets.find(hash, keys[i], _key_equal) >= 0) {
+        continue;
+      }
+      batch_buckets.insert(hash, i, &values[i]);
+      new_values.push_back(i);
     }
+    if (!new_values.empty()) {
+      _insert_many_at(values, new_values);
+    }
+    DASH_LOG_DEBUG("UnorderedMap.insert_many >",
+                   "inserted:", new_values.size(),
+                   "of:",       values.size());
+    return new_values.size();
   }
 
   iterator erase(
@@ -781,6 +927,235 @@ private:
                    "lptr to mapped:", lptr_mapped);
   }
 
+  /**
+   * Hash value of the given key in the directory and bucket tables.
+   */
+  inline std::size_t _index_hash(const key_type & key) const
+  {
+    return dash::internal::unordered_map_key_hash<key_equal>(_key_hash, key);
+  }
+
+  /**
+   * Unit holding the directory entry of keys with the given hash value.
+   */
+  inline team_unit_t _home_unit(std::size_t hash) const
+  {
+    return team_unit_t(
+             dash::internal::unordered_map_home_unit(hash, _team->size()));
+  }
+
+  /**
+   * Directory slot at the given position in the directory the specified
+   * unit published in its last commit.
+   */
+  inline directory_slot _directory_slot_at(
+    team_unit_t unit,
+    size_type   s) const
+  {
+    if (unit == _myid) {
+      return _directory.slots()[s];
+    }
+    return _glob_directory[unit.id * _glob_directory_capacity + s];
+  }
+
+  /**
+   * Resolve the element with the given key from the directory of the
+   * specified unit, or \c end() if the key has not been found.
+   * Elements in local memory are not considered.
+   */
+  iterator _find_at(
+    team_unit_t        home,
+    std::size_t        hash,
+    const key_type   & key)
+  {
+    if (_glob_directory_capacity == 0) {
+      return _end;
+    }
+    DASH_LOG_TRACE("UnorderedMap._find_at()", "unit:", home, "key:", key);
+    size_type mask = _glob_directory_capacity - 1;
+    for (size_type s = hash & mask; ; s = (s + 1) & mask) {
+      directory_slot slot = _directory_slot_at(home, s);
+      if (slot.lidx < 0) {
+        break;
+      }
+      if (slot.hash == hash && slot.unit != _myid) {
+        iterator   candidate(this, team_unit_t(slot.unit), slot.lidx);
+        value_type value = *candidate;
+        if (_key_equal(value.first, key)) {
+          DASH_LOG_TRACE("UnorderedMap._find_at >", candidate);
+          return candidate;
+        }
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap._find_at >", "not found");
+    return _end;
+  }
+
+  /**
+   * Resolve the keys at the given indices from the directory of the
+   * specified unit.
+   * Found elements are assigned to the respective position in \c found.
+   */
+  void _find_many_at(
+    team_unit_t                      home,
+    const std::vector<key_type>    & keys,
+    const std::vector<std::size_t> & hashes,
+    const std::vector<index_type>  & key_indices,
+    std::vector<iterator>          & found)
+  {
+    if (_glob_directory_capacity == 0 || key_indices.empty()) {
+      return;
+    }
+    DASH_LOG_TRACE("UnorderedMap._find_many_at()",
+                   "unit:", home, "keys:", key_indices.size());
+    size_type mask = _glob_directory_capacity - 1;
+    // Probing a remote slot is a single-element read, transfer the unit's
+    // complete directory instead if it is not considerably larger than
+    // the number of keys:
+    std::vector<directory_slot> slots;
+    if (home != _myid && key_indices.size() * 8 >= _glob_directory_capacity) {
+      slots.resize(_glob_directory_capacity);
+      dash::internal::get_blocking(
+        (_glob_directory.begin() +
+           home.id * _glob_directory_capacity).dart_gptr(),
+        slots.data(),
+        _glob_directory_capacity);
+    }
+    // Collect candidate elements with matching key hash:
+    std::vector<std::pair<index_type, iterator>> candidates;
+    for (auto i : key_indices) {
+      for (size_type s = hashes[i] & mask; ; s = (s + 1) & mask) {
+        directory_slot slot = slots.empty()
+                              ? _directory_slot_at(home, s)
+                              : slots[s];
+        if (slot.lidx < 0) {
+          break;
+        }
+        if (slot.hash == hashes[i] && slot.unit != _myid) {
+          candidates.push_back(std::make_pair(
+            i, iterator(this, team_unit_t(slot.unit), slot.lidx)));
+        }
+      }
+    }
+    // Read candidate elements in non-blocking transfers, the number of
+    // pending transfers is bounded as progress of many outstanding
+    // requests degrades with some MPI implementations:
+    const size_type            max_pending = 16;
+    std::vector<char>          values(candidates.size() * sizeof(value_type));
+    std::vector<dart_handle_t> handles;
+    handles.reserve(max_pending);
+    for (size_type c = 0; c < candidates.size(); ++c) {
+      handles.push_back(DART_HANDLE_NULL);
+      dash::internal::get_handle(
+        candidates[c].second.dart_gptr(),
+        values.data() + c * sizeof(value_type),
+        sizeof(value_type),
+        &handles.back());
+      if (handles.size() == max_pending || c + 1 == candidates.size()) {
+        DASH_ASSERT_RETURNS(
+          dart_waitall(handles.data(), handles.size()),
+          DART_OK);
+        handles.clear();
+      }
+    }
+    for (size_type c = 0; c < candidates.size(); ++c) {
+      auto         i     = candidates[c].first;
+      const auto * value = reinterpret_cast<const value_type *>(
+                             values.data() + c * sizeof(value_type));
+      if (found[i] == _end && _key_equal(value->first, keys[i])) {
+        found[i] = candidates[c].second;
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap._find_many_at >",
+                   "candidates:", candidates.size());
+  }
+
+  /**
+   * Send directory entries of local elements added since the last commit
+   * to the units their keys are assigned to, and copy the local directory
+   * to the local section of the directories in global memory.
+   * Reallocates the global directories if any unit's local directory
+   * exceeds their capacity.
+   *
+   * Collective operation.
+   */
+  void _publish_directory()
+  {
+    auto      nunits = _team->size();
+    size_type lsize  = _local_sizes.local[0];
+    // Entries of new local elements, grouped by their directory's unit:
+    std::vector<std::vector<directory_slot>> send_entries(nunits);
+    for (size_type lidx = _directory_lsize; lidx < lsize; ++lidx) {
+      auto hash = _index_hash(_local_buckets.local(lidx)->first);
+      send_entries[_home_unit(hash).id].push_back(
+        directory_slot { hash, _myid.id, static_cast<index_type>(lidx) });
+    }
+
+    std::vector<size_t> send_counts(nunits);
+    std::vector<size_t> send_displs(nunits);
+    std::vector<size_t> recv_counts(nunits);
+    std::vector<size_t> recv_displs(nunits);
+    std::vector<directory_slot> send_buf;
+    send_buf.reserve(lsize - _directory_lsize);
+    for (int u = 0; u < nunits; ++u) {
+      send_counts[u] = send_entries[u].size() * sizeof(directory_slot);
+      send_displs[u] = send_buf.size() * sizeof(directory_slot);
+      send_buf.insert(send_buf.end(),
+                      send_entries[u].begin(), send_entries[u].end());
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        send_counts.data(), recv_counts.data(), 1,
+        dash::dart_datatype<size_t>::value,
+        _team->dart_id()),
+      DART_OK);
+    size_t recv_size = 0;
+    for (int u = 0; u < nunits; ++u) {
+      recv_displs[u] = recv_size;
+      recv_size     += recv_counts[u];
+    }
+    std::vector<directory_slot> recv_buf;
+    recv_buf.resize(recv_size / sizeof(directory_slot));
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+        send_buf.data(), send_counts.data(), send_displs.data(),
+        DART_TYPE_BYTE,
+        recv_buf.data(), recv_counts.data(), recv_displs.data(),
+        _team->dart_id()),
+      DART_OK);
+    for (const auto & entry : recv_buf) {
+      _directory.insert(entry);
+    }
+    _directory_lsize = lsize;
+
+    size_type lcap = _directory.capacity();
+    size_type gcap = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &lcap, &gcap, 1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    DASH_LOG_TRACE("UnorderedMap._publish_directory()",
+                   "received entries:", recv_buf.size(),
+                   "local capacity:",   lcap,
+                   "global capacity:",  gcap);
+    if (gcap != _glob_directory_capacity) {
+      _glob_directory.deallocate();
+      _glob_directory.allocate(gcap * nunits, dash::BLOCKED, *_team);
+      _glob_directory_capacity = gcap;
+    }
+    // Slot positions depend on table capacity, directories of all units
+    // must have identical capacity:
+    _directory.rehash(gcap);
+    std::copy(_directory.slots(),
+              _directory.slots() + gcap,
+              _glob_directory.lbegin());
+    _glob_directory.barrier();
+    DASH_LOG_TRACE("UnorderedMap._publish_directory >");
+  }
+
   /**
    * Insert value at specified unit.
    */
@@ -827,6 +1202,11 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
+    // Register new element in local bucket table:
+    _local_buckets.insert(
+      _index_hash(value.first),
+      old_local_size,
+      lptr_insert);
     // Convert local iterator to global iterator:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
                    "unit:", unit, "lidx:", old_local_size);
@@ -847,14 +1227,71 @@ private:
     _begin        = iterator(this, 0);
     DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _end");
     _end          = iterator(this, new_size);
+    DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _lend");
+    _lend         = _lbegin + new_local_size;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _begin);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _end);
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _lend);
     DASH_LOG_DEBUG("UnorderedMap._insert_at >",
                    (result.second ? "inserted" : "existing"), ":",
                    result.first);
     return result;
   }
 
+  /**
+   * Insert the values at the given indices at the active unit.
+   * Storage for all values is reserved in a single update of the local
+   * size.
+   */
+  void _insert_many_at(
+    const std::vector<value_type> & values,
+    const std::vector<index_type> & value_indices)
+  {
+    size_type nvalues = value_indices.size();
+    DASH_LOG_TRACE("UnorderedMap._insert_many_at()", "values:", nvalues);
+    size_type old_local_size   = GlobRef<Atomic<size_type>>(
+                                    _local_size_gptr
+                                 ).fetch_add(nvalues);
+    size_type new_local_size   = old_local_size + nvalues;
+    size_type local_capacity   = _globmem->local_size();
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_many_at", local_capacity);
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_many_at", old_local_size);
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_many_at", new_local_size);
+    if (new_local_size > local_capacity) {
+      size_type grow_size = std::max(new_local_size - local_capacity,
+                                     _local_buffer_size);
+      DASH_LOG_TRACE("UnorderedMap._insert_many_at",
+                     "globmem.grow(", grow_size, ")");
+      _globmem->grow(grow_size);
+    }
+    // Local pointer iterates the buckets of the local memory space:
+    auto lptr_insert = _globmem->lbegin() + old_local_size;
+    auto lidx        = old_local_size;
+    for (auto vi : value_indices) {
+      const value_type & value = values[vi];
+      value_type * lptr_value  = static_cast<value_type *>(lptr_insert);
+      // Using placement new to avoid assignment/copy as value_type is
+      // const:
+      new (lptr_value) value_type(value);
+      _local_buckets.insert(
+        _index_hash(value.first),
+        lidx,
+        lptr_value);
+      auto unit = _key_hash(value.first);
+      _local_cumul_sizes[unit] += 1;
+      if (unit != _myid) {
+        // Mark inserted element for move to remote unit in next commit:
+        _move_elements.push_back(iterator(this, unit, lidx));
+      }
+      ++lptr_insert;
+      ++lidx;
+    }
+    _begin = iterator(this, 0);
+    _end   = iterator(this, size());
+    _lend  = _lbegin + new_local_size;
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_many_at >", _end);
+  }
+
 }; // class UnorderedMap
 
 #endif // ifndef DOXYGEN
@@ -1,6 +1,8 @@
 #ifndef DASH__MAP__UNORDERED_MAP_LOCAL_REF_H__INCLUDED
 #define DASH__MAP__UNORDERED_MAP_LOCAL_REF_H__INCLUDED
 
+#include <dash/map/internal/UnorderedMapBucketTable.h>
+
 namespace dash {
 
 #ifdef DOXYGEN
@@ -269,18 +271,10 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    iterator found = std::find_if(
-                       first, last,
-                       [&](const value_type & v) {
-                         DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                        v.first, "==?", key);
-                         return pred(v.first, key);
-                       });
+    // Resolve local offset of the element from the local bucket table:
+    auto     hash  = _map->_index_hash(key);
+    auto     lidx  = _map->_local_buckets.find(hash, key, key_eq());
+    iterator found = (lidx >= 0) ? iterator(_map, lidx) : end();
     DASH_LOG_TRACE("UnorderedMapLocalRef.find >", found);
     return found;
   }
@@ -288,18 +282,9 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find() const", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    const_iterator found = std::find_if(
-                             first, last,
-                             [&](const value_type & v) {
-                               DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                              v.first, "==?", key);
-                               return pred(v.first, key);
-                             });
+    auto     hash  = _map->_index_hash(key);
+    auto     lidx  = _map->_local_buckets.find(hash, key, key_eq());
+    const_iterator found = (lidx >= 0) ? const_iterator(_map, lidx) : end();
     DASH_LOG_TRACE("UnorderedMapLocalRef.find const >", found);
     return found;
   }
@@ -0,0 +1,450 @@
+#ifndef DASH__MAP__INTERNAL__UNORDERED_MAP_BUCKET_TABLE_H__INCLUDED
+#define DASH__MAP__INTERNAL__UNORDERED_MAP_BUCKET_TABLE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace dash {
+
+template<typename Key>
+class HashLocal;
+
+namespace internal {
+
+/**
+ * Slot in the bucket table of a unit's local map elements.
+ */
+template<typename IndexType>
+struct UnorderedMapBucketSlot
+{
+  /// Hash value of the referenced element's key.
+  std::size_t hash;
+  /// Local offset of the referenced element, negative if slot is empty.
+  IndexType   lidx;
+};
+
+/**
+ * Entry in the directory of map elements, references an element by the
+ * unit storing it and its local offset at this unit.
+ *
+ * Slots are plain data so a unit's directory can be published in global
+ * memory and probed by remote units.
+ */
+template<typename IndexType>
+struct UnorderedMapDirectorySlot
+{
+  /// Hash value of the referenced element's key.
+  std::size_t hash;
+  /// Unit storing the referenced element.
+  dart_unit_t unit;
+  /// Local offset of the referenced element, negative if slot is empty.
+  IndexType   lidx;
+};
+
+/**
+ * Finalizer of 64 bit hash values (MurmurHash3 fmix64) to spread keys with
+ * regular bit patterns like consecutive integers over all table slots.
+ */
+inline std::size_t unordered_map_hash_mix(std::uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return static_cast<std::size_t>(h);
+}
+
+/**
+ * Whether \c std::hash is enabled for the given key type.
+ */
+template<typename Key, typename = void>
+struct unordered_map_has_std_hash
+: std::false_type
+{ };
+
+template<typename Key>
+struct unordered_map_has_std_hash<
+  Key,
+  decltype(static_cast<void>(
+             std::hash<Key>()(std::declval<const Key &>()))) >
+: std::true_type
+{ };
+
+inline std::uint64_t unordered_map_hash_value(dart_team_unit_t unit)
+{
+  return static_cast<std::uint64_t>(unit.id);
+}
+
+template<typename Value>
+inline std::uint64_t unordered_map_hash_value(const Value & value)
+{
+  return static_cast<std::uint64_t>(value);
+}
+
+/**
+ * Hash value of keys in the directory and bucket tables of a map with
+ * hasher \c Hash and key predicate \c Pred.
+ *
+ * Keys that are equal with respect to \c Pred must have identical hash
+ * values:
+ *
+ * - With \c std::equal_to<Key> as predicate, keys are hashed with
+ *   \c std::hash<Key> if it is enabled for the key type, as it spreads
+ *   keys over all table slots.
+ * - Otherwise, keys are hashed with the map's hasher which decides the
+ *   unit an element is inserted at and therefore is consistent with
+ *   \c Pred.
+ * - \c dash::HashLocal maps every key to the calling unit and cannot be
+ *   used, keys of maps with \c dash::HashLocal and a different predicate
+ *   or without \c std::hash share a single hash value and are found by
+ *   comparing them to all keys in the map.
+ */
+template<
+  typename Key,
+  typename Hash,
+  typename Pred,
+  bool UseStdHash = std::is_same<Pred, std::equal_to<Key>>::value &&
+                    unordered_map_has_std_hash<Key>::value,
+  bool UseHasher  = !std::is_same<Hash, dash::HashLocal<Key>>::value >
+struct UnorderedMapKeyHash
+{
+  static std::size_t hash(Hash, const Key &)
+  {
+    return 0;
+  }
+};
+
+template<typename Key, typename Hash, typename Pred, bool UseHasher>
+struct UnorderedMapKeyHash<Key, Hash, Pred, true, UseHasher>
+{
+  static std::size_t hash(Hash, const Key & key)
+  {
+    return unordered_map_hash_mix(
+             static_cast<std::uint64_t>(std::hash<Key>()(key)));
+  }
+};
+
+template<typename Key, typename Hash, typename Pred>
+struct UnorderedMapKeyHash<Key, Hash, Pred, false, true>
+{
+  static std::size_t hash(Hash hasher, const Key & key)
+  {
+    return unordered_map_hash_mix(unordered_map_hash_value(hasher(key)));
+  }
+};
+
+/**
+ * Hash value of a key in the directory and bucket tables of a map with
+ * hasher \c hasher and key predicate \c Pred,
+ * see \c UnorderedMapKeyHash.
+ */
+template<typename Pred, typename Hash, typename Key>
+std::size_t unordered_map_key_hash(const Hash & hasher, const Key & key)
+{
+  return UnorderedMapKeyHash<Key, Hash, Pred>::hash(hasher, key);
+}
+
+/**
+ * Unit holding the directory entry of keys with the given hash value.
+ * Uses different bits than the slot position in a directory table so
+ * keys assigned to the same unit are spread over all of its slots.
+ */
+inline int unordered_map_home_unit(std::size_t hash, int nunits)
+{
+  return static_cast<int>(
+           unordered_map_hash_mix(~static_cast<std::uint64_t>(hash)) %
+           static_cast<std::size_t>(nunits));
+}
+
+/**
+ * Open-addressing hash table with linear probing that maps keys of a
+ * unit's local map elements to their local offset and native address.
+ *
+ * The table capacity is a power of two and is kept at least twice the
+ * number of indexed elements.
+ */
+template<
+  typename Key,
+  typename Value,
+  typename IndexType >
+class UnorderedMapBucketTable
+{
+private:
+  typedef UnorderedMapBucketTable<Key, Value, IndexType> self_t;
+
+public:
+  typedef UnorderedMapBucketSlot<IndexType>                      slot_type;
+  typedef std::size_t                                            size_type;
+  typedef IndexType                                             index_type;
+
+private:
+  /// Slots of the open-addressing table.
+  std::vector<slot_type> _slots;
+  /// Native pointers to local elements, indexed by local offset.
+  std::vector<Value *>   _lptrs;
+  /// Number of occupied slots.
+  size_type              _size = 0;
+
+public:
+  /**
+   * Constructor, creates a table with capacity for the given number
+   * of elements.
+   */
+  explicit UnorderedMapBucketTable(size_type nelem = 0)
+  {
+    rehash(min_capacity(nelem));
+  }
+
+  /**
+   * Smallest valid table capacity for the given number of elements.
+   */
+  static size_type min_capacity(size_type nelem)
+  {
+    size_type cap = 16;
+    while (cap < 2 * nelem) {
+      cap <<= 1;
+    }
+    return cap;
+  }
+
+  inline size_type size() const noexcept
+  {
+    return _size;
+  }
+
+  inline size_type capacity() const noexcept
+  {
+    return _slots.size();
+  }
+
+  inline const slot_type * slots() const noexcept
+  {
+    return _slots.data();
+  }
+
+  /**
+   * Native pointer to the local element at the given local offset.
+   */
+  inline Value * local(index_type lidx) const
+  {
+    return _lptrs[lidx];
+  }
+
+  /**
+   * Remove all elements from the table, retaining its capacity.
+   */
+  void clear()
+  {
+    for (auto & slot : _slots) {
+      slot.hash = 0;
+      slot.lidx = -1;
+    }
+    _lptrs.clear();
+    _size = 0;
+  }
+
+  /**
+   * Resize the table to the given capacity which must be a power of two
+   * and is increased if it does not fit the current number of elements.
+   */
+  void rehash(size_type capacity)
+  {
+    DASH_ASSERT_MSG((capacity & (capacity - 1)) == 0,
+                    "bucket table capacity must be a power of two");
+    if (capacity < min_capacity(_size)) {
+      capacity = min_capacity(_size);
+    }
+    if (capacity == _slots.size()) {
+      return;
+    }
+    DASH_LOG_TRACE("UnorderedMapBucketTable.rehash()",
+                   "capacity:", _slots.size(), "->", capacity);
+    std::vector<slot_type> old_slots(capacity, slot_type { 0, -1 });
+    old_slots.swap(_slots);
+    for (const auto & slot : old_slots) {
+      if (slot.lidx >= 0) {
+        _slots[probe_empty(slot.hash)] = slot;
+      }
+    }
+  }
+
+  /**
+   * Register the local element at the given local offset and native
+   * address.
+   */
+  void insert(
+    size_type  hash,
+    index_type lidx,
+    Value    * lptr)
+  {
+    if (2 * (_size + 1) > _slots.size()) {
+      rehash(_slots.size() * 2);
+    }
+    _slots[probe_empty(hash)] = slot_type { hash, lidx };
+    if (_lptrs.size() <= static_cast<size_type>(lidx)) {
+      _lptrs.resize(lidx + 1, nullptr);
+    }
+    _lptrs[lidx] = lptr;
+    ++_size;
+  }
+
+  /**
+   * Local offset of the element with the given key, or -1 if no such
+   * element has been registered.
+   */
+  template<typename KeyEqual>
+  index_type find(
+    size_type        hash,
+    const Key      & key,
+    const KeyEqual & key_equal) const
+  {
+    const size_type mask = _slots.size() - 1;
+    for (size_type s = hash & mask; ; s = (s + 1) & mask) {
+      const slot_type & slot = _slots[s];
+      if (slot.lidx < 0) {
+        return -1;
+      }
+      if (slot.hash == hash && key_equal(_lptrs[slot.lidx]->first, key)) {
+        return slot.lidx;
+      }
+    }
+  }
+
+private:
+  size_type probe_empty(size_type hash) const
+  {
+    const size_type mask = _slots.size() - 1;
+    size_type s = hash & mask;
+    while (_slots[s].lidx >= 0) {
+      s = (s + 1) & mask;
+    }
+    return s;
+  }
+
+}; // class UnorderedMapBucketTable
+
+/**
+ * Open-addressing hash table with linear probing that maps key hashes to
+ * elements stored at any unit.
+ *
+ * Every unit holds the directory entries of the keys assigned to it by
+ * \c unordered_map_home_unit, so a key is resolved by probing the
+ * directory of a single unit.
+ * As elements are not stored at the directory's unit, entries only
+ * contain key hashes and candidate elements have to be compared to the
+ * key.
+ */
+template<typename IndexType>
+class UnorderedMapDirectory
+{
+public:
+  typedef UnorderedMapDirectorySlot<IndexType>                   slot_type;
+  typedef std::size_t                                            size_type;
+
+private:
+  /// Slots of the open-addressing table.
+  std::vector<slot_type> _slots;
+  /// Number of occupied slots.
+  size_type              _size = 0;
+
+public:
+  explicit UnorderedMapDirectory(size_type nelem = 0)
+  {
+    rehash(min_capacity(nelem));
+  }
+
+  /**
+   * Smallest valid table capacity for the given number of entries.
+   */
+  static size_type min_capacity(size_type nelem)
+  {
+    size_type cap = 16;
+    while (cap < 2 * nelem) {
+      cap <<= 1;
+    }
+    return cap;
+  }
+
+  inline size_type size() const noexcept
+  {
+    return _size;
+  }
+
+  inline size_type capacity() const noexcept
+  {
+    return _slots.size();
+  }
+
+  inline const slot_type * slots() const noexcept
+  {
+    return _slots.data();
+  }
+
+  void clear()
+  {
+    for (auto & slot : _slots) {
+      slot = slot_type { 0, DART_UNDEFINED_UNIT_ID, -1 };
+    }
+    _size = 0;
+  }
+
+  /**
+   * Resize the table to the given capacity which must be a power of two
+   * and is increased if it does not fit the current number of entries.
+   */
+  void rehash(size_type capacity)
+  {
+    DASH_ASSERT_MSG((capacity & (capacity - 1)) == 0,
+                    "directory capacity must be a power of two");
+    if (capacity < min_capacity(_size)) {
+      capacity = min_capacity(_size);
+    }
+    if (capacity == _slots.size()) {
+      return;
+    }
+    std::vector<slot_type> old_slots(
+      capacity, slot_type { 0, DART_UNDEFINED_UNIT_ID, -1 });
+    old_slots.swap(_slots);
+    for (const auto & slot : old_slots) {
+      if (slot.lidx >= 0) {
+        _slots[probe_empty(slot.hash)] = slot;
+      }
+    }
+  }
+
+  void insert(const slot_type & entry)
+  {
+    if (2 * (_size + 1) > _slots.size()) {
+      rehash(_slots.size() * 2);
+    }
+    _slots[probe_empty(entry.hash)] = entry;
+    ++_size;
+  }
+
+private:
+  size_type probe_empty(size_type hash) const
+  {
+    const size_type mask = _slots.size() - 1;
+    size_type s = hash & mask;
+    while (_slots[s].lidx >= 0) {
+      s = (s + 1) & mask;
+    }
+    return s;
+  }
+
+}; // class UnorderedMapDirectory
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__MAP__INTERNAL__UNORDERED_MAP_BUCKET_TABLE_H__INCLUDED
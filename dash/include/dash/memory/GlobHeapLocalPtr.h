@@ -392,9 +392,11 @@ private:
     if (_bucket_phase + offset < _bucket_it->size) {
       // element is in bucket currently referenced by this iterator:
       _bucket_phase += offset;
-    } else {
+    } else if (_bucket_it != _bucket_last) {
+      // offset relative to the beginning of the succeeding bucket:
+      offset -= (_bucket_it->size - _bucket_phase);
       // find bucket containing element at given offset:
-      for (; _bucket_it != _bucket_last; ++_bucket_it) {
+      for (++_bucket_it; _bucket_it != _bucket_last; ++_bucket_it) {
         if (offset >= _bucket_it->size) {
           offset -= _bucket_it->size;
         } else if (offset < _bucket_it->size) {
@@ -258,7 +258,7 @@ make_distribution_spec(
   // e.g. { TILE(10), TILE(120) }:
   std::array<dash::Distribution, ndim> distributions = {{ }};
   extent_t min_block_extent = sizespec.size();
-  if (PartitioningTags::minimal) {
+  if (PartitioningTags::minimal || MappingTags::multiple) {
     // Find minimal block size in minimal partitioning, initialize with
     // pattern size (maximum):
     for (auto d = 0; d < SizeSpecType::ndim::value; ++d) {
@@ -273,6 +273,14 @@ make_distribution_spec(
                    "minimum block extent for square blocks:",
                    min_block_extent);
   }
+  // Square blocks of the minimum block extent map more than one block to
+  // units in dimensions with fewer units, unless they do not tile the
+  // pattern:
+  bool square_blocks = MappingTags::multiple && !MappingTags::balanced &&
+                       min_block_extent > 0;
+  for (auto d = 0; square_blocks && d < SizeSpecType::ndim::value; ++d) {
+    square_blocks = (sizespec.extent(d) % min_block_extent == 0);
+  }
   // Resolve balanced tile extents from size spec and team spec:
   for (auto d = 0; d < SizeSpecType::ndim::value; ++d) {
     auto extent_d  = sizespec.extent(d);
@@ -300,6 +308,13 @@ make_distribution_spec(
                        "minimal partitioning, mapping not balanced",
                        "d", d, "nblocks_d", nblocks_d);
       }
+    } else if (square_blocks) {
+      // Multiple blocks mapped to every unit, using same block extent in
+      // all dimensions:
+      nblocks_d = extent_d / min_block_extent;
+      DASH_LOG_TRACE("dash::make_distribution_spec",
+                     "multiple blocks per unit, mapping not balanced",
+                     "d", d, "nblocks_d", nblocks_d);
     } else if (MappingTags::balanced) {
       // Balanced mapping, i.e. same number of blocks for every unit
       if (nblocks_d % teamspec.extent(d) > 0) {
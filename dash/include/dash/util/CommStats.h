@@ -0,0 +1,111 @@
+#ifndef DASH__UTIL__COMM_STATS_H__INCLUDED
+#define DASH__UTIL__COMM_STATS_H__INCLUDED
+
+#include <dash/dart/if/dart_stats.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+
+namespace dash {
+namespace util {
+
+/**
+ * Snapshot of the communication statistics counters of the calling unit
+ * in a team, as recorded by DART.
+ *
+ * Counters are only updated while statistics are enabled, either by
+ * \c CommStats::enable or by setting the environment variable
+ * \c DART_STATS=1 before \c dash::init.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::util::CommStats::enable();
+ *   dash::util::CommStats::reset();
+ *   // ...
+ *   dash::util::CommStats stats;
+ *   std::cout << stats.to_json() << std::endl;
+ * \endcode
+ */
+class CommStats
+{
+private:
+  typedef CommStats self_t;
+
+public:
+  /**
+   * Enable or disable recording of statistics in all teams.
+   * Not a collective operation.
+   */
+  static void enable(bool enable = true);
+
+  /**
+   * Whether statistics are recorded.
+   */
+  static bool enabled();
+
+  /**
+   * Reset counters of the calling unit in the given team.
+   * Not a collective operation.
+   */
+  static void reset(dash::Team & team = dash::Team::All());
+
+public:
+  /**
+   * Takes a snapshot of the counters of the calling unit in the given
+   * team.
+   */
+  explicit CommStats(dash::Team & team = dash::Team::All());
+
+  /**
+   * Totals of all target units and team-wide counters.
+   */
+  const dart_stats_t & total() const {
+    return _total;
+  }
+
+  /**
+   * Counters of operations targeting the given unit.
+   */
+  const dart_stats_target_t & target(dash::team_unit_t unit) const {
+    return _targets[unit.id];
+  }
+
+  /**
+   * Number of target units in the team.
+   */
+  std::size_t size() const {
+    return _targets.size();
+  }
+
+  /**
+   * Counter increments since the given snapshot of the same team.
+   */
+  self_t operator-(const self_t & rhs) const;
+
+  /**
+   * JSON object with team totals and counters of all targets with
+   * non-zero counters.
+   */
+  std::string to_json() const;
+
+private:
+  dart_team_t                      _team;
+  dash::team_unit_t                _myid;
+  dart_stats_t                     _total;
+  std::vector<dart_stats_target_t> _targets;
+};
+
+std::ostream & operator<<(
+  std::ostream    & os,
+  const CommStats & stats);
+
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__COMM_STATS_H__INCLUDED
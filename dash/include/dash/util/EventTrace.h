@@ -0,0 +1,209 @@
+#ifndef DASH__UTIL__EVENT_TRACE_H__
+#define DASH__UTIL__EVENT_TRACE_H__
+
+#include <dash/util/Timer.h>
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace dash {
+namespace util {
+
+/**
+ * Low-overhead event tracer for DASH algorithms and DART operations.
+ *
+ * In contrast to \c dash::util::Trace, recording an event does not
+ * allocate or synchronize: events are identified by interned IDs and
+ * appended to a ring buffer of the calling thread. A background thread
+ * drains the ring buffers to a binary trace file per unit. Events are
+ * dropped and counted if a ring buffer is full.
+ *
+ * Tracing is started explicitly with \c EventTrace::start or in
+ * \c dash::init if the environment variable \c DASH_EVENT_TRACE_PATH is
+ * set. While tracing, the callback of DART operations is registered so
+ * DART one-sided, synchronization and collective operations are
+ * recorded as well.
+ *
+ * Trace files of all units can be merged offline to the Chrome trace
+ * format (\c chrome://tracing, Perfetto) with one timeline per unit and
+ * thread using \c EventTrace::merge_chrome_trace.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::util::EventTrace::start("/tmp/trace");
+ *   {
+ *     DASH_EVENT_TRACE_SCOPE("my_phase");
+ *     // ...
+ *   }
+ *   dash::util::EventTrace::stop();
+ * \endcode
+ */
+class EventTrace
+{
+public:
+  typedef std::uint32_t event_id;
+
+  typedef dash::util::Timer<dash::util::TimeMeasure::Clock>
+    timer_t;
+  typedef typename timer_t::timestamp_t
+    timestamp_t;
+
+  enum class Phase : std::uint8_t {
+    Begin   = 0,
+    End     = 1,
+    Instant = 2
+  };
+
+  /**
+   * A single trace event as stored in ring buffers and trace files.
+   */
+  struct Record {
+    /// Timestamp in ticks of the timer backend
+    timestamp_t   ts;
+    /// Event argument, e.g. number of bytes transferred
+    std::uint64_t arg;
+    event_id      id;
+    std::uint16_t thread;
+    Phase         phase;
+    std::uint8_t  reserved;
+  };
+
+  /**
+   * Guard recording begin and end of an event for its lifetime.
+   */
+  class Scope
+  {
+  public:
+    inline explicit Scope(event_id id, std::uint64_t arg = 0) noexcept
+    : _id(id), _arg(arg), _active(EventTrace::enabled())
+    {
+      if (_active) {
+        EventTrace::record(_id, Phase::Begin, _arg);
+      }
+    }
+
+    inline ~Scope() noexcept
+    {
+      if (_active) {
+        EventTrace::record(_id, Phase::End, _arg);
+      }
+    }
+
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+  private:
+    event_id      _id;
+    std::uint64_t _arg;
+    bool          _active;
+  };
+
+public:
+  /**
+   * Returns the ID of the event with the given name, registering the
+   * name on first use. Intended to be called once per trace site.
+   */
+  static event_id intern(const char * name);
+
+  /**
+   * Name of the event with the given ID.
+   */
+  static std::string name(event_id id);
+
+  /**
+   * Start recording events of the calling unit to a file in directory
+   * \c path. Uses the value of \c DASH_EVENT_TRACE_PATH or the working
+   * directory if \c path is empty.
+   *
+   * Not a collective operation.
+   *
+   * \returns  true if tracing has been started, false if already active
+   *           or the trace file could not be opened.
+   */
+  static bool start(const std::string & path = "");
+
+  /**
+   * Stop recording, drain all ring buffers and finalize the trace file.
+   * Waits for events that are being recorded concurrently.
+   */
+  static void stop();
+
+  /**
+   * Whether events are recorded.
+   */
+  static inline bool enabled() noexcept
+  {
+    return _enabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Record an event in the ring buffer of the calling thread.
+   * Events are discarded if tracing is not enabled.
+   */
+  static void record(
+    event_id      id,
+    Phase         phase,
+    std::uint64_t arg = 0) noexcept;
+
+  /**
+   * Record an event with zero duration if tracing is enabled.
+   */
+  static inline void instant(event_id id, std::uint64_t arg = 0) noexcept
+  {
+    if (enabled()) {
+      record(id, Phase::Instant, arg);
+    }
+  }
+
+  /**
+   * Path of the trace file written by the calling unit, empty if tracing
+   * has not been started.
+   */
+  static std::string filename();
+
+  /**
+   * Number of events dropped due to full ring buffers since tracing has
+   * been started.
+   */
+  static std::uint64_t dropped();
+
+  /**
+   * Merge trace files of units to a single trace in Chrome trace event
+   * JSON format, with units as processes and their threads as threads.
+   * Timestamps are relative to the earliest event in all files.
+   *
+   * Does not require DASH to be initialized.
+   *
+   * \returns  Number of events written.
+   */
+  static std::size_t merge_chrome_trace(
+    const std::vector<std::string> & trace_files,
+    std::ostream                   & out);
+
+private:
+  static std::atomic<bool> _enabled;
+};
+
+} // namespace util
+} // namespace dash
+
+#define DASH__EVENT_TRACE_CONCAT_(a, b) a ## b
+#define DASH__EVENT_TRACE_CONCAT(a, b)  DASH__EVENT_TRACE_CONCAT_(a, b)
+
+/**
+ * Records begin and end of the enclosing scope as event \c name,
+ * a string literal.
+ */
+#define DASH_EVENT_TRACE_SCOPE(name)                                      \
+  static const ::dash::util::EventTrace::event_id                         \
+    DASH__EVENT_TRACE_CONCAT(dash__event_trace_id_, __LINE__)             \
+      = ::dash::util::EventTrace::intern(name);                           \
+  ::dash::util::EventTrace::Scope                                         \
+    DASH__EVENT_TRACE_CONCAT(dash__event_trace_scope_, __LINE__)(         \
+      DASH__EVENT_TRACE_CONCAT(dash__event_trace_id_, __LINE__))
+
+#endif // DASH__UTIL__EVENT_TRACE_H__
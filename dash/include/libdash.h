@@ -45,18 +45,24 @@ namespace dash {
 #include <dash/Container.h>
 #include <dash/Shared.h>
 #include <dash/SharedCounter.h>
+#include <dash/Aggregator.h>
 #include <dash/Exception.h>
 #include <dash/Algorithm.h>
+#include <dash/Collective.h>
 #include <dash/Atomic.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
 
 #include <dash/Pattern.h>
 
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/TemporalBlocking.h>
 
 #include <dash/util/BenchmarkParams.h>
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
+#include <dash/util/EventTrace.h>
+#include <dash/util/CommStats.h>
 #include <dash/util/PatternMetrics.h>
 #include <dash/util/Timer.h>
 
@@ -6,6 +6,7 @@
 
 #include <dash/util/Locality.h>
 #include <dash/util/Config.h>
+#include <dash/util/EventTrace.h>
 #include <dash/internal/Logging.h>
 
 #include <dash/internal/Annotation.h>
@@ -68,6 +69,11 @@ void dash::init(int * argc, char ** *argv)
 
   DASH_LOG_DEBUG("dash::init", "dash::util::Locality::init()");
   dash::util::Locality::init();
+
+  if (dash::util::Config::is_set("DASH_EVENT_TRACE_PATH")) {
+    DASH_LOG_DEBUG("dash::init", "dash::util::EventTrace::start()");
+    dash::util::EventTrace::start();
+  }
   DASH_LOG_DEBUG("dash::init >");
 }
 
@@ -91,6 +97,9 @@ void dash::finalize()
   // Wait for all units:
   dash::barrier();
 
+  // Finalize event trace started in dash::init or by the application:
+  dash::util::EventTrace::stop();
+
   // Finalize DASH runtime:
   DASH_LOG_DEBUG("dash::finalize", "finalize DASH runtime");
   dart_exit();
@@ -3,9 +3,14 @@
 
 namespace dash {
 
-Mutex::Mutex(Team & team){
-  dart_ret_t ret = dart_team_lock_init(team.dart_id(), &_mutex);
-  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_init failed");
+Mutex::Mutex(Team & team, mutex_policy policy){
+  if (policy == mutex_policy::cohort) {
+    dart_ret_t ret = dart_team_cohort_lock_init(team.dart_id(), &_mutex);
+    DASH_ASSERT_EQ(DART_OK, ret, "dart_team_cohort_lock_init failed");
+  } else {
+    dart_ret_t ret = dart_team_lock_init(team.dart_id(), &_mutex);
+    DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_init failed");
+  }
 }
 
 Mutex::~Mutex(){
@@ -28,6 +33,13 @@ bool Mutex::try_lock(){
   return static_cast<bool>(result);
 }
 
+bool Mutex::try_lock_for_us(uint64_t timeout_us){
+  int32_t result;
+  dart_ret_t ret = dart_lock_try_acquire_for(_mutex, timeout_us, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_try_acquire_for failed");
+  return static_cast<bool>(result);
+}
+
 void Mutex::unlock(){
   dart_ret_t ret = dart_lock_release(_mutex);
   DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire failed");
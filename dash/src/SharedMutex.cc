@@ -0,0 +1,84 @@
+#include <dash/SharedMutex.h>
+#include <dash/Exception.h>
+
+#include <utility>
+
+namespace dash {
+
+SharedMutex::SharedMutex(Team & team){
+  dart_ret_t ret = dart_team_rwlock_init(team.dart_id(), &_rwlock);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_rwlock_init failed");
+}
+
+SharedMutex::SharedMutex(SharedMutex && other)
+: _rwlock(other._rwlock)
+{
+  other._rwlock = nullptr;
+}
+
+SharedMutex & SharedMutex::operator=(SharedMutex && other){
+  std::swap(_rwlock, other._rwlock);
+  return *this;
+}
+
+SharedMutex::~SharedMutex(){
+  if (_rwlock == nullptr) {
+    return;
+  }
+  dart_ret_t ret = dart_team_rwlock_destroy(&_rwlock);
+  if (ret != DART_OK) {
+    DASH_LOG_ERROR("Failed to destroy DART reader-writer lock! "
+                   "(dart_team_rwlock_destroy failed)");
+  }
+}
+
+void SharedMutex::lock(){
+  dart_ret_t ret = dart_rwlock_acquire(_rwlock);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire failed");
+}
+
+bool SharedMutex::try_lock(){
+  int32_t result;
+  dart_ret_t ret = dart_rwlock_try_acquire(_rwlock, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire failed");
+  return static_cast<bool>(result);
+}
+
+bool SharedMutex::try_lock_for_us(uint64_t timeout_us){
+  int32_t result;
+  dart_ret_t ret = dart_rwlock_try_acquire_for(_rwlock, timeout_us, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire_for failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock(){
+  dart_ret_t ret = dart_rwlock_release(_rwlock);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release failed");
+}
+
+void SharedMutex::lock_shared(){
+  dart_ret_t ret = dart_rwlock_acquire_shared(_rwlock);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_acquire_shared failed");
+}
+
+bool SharedMutex::try_lock_shared(){
+  int32_t result;
+  dart_ret_t ret = dart_rwlock_try_acquire_shared(_rwlock, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire_shared failed");
+  return static_cast<bool>(result);
+}
+
+bool SharedMutex::try_lock_shared_for_us(uint64_t timeout_us){
+  int32_t result;
+  dart_ret_t ret = dart_rwlock_try_acquire_shared_for(
+                     _rwlock, timeout_us, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_try_acquire_shared_for failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock_shared(){
+  dart_ret_t ret = dart_rwlock_release_shared(_rwlock);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_rwlock_release_shared failed");
+}
+
+} // namespace dash
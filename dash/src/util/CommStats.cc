@@ -0,0 +1,154 @@
+#include <dash/util/CommStats.h>
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+
+namespace dash {
+namespace util {
+
+namespace {
+
+bool is_zero(const dart_stats_target_t & t)
+{
+  return t.put_ops == 0 && t.get_ops == 0 && t.acc_ops == 0 &&
+         t.flush_ops == 0;
+}
+
+void print_target(std::ostream & os, const dart_stats_target_t & t)
+{
+  os << "{ "
+     << "\"put\":{"
+     << "\"ops\":"       << t.put_ops    << ","
+     << "\"bytes\":"     << t.put_bytes  << "}, "
+     << "\"get\":{"
+     << "\"ops\":"       << t.get_ops    << ","
+     << "\"bytes\":"     << t.get_bytes  << "}, "
+     << "\"acc\":{"
+     << "\"ops\":"       << t.acc_ops    << ","
+     << "\"bytes\":"     << t.acc_bytes  << "}, "
+     << "\"path\":{"
+     << "\"local\":"     << t.local_ops  << ","
+     << "\"shmem\":"     << t.shmem_ops  << ","
+     << "\"mpi\":"       << t.mpi_ops    << "}, "
+     << "\"flush\":{"
+     << "\"ops\":"       << t.flush_ops  << ","
+     << "\"ns\":"        << t.flush_ns   << "}"
+     << " }";
+}
+
+void subtract(dart_stats_target_t & lhs, const dart_stats_target_t & rhs)
+{
+  lhs.put_ops   -= rhs.put_ops;
+  lhs.put_bytes -= rhs.put_bytes;
+  lhs.get_ops   -= rhs.get_ops;
+  lhs.get_bytes -= rhs.get_bytes;
+  lhs.acc_ops   -= rhs.acc_ops;
+  lhs.acc_bytes -= rhs.acc_bytes;
+  lhs.local_ops -= rhs.local_ops;
+  lhs.shmem_ops -= rhs.shmem_ops;
+  lhs.mpi_ops   -= rhs.mpi_ops;
+  lhs.flush_ops -= rhs.flush_ops;
+  lhs.flush_ns  -= rhs.flush_ns;
+}
+
+} // namespace
+
+void CommStats::enable(bool enable)
+{
+  DASH_ASSERT_RETURNS(
+    dart_stats_enable(enable),
+    DART_OK);
+}
+
+bool CommStats::enabled()
+{
+  return dart_stats_enabled();
+}
+
+void CommStats::reset(dash::Team & team)
+{
+  DASH_ASSERT_RETURNS(
+    dart_stats_reset(team.dart_id()),
+    DART_OK);
+}
+
+CommStats::CommStats(dash::Team & team)
+: _team(team.dart_id()),
+  _myid(team.myid()),
+  _targets(team.size())
+{
+  DASH_LOG_TRACE("CommStats(team)", "team:", _team);
+  DASH_ASSERT_RETURNS(
+    dart_stats_get(_team, &_total),
+    DART_OK);
+  for (std::size_t u = 0; u < _targets.size(); ++u) {
+    DASH_ASSERT_RETURNS(
+      dart_stats_get_target(
+        _team, dash::team_unit_t(u), &_targets[u]),
+      DART_OK);
+  }
+}
+
+CommStats CommStats::operator-(const CommStats & rhs) const
+{
+  DASH_ASSERT_EQ(_team, rhs._team,
+                 "CommStats: snapshots of different teams");
+  CommStats diff(*this);
+  subtract(diff._total.total, rhs._total.total);
+  diff._total.wait_ops   -= rhs._total.wait_ops;
+  diff._total.wait_ns    -= rhs._total.wait_ns;
+  diff._total.coll_ops   -= rhs._total.coll_ops;
+  diff._total.coll_bytes -= rhs._total.coll_bytes;
+  diff._total.coll_ns    -= rhs._total.coll_ns;
+  for (std::size_t u = 0; u < _targets.size(); ++u) {
+    subtract(diff._targets[u], rhs._targets[u]);
+  }
+  return diff;
+}
+
+std::string CommStats::to_json() const
+{
+  std::ostringstream os;
+  os << "{ "
+     << "\"team\":"        << _team                 << ", "
+     << "\"unit\":"        << _myid.id              << ", "
+     << "\"total\":";
+  print_target(os, _total.total);
+  os << ", "
+     << "\"wait\":{"
+     << "\"ops\":"         << _total.wait_ops       << ","
+     << "\"ns\":"          << _total.wait_ns        << "}, "
+     << "\"collective\":{"
+     << "\"ops\":"         << _total.coll_ops       << ","
+     << "\"bytes\":"       << _total.coll_bytes     << ","
+     << "\"ns\":"          << _total.coll_ns        << "}, "
+     << "\"targets\":[";
+  bool first = true;
+  for (std::size_t u = 0; u < _targets.size(); ++u) {
+    if (is_zero(_targets[u])) {
+      continue;
+    }
+    os << (first ? "" : ",") << "\n  { \"unit\":" << u << ", \"stats\":";
+    print_target(os, _targets[u]);
+    os << " }";
+    first = false;
+  }
+  os << (first ? "" : "\n") << "] }";
+  return os.str();
+}
+
+std::ostream & operator<<(
+  std::ostream    & os,
+  const CommStats & stats)
+{
+  return os << stats.to_json();
+}
+
+} // namespace util
+} // namespace dash
@@ -0,0 +1,529 @@
+#include <dash/util/EventTrace.h>
+#include <dash/util/Config.h>
+#include <dash/Init.h>
+#include <dash/Team.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_trace.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace dash {
+namespace util {
+
+std::atomic<bool> EventTrace::_enabled(false);
+
+namespace {
+
+typedef EventTrace::Record   record_t;
+typedef EventTrace::event_id event_id_t;
+
+/*
+ * Trace file layout:
+ *
+ *   file_header_t
+ *   record_t[]              records in order of draining, per thread in
+ *                           order of recording
+ *   { uint32 id, uint32 length, char[length] name }[]
+ *   file_trailer_t
+ */
+
+const char trace_file_magic[8]   = { 'D','A','S','H','E','V','T','1' };
+const char trace_trailer_magic[8] = { 'D','A','S','H','E','V','T','E' };
+
+struct file_header_t {
+  char          magic[8];
+  std::int32_t  unit;
+  std::uint32_t record_size;
+  double        ns_per_tick;
+};
+
+struct file_trailer_t {
+  std::uint64_t names_offset;
+  std::uint64_t num_names;
+  char          magic[8];
+};
+
+/**
+ * Single-producer, single-consumer ring buffer of a thread.
+ */
+struct thread_buffer_t {
+  explicit thread_buffer_t(std::size_t capacity, std::uint16_t id)
+  : records(capacity), mask(capacity - 1), thread(id)
+  { }
+
+  std::vector<record_t>      records;
+  std::uint64_t              mask;
+  std::uint16_t              thread;
+  std::atomic<std::uint64_t> head    { 0 };
+  std::atomic<std::uint64_t> tail    { 0 };
+  std::atomic<std::uint64_t> dropped { 0 };
+  // Set while the owning thread writes a record
+  std::atomic<bool>          writing { false };
+};
+
+struct trace_state_t {
+  // Interned event names, guarded by names_mutex:
+  std::mutex                                  names_mutex;
+  std::vector<std::string>                    names;
+  std::unordered_map<std::string, event_id_t> ids;
+  // Ring buffers of all threads that recorded events, guarded by
+  // buffers_mutex:
+  std::mutex                                    buffers_mutex;
+  std::vector<std::unique_ptr<thread_buffer_t>> buffers;
+  std::size_t                                   capacity = 0;
+  // Background flush, guarded by flush_mutex:
+  std::mutex                                  flush_mutex;
+  std::condition_variable                     flush_cv;
+  std::thread                                 flusher;
+  bool                                        stop_flusher = false;
+  std::ofstream                               out;
+  std::string                                 filename;
+  event_id_t                                  dart_ids[DART_TRACE_EVENT_LAST];
+};
+
+trace_state_t & state()
+{
+  static trace_state_t * s = new trace_state_t();
+  return *s;
+}
+
+thread_local thread_buffer_t * tl_buffer = nullptr;
+
+thread_buffer_t * register_thread_buffer()
+{
+  auto & s = state();
+  std::lock_guard<std::mutex> lock(s.buffers_mutex);
+  if (s.buffers.size() >= std::numeric_limits<std::uint16_t>::max()) {
+    return nullptr;
+  }
+  s.buffers.emplace_back(
+    new thread_buffer_t(s.capacity,
+                        static_cast<std::uint16_t>(s.buffers.size())));
+  return s.buffers.back().get();
+}
+
+/**
+ * Writes all records in ring buffers to the trace file.
+ * Must be called with flush_mutex held.
+ */
+void drain_buffers(bool write)
+{
+  auto & s = state();
+  std::vector<thread_buffer_t *> buffers;
+  {
+    std::lock_guard<std::mutex> lock(s.buffers_mutex);
+    for (auto & buf : s.buffers) {
+      buffers.push_back(buf.get());
+    }
+  }
+  for (auto * buf : buffers) {
+    std::uint64_t tail = buf->tail.load(std::memory_order_relaxed);
+    std::uint64_t head = buf->head.load(std::memory_order_acquire);
+    if (write) {
+      while (tail != head) {
+        // Contiguous section up to the end of the ring:
+        std::uint64_t first = tail & buf->mask;
+        std::uint64_t count = std::min<std::uint64_t>(
+                                head - tail, buf->records.size() - first);
+        s.out.write(reinterpret_cast<const char *>(&buf->records[first]),
+                    count * sizeof(record_t));
+        tail += count;
+      }
+    }
+    buf->tail.store(head, std::memory_order_release);
+  }
+}
+
+/**
+ * Waits for threads that passed the check of the enabled flag before it
+ * has been cleared to finish writing their record.
+ */
+void quiesce_writers()
+{
+  auto & s = state();
+  std::lock_guard<std::mutex> lock(s.buffers_mutex);
+  for (auto & buf : s.buffers) {
+    while (buf->writing.load()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void flush_loop()
+{
+  auto & s = state();
+  std::unique_lock<std::mutex> lock(s.flush_mutex);
+  while (!s.stop_flusher) {
+    s.flush_cv.wait_for(lock, std::chrono::milliseconds(20));
+    drain_buffers(true);
+  }
+}
+
+void dart_trace_callback(
+  dart_trace_event_t   event,
+  dart_trace_phase_t   phase,
+  size_t               nbytes,
+  void               * userdata)
+{
+  const event_id_t * ids = static_cast<const event_id_t *>(userdata);
+  EventTrace::record(ids[event],
+                     (phase == DART_TRACE_BEGIN)
+                       ? EventTrace::Phase::Begin
+                       : EventTrace::Phase::End,
+                     nbytes);
+}
+
+std::size_t buffer_capacity()
+{
+  std::size_t capacity = 1 << 16;
+  if (dash::util::Config::is_set("DASH_EVENT_TRACE_BUFFER")) {
+    capacity = dash::util::Config::get<std::size_t>(
+                 "DASH_EVENT_TRACE_BUFFER");
+  }
+  // Round up to power of two:
+  std::size_t pow2 = 1024;
+  while (pow2 < capacity) {
+    pow2 <<= 1;
+  }
+  return pow2;
+}
+
+template <typename T>
+bool read_value(std::istream & in, T & value)
+{
+  return static_cast<bool>(
+           in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+std::string json_escape(const std::string & str)
+{
+  std::string escaped;
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    if (static_cast<unsigned char>(c) >= 0x20) {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+struct unit_trace_t {
+  file_header_t                                  header;
+  std::vector<record_t>                          records;
+  std::unordered_map<event_id_t, std::string>    names;
+};
+
+bool read_trace_file(const std::string & filename, unit_trace_t & trace)
+{
+  std::ifstream in(filename, std::ios::binary);
+  if (!in ||
+      !read_value(in, trace.header) ||
+      std::memcmp(trace.header.magic, trace_file_magic, 8) != 0 ||
+      trace.header.record_size != sizeof(record_t)) {
+    DASH_LOG_ERROR("EventTrace::merge_chrome_trace",
+                   "invalid trace file", filename);
+    return false;
+  }
+  file_trailer_t trailer;
+  in.seekg(-static_cast<std::streamoff>(sizeof(file_trailer_t)),
+           std::ios::end);
+  if (!read_value(in, trailer) ||
+      std::memcmp(trailer.magic, trace_trailer_magic, 8) != 0) {
+    DASH_LOG_ERROR("EventTrace::merge_chrome_trace",
+                   "incomplete trace file", filename);
+    return false;
+  }
+  auto num_records = (trailer.names_offset - sizeof(file_header_t)) /
+                     sizeof(record_t);
+  trace.records.resize(num_records);
+  in.seekg(sizeof(file_header_t), std::ios::beg);
+  in.read(reinterpret_cast<char *>(trace.records.data()),
+          num_records * sizeof(record_t));
+  in.seekg(trailer.names_offset, std::ios::beg);
+  for (std::uint64_t n = 0; n < trailer.num_names; ++n) {
+    std::uint32_t id;
+    std::uint32_t len;
+    if (!read_value(in, id) || !read_value(in, len)) {
+      return false;
+    }
+    std::string name(len, '\0');
+    in.read(&name[0], len);
+    trace.names[id] = name;
+  }
+  return static_cast<bool>(in);
+}
+
+} // namespace
+
+
+EventTrace::event_id EventTrace::intern(const char * name)
+{
+  auto & s = state();
+  std::lock_guard<std::mutex> lock(s.names_mutex);
+  auto it = s.ids.find(name);
+  if (it != s.ids.end()) {
+    return it->second;
+  }
+  event_id id = static_cast<event_id>(s.names.size());
+  s.names.push_back(name);
+  s.ids[name] = id;
+  return id;
+}
+
+std::string EventTrace::name(event_id id)
+{
+  auto & s = state();
+  std::lock_guard<std::mutex> lock(s.names_mutex);
+  return (id < s.names.size()) ? s.names[id] : std::string();
+}
+
+bool EventTrace::start(const std::string & path)
+{
+  auto & s = state();
+  std::lock_guard<std::mutex> lock(s.flush_mutex);
+  if (enabled() || s.flusher.joinable()) {
+    return false;
+  }
+  std::string trace_dir = path;
+  if (trace_dir.empty() &&
+      dash::util::Config::is_set("DASH_EVENT_TRACE_PATH")) {
+    trace_dir = dash::util::Config::get<std::string>(
+                  "DASH_EVENT_TRACE_PATH");
+  }
+  if (trace_dir.empty()) {
+    trace_dir = ".";
+  }
+  std::int32_t unit = dash::is_initialized()
+                        ? static_cast<std::int32_t>(
+                            dash::Team::GlobalUnitID())
+                        : 0;
+  std::ostringstream fn;
+  fn << trace_dir << "/"
+     << "u" << std::setfill('0') << std::setw(5) << unit
+     << ".events.bin";
+  s.filename = fn.str();
+  s.out.open(s.filename, std::ios::binary | std::ios::trunc);
+  if (!s.out) {
+    DASH_LOG_ERROR("EventTrace::start", "could not open", s.filename);
+    s.filename.clear();
+    return false;
+  }
+  DASH_LOG_DEBUG("EventTrace::start", "file:", s.filename);
+
+  timer_t::Calibrate(0);
+  file_header_t header;
+  std::memcpy(header.magic, trace_file_magic, 8);
+  header.unit        = unit;
+  header.record_size = sizeof(record_t);
+  header.ns_per_tick = 1000.0 *
+                       timer_t::timestamp_type::FrequencyPrescale() /
+                       timer_t::timestamp_type::FrequencyScaling();
+  s.out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  {
+    std::lock_guard<std::mutex> buffers_lock(s.buffers_mutex);
+    if (s.capacity == 0) {
+      s.capacity = buffer_capacity();
+    }
+    for (auto & buf : s.buffers) {
+      buf->dropped.store(0, std::memory_order_relaxed);
+    }
+  }
+  // Discard events recorded while tracing was stopped:
+  drain_buffers(false);
+
+  for (int ev = 0; ev < DART_TRACE_EVENT_LAST; ++ev) {
+    s.dart_ids[ev] = intern(
+                       dart_trace_event_name(
+                         static_cast<dart_trace_event_t>(ev)));
+  }
+  s.stop_flusher = false;
+  s.flusher      = std::thread(flush_loop);
+  _enabled.store(true, std::memory_order_release);
+  dart_trace_set_callback(dart_trace_callback, s.dart_ids);
+  return true;
+}
+
+void EventTrace::stop()
+{
+  auto & s = state();
+  if (!s.flusher.joinable()) {
+    return;
+  }
+  dart_trace_set_callback(NULL, NULL);
+  // Sequentially consistent, pairs with the writing flag in record():
+  _enabled.store(false);
+  {
+    std::lock_guard<std::mutex> lock(s.flush_mutex);
+    s.stop_flusher = true;
+  }
+  s.flush_cv.notify_all();
+  s.flusher.join();
+  quiesce_writers();
+
+  std::lock_guard<std::mutex> lock(s.flush_mutex);
+  drain_buffers(true);
+
+  file_trailer_t trailer;
+  trailer.names_offset = static_cast<std::uint64_t>(s.out.tellp());
+  {
+    std::lock_guard<std::mutex> names_lock(s.names_mutex);
+    trailer.num_names = s.names.size();
+    for (std::uint32_t id = 0; id < s.names.size(); ++id) {
+      std::uint32_t len = static_cast<std::uint32_t>(s.names[id].size());
+      s.out.write(reinterpret_cast<const char *>(&id),  sizeof(id));
+      s.out.write(reinterpret_cast<const char *>(&len), sizeof(len));
+      s.out.write(s.names[id].data(), len);
+    }
+  }
+  std::memcpy(trailer.magic, trace_trailer_magic, 8);
+  s.out.write(reinterpret_cast<const char *>(&trailer), sizeof(trailer));
+  s.out.close();
+  DASH_LOG_DEBUG("EventTrace::stop", "file:", s.filename,
+                 "dropped:", dropped());
+}
+
+void EventTrace::record(
+  event_id      id,
+  Phase         phase,
+  std::uint64_t arg) noexcept
+{
+  // Ring buffers are sized in start(), a thread must not register its
+  // buffer before:
+  if (!_enabled.load(std::memory_order_acquire)) {
+    return;
+  }
+  thread_buffer_t * buf = tl_buffer;
+  if (buf == nullptr) {
+    try {
+      buf = tl_buffer = register_thread_buffer();
+    } catch (...) {
+      return;
+    }
+    if (buf == nullptr) {
+      return;
+    }
+  }
+  // Announce the write before checking again whether tracing has been
+  // stopped in the meantime, stop() waits for the flag to be cleared:
+  buf->writing.store(true);
+  if (!_enabled.load()) {
+    buf->writing.store(false, std::memory_order_release);
+    return;
+  }
+  std::uint64_t head = buf->head.load(std::memory_order_relaxed);
+  if (head - buf->tail.load(std::memory_order_acquire) >=
+      buf->records.size()) {
+    buf->dropped.fetch_add(1, std::memory_order_relaxed);
+    buf->writing.store(false, std::memory_order_release);
+    return;
+  }
+  record_t & rec = buf->records[head & buf->mask];
+  rec.ts       = timer_t::Now();
+  rec.arg      = arg;
+  rec.id       = id;
+  rec.thread   = buf->thread;
+  rec.phase    = phase;
+  rec.reserved = 0;
+  buf->head.store(head + 1, std::memory_order_release);
+  buf->writing.store(false, std::memory_order_release);
+}
+
+std::string EventTrace::filename()
+{
+  return state().filename;
+}
+
+std::uint64_t EventTrace::dropped()
+{
+  auto & s = state();
+  std::lock_guard<std::mutex> lock(s.buffers_mutex);
+  std::uint64_t total = 0;
+  for (auto & buf : s.buffers) {
+    total += buf->dropped.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+std::size_t EventTrace::merge_chrome_trace(
+  const std::vector<std::string> & trace_files,
+  std::ostream                   & out)
+{
+  std::vector<unit_trace_t> traces(trace_files.size());
+  double ts_min_ns = std::numeric_limits<double>::max();
+  for (std::size_t f = 0; f < trace_files.size(); ++f) {
+    if (!read_trace_file(trace_files[f], traces[f])) {
+      traces[f].records.clear();
+      continue;
+    }
+    for (const auto & rec : traces[f].records) {
+      ts_min_ns = std::min(ts_min_ns,
+                           rec.ts * traces[f].header.ns_per_tick);
+    }
+  }
+
+  std::size_t num_events = 0;
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  const char * sep = "\n";
+  for (const auto & trace : traces) {
+    if (trace.records.empty()) {
+      continue;
+    }
+    auto unit = trace.header.unit;
+    out << sep
+        << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << unit
+        << ",\"args\":{\"name\":\"unit " << unit << "\"}}";
+    sep = ",\n";
+    for (const auto & rec : trace.records) {
+      auto name_it = trace.names.find(rec.id);
+      std::string name = (name_it != trace.names.end())
+                           ? json_escape(name_it->second)
+                           : std::to_string(rec.id);
+      const char * ph = (rec.phase == Phase::Begin) ? "B"
+                      : (rec.phase == Phase::End)   ? "E"
+                      : "i";
+      double ts_us = (rec.ts * trace.header.ns_per_tick - ts_min_ns) /
+                     1000.0;
+      out << sep
+          << "{\"name\":\"" << name << "\""
+          << ",\"ph\":\"" << ph << "\""
+          << ",\"ts\":" << std::fixed << std::setprecision(3) << ts_us
+          << ",\"pid\":" << unit
+          << ",\"tid\":" << rec.thread;
+      if (rec.phase == Phase::Instant) {
+        out << ",\"s\":\"t\"";
+      }
+      if (rec.arg != 0) {
+        out << ",\"args\":{\"arg\":" << rec.arg << "}";
+      }
+      out << "}";
+      ++num_events;
+    }
+  }
+  out << "\n]}\n";
+  return num_events;
+}
+
+} // namespace util
+} // namespace dash
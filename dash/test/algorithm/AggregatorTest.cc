@@ -0,0 +1,76 @@
+
+#include "AggregatorTest.h"
+
+#include <dash/Aggregator.h>
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
+
+#include <cstdint>
+
+
+TEST_F(AggregatorTest, HistogramSum) {
+  const size_t nbins_per_unit = 13;
+  const size_t nbins          = nbins_per_unit * _dash_size;
+  const size_t nkeys          = 1000;
+
+  dash::Array<int> histo(nbins, dash::BLOCKCYCLIC(5));
+  dash::fill(histo.begin(), histo.end(), 0);
+  histo.barrier();
+
+  {
+    // small capacity to ship multiple batches per unit:
+    dash::Aggregator<decltype(histo)> agg(histo, 16);
+    EXPECT_EQ_U(16u, agg.capacity());
+    for (size_t k = 0; k < nkeys; ++k) {
+      // every unit adds to all bins, with repeated bins in a batch:
+      agg.update((k * 7) % nbins, 1);
+    }
+    EXPECT_EQ_U(nkeys, agg.num_updates());
+    EXPECT_GT_U(agg.num_batches(), 1u);
+    EXPECT_LE_U(agg.num_shipped(), nkeys);
+  }
+  histo.barrier();
+
+  if (_dash_id == 0) {
+    std::vector<int> expected(nbins, 0);
+    for (size_t k = 0; k < nkeys; ++k) {
+      expected[(k * 7) % nbins] += 1;
+    }
+    for (size_t b = 0; b < nbins; ++b) {
+      EXPECT_EQ_U(expected[b] * static_cast<int>(_dash_size),
+                  static_cast<int>(histo[b]));
+    }
+  }
+  histo.barrier();
+}
+
+TEST_F(AggregatorTest, XorUpdatesAndFlush) {
+  typedef uint64_t value_t;
+  const size_t nelem_per_unit = 100;
+  const size_t nelem          = nelem_per_unit * _dash_size;
+
+  dash::Array<value_t> table(nelem);
+  for (size_t l = 0; l < table.lsize(); ++l) {
+    table.local[l] = table.pattern().global(l);
+  }
+  table.barrier();
+
+  dash::Aggregator<decltype(table), dash::bit_xor<value_t>>
+    agg(table, 64);
+  // Same pseudo-random updates on all units, applied twice:
+  for (int rep = 0; rep < 2; ++rep) {
+    uint64_t ran = 1;
+    for (size_t i = 0; i < 500; ++i) {
+      ran = ran * 6364136223846793005ULL + 1442695040888963407ULL;
+      agg(static_cast<long>((ran >> 33) % nelem), ran);
+    }
+    agg.flush();
+  }
+  table.barrier();
+
+  for (size_t l = 0; l < table.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<value_t>(table.pattern().global(l)),
+                table.local[l]);
+  }
+  table.barrier();
+}
@@ -8,6 +8,7 @@
 #include <dash/pattern/ShiftTilePattern1D.h>
 #include <dash/pattern/TilePattern1D.h>
 #include <dash/pattern/BlockPattern1D.h>
+#include <dash/pattern/TilePattern.h>
 
 #include "../TestBase.h"
 #include "../TestLogHelpers.h"
@@ -889,6 +890,189 @@ TEST_F(CopyTest, AsyncGlobalToLocalTest)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToLocalBlockCyclic)
+{
+  // Copy a range spanning several blocks of every unit, so every remote
+  // unit is accessed with a single indexed transfer.
+  const int block_size     = 3;
+  const int blocks_per_unit = 4;
+  size_t num_elem_total     = _dash_size * block_size * blocks_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(block_size));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  // Unaligned range to include partial blocks:
+  const size_t first = 1;
+  const size_t last  = num_elem_total - 2;
+  std::vector<int> local_copy(last - first);
+  int * dest_end = dash::copy(array.begin() + first,
+                              array.begin() + last,
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + local_copy.size(), dest_end);
+  for (size_t i = first; i < last; ++i) {
+    EXPECT_EQ_U(static_cast<int>(array[i]), local_copy[i - first]);
+  }
+  array.barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToLocalTiledRows)
+{
+  // Copy rows of a tiled matrix, consisting of one run per tile row.
+  typedef dash::TilePattern<2>                   pattern_t;
+  typedef dash::Matrix<int, 2, long, pattern_t>  matrix_t;
+
+  const size_t tile_size = 4;
+  const size_t extent_x  = tile_size * _dash_size;
+  const size_t extent_y  = tile_size * 2;
+
+  dash::TeamSpec<2> teamspec(1, _dash_size);
+  matrix_t matrix(
+    pattern_t(dash::SizeSpec<2>(extent_y, extent_x),
+              dash::DistributionSpec<2>(dash::TILE(tile_size),
+                                        dash::TILE(tile_size)),
+              teamspec));
+  for (size_t l = 0; l < matrix.local.size(); ++l) {
+    matrix.lbegin()[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  matrix.barrier();
+
+  // Two tile rows of the first tile in row-major order of tiles:
+  const size_t num_copy = tile_size * 2 + 1;
+  std::vector<int> local_copy(num_copy);
+  int * dest_end = dash::copy(matrix.begin() + 1,
+                              matrix.begin() + 1 + num_copy,
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + num_copy, dest_end);
+  for (size_t i = 0; i < num_copy; ++i) {
+    EXPECT_EQ_U(static_cast<int>(matrix.begin()[1 + i]), local_copy[i]);
+  }
+  matrix.barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalViewToLocalTiled)
+{
+  // Copy a rectangular view intersecting several tiles of every unit to a
+  // dense local buffer and back.
+  typedef dash::TilePattern<2>                   pattern_t;
+  typedef dash::Matrix<int, 2, long, pattern_t>  matrix_t;
+
+  const size_t tile_size = 4;
+  const size_t extent_y  = tile_size * 3;
+  const size_t extent_x  = tile_size * 2 * _dash_size;
+
+  dash::TeamSpec<2> teamspec(1, _dash_size);
+  matrix_t matrix(
+    pattern_t(dash::SizeSpec<2>(extent_y, extent_x),
+              dash::DistributionSpec<2>(dash::TILE(tile_size),
+                                        dash::TILE(tile_size)),
+              teamspec));
+  for (size_t l = 0; l < matrix.local.size(); ++l) {
+    matrix.lbegin()[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  matrix.barrier();
+
+  // View not aligned to tile boundaries:
+  const size_t row = 1;
+  const size_t col = 2;
+  const size_t nrows = extent_y - 3;
+  const size_t ncols = extent_x - 3;
+  auto view = matrix.sub<0>(row, nrows).sub<1>(col, ncols);
+
+  std::vector<int> local_copy(nrows * ncols);
+  int * dest_end = dash::copy(view, local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + local_copy.size(), dest_end);
+  for (size_t r = 0; r < nrows; ++r) {
+    for (size_t c = 0; c < ncols; ++c) {
+      EXPECT_EQ_U(static_cast<int>(matrix[row + r][col + c]),
+                  local_copy[r * ncols + c]);
+    }
+  }
+  matrix.barrier();
+
+  // Negate values in the view, every unit writes a separate row range:
+  const size_t u_nrows = nrows / _dash_size;
+  const size_t u_row   = row + _dash_id * u_nrows;
+  if (u_nrows > 0) {
+    std::vector<int> negated(u_nrows * ncols);
+    for (size_t r = 0; r < u_nrows; ++r) {
+      for (size_t c = 0; c < ncols; ++c) {
+        negated[r * ncols + c] = -local_copy[(u_row - row + r) * ncols + c];
+      }
+    }
+    auto u_view = matrix.sub<0>(u_row, u_nrows).sub<1>(col, ncols);
+    const int * src_end = dash::copy(negated.data(), u_view);
+    EXPECT_EQ_U(negated.data() + negated.size(), src_end);
+  }
+  matrix.barrier();
+
+  for (size_t r = 0; r < u_nrows * _dash_size; ++r) {
+    for (size_t c = 0; c < ncols; ++c) {
+      EXPECT_EQ_U(-local_copy[r * ncols + c],
+                  static_cast<int>(matrix[row + r][col + c]));
+    }
+  }
+  matrix.barrier();
+}
+
+TEST_F(CopyTest, AsyncGlobalViewToLocalBlockCyclic)
+{
+  // Copy a rectangular view of a block-cyclic matrix with non-contiguous
+  // local columns asynchronously.
+  typedef dash::Matrix<int, 2>  matrix_t;
+
+  const size_t extent_y = 8;
+  const size_t extent_x = 3 * 2 * _dash_size;
+
+  matrix_t matrix(
+    dash::SizeSpec<2>(extent_y, extent_x),
+    dash::DistributionSpec<2>(dash::NONE, dash::BLOCKCYCLIC(3)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(1, _dash_size));
+  for (size_t l = 0; l < matrix.local.size(); ++l) {
+    matrix.lbegin()[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  matrix.barrier();
+
+  const size_t row   = 2;
+  const size_t col   = 1;
+  const size_t nrows = extent_y - 3;
+  const size_t ncols = extent_x - 2;
+  auto view = matrix.sub<0>(row, nrows).sub<1>(col, ncols);
+
+  std::vector<int> local_copy(nrows * ncols);
+  auto fut = dash::copy_async(view, local_copy.data());
+  while (!fut.test()) { }
+  EXPECT_EQ_U(local_copy.data() + local_copy.size(), fut.get());
+  for (size_t r = 0; r < nrows; ++r) {
+    for (size_t c = 0; c < ncols; ++c) {
+      EXPECT_EQ_U(static_cast<int>(matrix[row + r][col + c]),
+                  local_copy[r * ncols + c]);
+    }
+  }
+  matrix.barrier();
+
+  // Write a single row per unit asynchronously:
+  if (_dash_id < nrows) {
+    std::vector<int> values(ncols, static_cast<int>(_dash_id) - 1);
+    auto u_view  = matrix.sub<0>(row + _dash_id, 1).sub<1>(col, ncols);
+    auto put_fut = dash::copy_async(values.data(), u_view);
+    put_fut.wait();
+    EXPECT_EQ_U(values.data() + ncols, put_fut.get());
+  }
+  matrix.barrier();
+
+  for (size_t r = 0; r < std::min<size_t>(nrows, _dash_size); ++r) {
+    for (size_t c = 0; c < ncols; ++c) {
+      EXPECT_EQ_U(static_cast<int>(r) - 1,
+                  static_cast<int>(matrix[row + r][col + c]));
+    }
+  }
+  matrix.barrier();
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
@@ -0,0 +1,165 @@
+#include "RedistributeTest.h"
+
+#include <dash/algorithm/Redistribute.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/pattern/TilePattern.h>
+#include <dash/pattern/ShiftTilePattern.h>
+
+
+TEST_F(RedistributeTest, ArrayBlockedToCyclic)
+{
+  // Non-divisible number of elements:
+  const size_t num_elem = dash::size() * 23 + 5;
+
+  dash::Array<int> src(num_elem, dash::BLOCKED);
+  dash::Array<int> dst_cyclic(num_elem, dash::CYCLIC);
+  dash::Array<int> dst_bcyclic(num_elem, dash::BLOCKCYCLIC(4));
+
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = static_cast<int>(src.pattern().global(l));
+  }
+  src.barrier();
+
+  dash::redistribute(src, dst_cyclic);
+  for (size_t l = 0; l < dst_cyclic.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<int>(dst_cyclic.pattern().global(l)),
+                static_cast<int>(dst_cyclic.local[l]));
+  }
+
+  // Block-cyclic to blocked and back:
+  dash::redistribute(dst_cyclic, dst_bcyclic);
+  std::fill(src.lbegin(), src.lend(), -1);
+  src.barrier();
+  dash::redistribute(dst_bcyclic, src);
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<int>(src.pattern().global(l)),
+                static_cast<int>(src.local[l]));
+  }
+}
+
+TEST_F(RedistributeTest, ArrayNoRemoteSend)
+{
+  const size_t num_elem = dash::size() * 4;
+
+  // Unit 0 keeps all of its source elements and only receives, remaining
+  // units only send:
+  dash::Array<int> src(num_elem, dash::BLOCKED);
+  dash::Array<int> dst(num_elem, dash::BLOCKCYCLIC(
+                                   std::max<size_t>(num_elem - 2, 4)));
+
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = static_cast<int>(src.pattern().global(l));
+  }
+  src.barrier();
+
+  dash::redistribute(src, dst);
+  for (size_t l = 0; l < dst.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<int>(dst.pattern().global(l)),
+                static_cast<int>(dst.local[l]));
+  }
+}
+
+TEST_F(RedistributeTest, MatrixBlockedToTiled)
+{
+  typedef dash::TilePattern<2>                      tile_pattern_t;
+  typedef dash::ShiftTilePattern<2>                 shift_pattern_t;
+  typedef typename tile_pattern_t::index_type       index_t;
+
+  // Tiled patterns require extents divisible by tile size and number of
+  // units:
+  const size_t nrows = 3 * 2 * dash::size();
+  const size_t ncols = 2 * 2 * dash::size();
+
+  dash::Matrix<long, 2> src(
+    dash::SizeSpec<2>(nrows, ncols),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+
+  dash::TeamSpec<2> teamspec(dash::Team::All());
+  teamspec.balance_extents();
+  tile_pattern_t tile_pattern(
+    dash::SizeSpec<2>(nrows, ncols),
+    dash::DistributionSpec<2>(dash::TILE(3), dash::TILE(2)),
+    teamspec);
+  dash::Matrix<long, 2, index_t, tile_pattern_t> dst_tiled(tile_pattern);
+
+  shift_pattern_t shift_pattern(
+    dash::SizeSpec<2>(nrows, ncols),
+    dash::DistributionSpec<2>(dash::TILE(2), dash::TILE(2)),
+    dash::TeamSpec<2>(dash::Team::All()));
+  dash::Matrix<long, 2, index_t, shift_pattern_t> dst_shift(shift_pattern);
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < nrows; ++i) {
+      for (size_t j = 0; j < ncols; ++j) {
+        src[i][j] = i * 1000 + j;
+      }
+    }
+  }
+  src.barrier();
+
+  dash::redistribute(src, dst_tiled);
+  dash::redistribute(dst_tiled, dst_shift);
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < nrows; ++i) {
+      for (size_t j = 0; j < ncols; ++j) {
+        long expected = i * 1000 + j;
+        EXPECT_EQ_U(expected, static_cast<long>(dst_tiled[i][j]));
+        EXPECT_EQ_U(expected, static_cast<long>(dst_shift[i][j]));
+      }
+    }
+  }
+  dst_shift.barrier();
+}
+
+TEST_F(RedistributeTest, Transpose)
+{
+  typedef dash::TilePattern<2>                      tile_pattern_t;
+  typedef typename tile_pattern_t::index_type       index_t;
+
+  const size_t nrows = 3 * 3 * dash::size();
+  const size_t ncols = 2 * dash::size();
+
+  dash::Matrix<double, 2> src(
+    dash::SizeSpec<2>(nrows, ncols),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+
+  dash::TeamSpec<2> teamspec(dash::Team::All());
+  teamspec.balance_extents();
+  tile_pattern_t tile_pattern(
+    dash::SizeSpec<2>(ncols, nrows),
+    dash::DistributionSpec<2>(dash::TILE(2), dash::TILE(3)),
+    teamspec);
+  dash::Matrix<double, 2, index_t, tile_pattern_t> dst(tile_pattern);
+
+  // Extents of destination do not match transposed source:
+  dash::Matrix<double, 2> invalid(
+    dash::SizeSpec<2>(nrows, ncols),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE));
+  if (nrows != ncols) {
+    EXPECT_THROW(
+      dash::transpose(src, invalid),
+      dash::exception::InvalidArgument);
+  }
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < nrows; ++i) {
+      for (size_t j = 0; j < ncols; ++j) {
+        src[i][j] = i + j / 1000.0;
+      }
+    }
+  }
+  src.barrier();
+
+  dash::transpose(src, dst);
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < nrows; ++i) {
+      for (size_t j = 0; j < ncols; ++j) {
+        EXPECT_EQ_U(i + j / 1000.0, static_cast<double>(dst[j][i]));
+      }
+    }
+  }
+  dst.barrier();
+}
@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__REDISTRIBUTE_TEST_H_
+#define DASH__TEST__REDISTRIBUTE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms \c dash::redistribute and
+ * \c dash::transpose.
+ */
+class RedistributeTest : public dash::test::TestBase {
+protected:
+
+  RedistributeTest() {
+    LOG_MESSAGE(">>> Test suite: RedistributeTest");
+  }
+
+  virtual ~RedistributeTest() {
+    LOG_MESSAGE("<<< Closing test suite: RedistributeTest");
+  }
+};
+
+#endif // DASH__TEST__REDISTRIBUTE_TEST_H_
@@ -0,0 +1,113 @@
+
+#include <gtest/gtest.h>
+
+#include "ReduceTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/Fill.h>
+
+
+TEST_F(ReduceTest, SumAllUnits) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  int    value = 2, start = 10;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  dash::fill(target.begin(), target.end(), value);
+
+  dash::barrier();
+
+  // Result is available at all units:
+  int result = dash::reduce(target.begin(), target.end(), start);
+  ASSERT_EQ_U(num_elem_total * value + start, result);
+
+  result = dash::reduce(target.begin(), target.end());
+  ASSERT_EQ_U(num_elem_total * value, result);
+}
+
+
+TEST_F(ReduceTest, MinMaxEmptyLocalRange) {
+  // Fewer elements than units, local ranges of some units are empty:
+  size_t num_elem_total = std::max<size_t>(1, _dash_size / 2);
+
+  dash::Array<long> target(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < target.lsize(); ++li) {
+    target.local[li] = target.pattern().global(li) + 5;
+  }
+
+  dash::barrier();
+
+  long max = dash::reduce(target.begin(), target.end(), 0L,
+                          dash::max<long>());
+  ASSERT_EQ_U(num_elem_total + 4, max);
+
+  long min = dash::reduce(target.begin(), target.end(), 100L,
+                          dash::min<long>());
+  ASSERT_EQ_U(5, min);
+
+  // Subrange at the back of the array:
+  long sum = dash::reduce(target.begin() + (num_elem_total - 1),
+                          target.end(), 0L);
+  ASSERT_EQ_U(num_elem_total + 4, sum);
+}
+
+
+TEST_F(ReduceTest, TransformReduce) {
+  const size_t num_elem_local = 50;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<double> target(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < target.lsize(); ++li) {
+    target.local[li] = static_cast<double>(target.pattern().global(li));
+  }
+
+  dash::barrier();
+
+  // Sum of squares:
+  double result = dash::transform_reduce(
+                    target.begin(), target.end(),
+                    1.0,
+                    dash::plus<double>(),
+                    [](double x) { return x * x; });
+
+  double expected = 1.0;
+  for (size_t i = 0; i < num_elem_total; ++i) {
+    expected += static_cast<double>(i) * i;
+  }
+  ASSERT_EQ_U(expected, result);
+}
+
+
+TEST_F(ReduceTest, UserDefinedOperation) {
+  struct value_struct {
+    int x, y;
+  };
+
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < target.lsize(); ++li) {
+    target.local[li] = static_cast<int>(target.pattern().global(li));
+  }
+
+  dash::barrier();
+
+  // Count of elements and maximum value, reduce operation has no DART
+  // equivalent:
+  value_struct result = dash::transform_reduce(
+                          target.begin(), target.end(),
+                          value_struct { 0, -1 },
+                          [](const value_struct & a,
+                             const value_struct & b) {
+                            return value_struct {
+                                     a.x + b.x, std::max(a.y, b.y) };
+                          },
+                          [](int v) { return value_struct { 1, v }; });
+
+  ASSERT_EQ_U(num_elem_total,     result.x);
+  ASSERT_EQ_U(num_elem_total - 1, result.y);
+}
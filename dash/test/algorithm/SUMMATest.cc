@@ -2,11 +2,15 @@
 #include "SUMMATest.h"
 
 #include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/SUMMA25D.h>
+#include <dash/algorithm/internal/GEMM.h>
 #include <dash/Matrix.h>
 #include <dash/Meta.h>
+#include <dash/util/Config.h>
 
 #include <sstream>
 #include <iomanip>
+#include <vector>
 
 
 #define SKIP_TEST_IF_NO_SUMMA()           \
@@ -276,3 +280,182 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
 
   dash::barrier();
 }
+
+TEST_F(SUMMATest, BuiltinGEMM)
+{
+  // Extents not divisible by register tile and cache block sizes:
+  long long m = 37;
+  long long n = 53;
+  long long k = 301;
+
+  std::vector<double> a(m * k), b(k * n);
+  for (size_t i = 0; i < a.size(); ++i) { a[i] = (i % 11) - 5.0; }
+  for (size_t i = 0; i < b.size(); ++i) { b[i] = (i % 7)  - 3.0; }
+
+  for (auto storage : { dash::ROW_MAJOR, dash::COL_MAJOR }) {
+    // Reference result, initial values of C are accumulated:
+    std::vector<double> c_exp(m * n, 1.0);
+    for (long long i = 0; i < m; ++i) {
+      for (long long j = 0; j < n; ++j) {
+        for (long long p = 0; p < k; ++p) {
+          if (storage == dash::ROW_MAJOR) {
+            c_exp[i * n + j] += a[i * k + p] * b[p * n + j];
+          } else {
+            c_exp[i + j * m] += a[i + p * m] * b[p + j * k];
+          }
+        }
+      }
+    }
+    std::vector<double> c_dbl(m * n, 1.0);
+    dash::internal::gemm(a.data(), b.data(), c_dbl.data(),
+                         m, n, k, storage);
+
+    std::vector<float>  a_flt(a.begin(), a.end());
+    std::vector<float>  b_flt(b.begin(), b.end());
+    std::vector<float>  c_flt(m * n, 1.0f);
+    dash::internal::gemm(a_flt.data(), b_flt.data(), c_flt.data(),
+                         m, n, k, storage);
+
+    std::vector<long>   a_int(a.begin(), a.end());
+    std::vector<long>   b_int(b.begin(), b.end());
+    std::vector<long>   c_int(m * n, 1);
+    dash::internal::gemm(a_int.data(), b_int.data(), c_int.data(),
+                         m, n, k, storage);
+
+    for (long long e = 0; e < m * n; ++e) {
+      ASSERT_EQ_U(c_exp[e], c_dbl[e]);
+      ASSERT_EQ_U(static_cast<float>(c_exp[e]), c_flt[e]);
+      ASSERT_EQ_U(static_cast<long>(c_exp[e]),  c_int[e]);
+    }
+  }
+}
+
+TEST_F(SUMMATest, SeqTilePatternMatrixBuiltinGEMM)
+{
+  typedef dash::SeqTilePattern<2>        pattern_t;
+  typedef double                         value_t;
+  typedef typename pattern_t::index_type index_t;
+  typedef typename pattern_t::size_type  extent_t;
+
+  extent_t tile_size   = 7;
+  extent_t base_size   = tile_size * 3;
+  extent_t extent_rows = dash::size() * base_size;
+  extent_t extent_cols = dash::size() * base_size;
+  dash::SizeSpec<2> size_spec(extent_rows, extent_cols);
+
+  auto team_spec = dash::make_team_spec<
+                     dash::summa_pattern_partitioning_constraints,
+                     dash::summa_pattern_mapping_constraints,
+                     dash::summa_pattern_layout_constraints >(
+                       size_spec);
+
+  dash::DistributionSpec<2> dist_spec(dash::TILE(tile_size),
+                                      dash::TILE(tile_size));
+  pattern_t pattern(size_spec, dist_spec, team_spec);
+
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_a(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_b(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_c(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_c_blt(pattern);
+
+  // Small integral values so results of both kernels are exact:
+  for (size_t l = 0; l < matrix_a.local.size(); ++l) {
+    auto g = l + dash::myid().id * matrix_a.local.size();
+    matrix_a.lbegin()[l]     = static_cast<value_t>(g % 13) - 6;
+    matrix_b.lbegin()[l]     = static_cast<value_t>(g %  5) - 2;
+    matrix_c.lbegin()[l]     = 0;
+    matrix_c_blt.lbegin()[l] = 0;
+  }
+  dash::barrier();
+
+  // Result of the default local multiplication (MKL or BLAS if available):
+  dash::summa(matrix_a, matrix_b, matrix_c);
+  dash::barrier();
+
+  dash::util::Config::set("DASH_SUMMA_BUILTIN_GEMM", true);
+  dash::summa(matrix_a, matrix_b, matrix_c_blt);
+  dash::util::Config::set("DASH_SUMMA_BUILTIN_GEMM", false);
+  dash::barrier();
+
+  for (size_t l = 0; l < matrix_c.local.size(); ++l) {
+    ASSERT_EQ_U(matrix_c.lbegin()[l], matrix_c_blt.lbegin()[l]);
+  }
+  dash::barrier();
+}
+
+TEST_F(SUMMATest, SUMMA25D)
+{
+  typedef dash::SeqTilePattern<2>        pattern_t;
+  typedef double                         value_t;
+  typedef typename pattern_t::index_type index_t;
+  typedef typename pattern_t::size_type  extent_t;
+
+  extent_t tile_size = 4;
+  extent_t extent    = dash::size() * tile_size * 2;
+  dash::SizeSpec<2> size_spec(extent, extent);
+
+  auto team_spec = dash::make_team_spec<
+                     dash::summa_pattern_partitioning_constraints,
+                     dash::summa_pattern_mapping_constraints,
+                     dash::summa_pattern_layout_constraints >(
+                       size_spec);
+
+  dash::DistributionSpec<2> dist_spec(dash::TILE(tile_size),
+                                      dash::TILE(tile_size));
+  pattern_t pattern(size_spec, dist_spec, team_spec);
+
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_a(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_b(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_c(pattern);
+
+  if (dash::myid().id == 0) {
+    for (index_t i = 0; i < static_cast<index_t>(extent); ++i) {
+      for (index_t j = 0; j < static_cast<index_t>(extent); ++j) {
+        matrix_a[i][j] = static_cast<value_t>((i * 7 + j * 3) % 5);
+        matrix_b[i][j] = static_cast<value_t>((i * 2 + j * 5) % 7);
+      }
+    }
+  }
+  dash::barrier();
+
+  // Expected result:
+  std::vector<value_t> l_a(extent * extent);
+  std::vector<value_t> l_b(extent * extent);
+  std::vector<value_t> l_c(extent * extent, 0);
+  if (dash::myid().id == 0) {
+    for (index_t i = 0; i < static_cast<index_t>(extent); ++i) {
+      for (index_t j = 0; j < static_cast<index_t>(extent); ++j) {
+        l_a[i * extent + j] = matrix_a[i][j];
+        l_b[i * extent + j] = matrix_b[i][j];
+      }
+    }
+    for (extent_t i = 0; i < extent; ++i) {
+      for (extent_t j = 0; j < extent; ++j) {
+        for (extent_t k = 0; k < extent; ++k) {
+          l_c[i * extent + j] += l_a[i * extent + k] * l_b[k * extent + j];
+        }
+      }
+    }
+  }
+
+  // Replication factor 0 denotes 2D SUMMA:
+  for (unsigned replication : { 0u, 1u, 2u, 3u,
+                                static_cast<unsigned>(dash::size()) }) {
+    std::fill(matrix_c.lbegin(), matrix_c.lend(), 0);
+    dash::barrier();
+    if (replication == 0) {
+      dash::summa(matrix_a, matrix_b, matrix_c);
+    } else {
+      dash::summa_25d(matrix_a, matrix_b, matrix_c, replication);
+    }
+    if (dash::myid().id == 0) {
+      for (index_t i = 0; i < static_cast<index_t>(extent); ++i) {
+        for (index_t j = 0; j < static_cast<index_t>(extent); ++j) {
+          value_t actual = matrix_c[i][j];
+          ASSERT_EQ_U(l_c[i * extent + j], actual);
+        }
+      }
+    }
+    dash::barrier();
+  }
+}
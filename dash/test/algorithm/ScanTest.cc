@@ -0,0 +1,271 @@
+#include <gtest/gtest.h>
+
+#include "ScanTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Scan.h>
+
+#include <vector>
+
+
+TEST_F(ScanTest, InclusiveExclusiveSum) {
+  // Unbalanced local sizes:
+  size_t num_elem_total = _dash_size * 1000 + 3;
+
+  dash::Array<long> in(num_elem_total, dash::BLOCKED);
+  dash::Array<long> out(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < in.lsize(); ++li) {
+    in.local[li] = in.pattern().global(li) + 1;
+  }
+
+  dash::barrier();
+
+  auto out_end = dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  ASSERT_EQ_U(out.end(), out_end);
+  for (size_t li = 0; li < out.lsize(); ++li) {
+    long g = out.pattern().global(li);
+    ASSERT_EQ_U((g + 1) * (g + 2) / 2, out.local[li]);
+  }
+
+  dash::exclusive_scan(in.begin(), in.end(), out.begin(), 5L);
+  for (size_t li = 0; li < out.lsize(); ++li) {
+    long g = out.pattern().global(li);
+    ASSERT_EQ_U(g * (g + 1) / 2 + 5, out.local[li]);
+  }
+
+  dash::barrier();
+
+  // Remote elements are available after synchronization:
+  ASSERT_EQ_U(5, static_cast<long>(out[0]));
+  long g_last = num_elem_total - 1;
+  ASSERT_EQ_U(g_last * (g_last + 1) / 2 + 5,
+              static_cast<long>(out[num_elem_total - 1]));
+}
+
+
+TEST_F(ScanTest, InPlaceSubRange) {
+  // Fewer elements than units, local ranges of some units are empty:
+  size_t num_elem_total = std::max<size_t>(3, _dash_size / 2 + 2);
+
+  dash::Array<int> arr(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < arr.lsize(); ++li) {
+    arr.local[li] = 2;
+  }
+
+  dash::barrier();
+
+  // Scan all elements except the first and the last one:
+  dash::inclusive_scan(arr.begin() + 1, arr.end() - 1, arr.begin() + 1,
+                       dash::max<int>(), 1);
+  dash::exclusive_scan(arr.begin() + 1, arr.end() - 1, arr.begin() + 1,
+                       0, dash::plus<int>());
+  for (size_t li = 0; li < arr.lsize(); ++li) {
+    long g = arr.pattern().global(li);
+    if (g == 0 || g == static_cast<long>(num_elem_total) - 1) {
+      ASSERT_EQ_U(2, arr.local[li]);
+    } else {
+      ASSERT_EQ_U(2 * (g - 1), arr.local[li]);
+    }
+  }
+}
+
+
+/**
+ * Affine function x -> a * x + b, composition is associative but not
+ * commutative.
+ */
+struct affine_t {
+  int a;
+  int b;
+};
+
+struct affine_compose {
+  affine_t operator()(const affine_t & f, const affine_t & g) const {
+    // Apply f, then g:
+    return affine_t { g.a * f.a, g.a * f.b + g.b };
+  }
+};
+
+TEST_F(ScanTest, TransformScanUserDefinedOperation) {
+  size_t num_elem_total = _dash_size * 57 + 5;
+
+  dash::Array<int> in(num_elem_total, dash::BLOCKED);
+  dash::Array<affine_t> out(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < in.lsize(); ++li) {
+    in.local[li] = in.pattern().global(li);
+  }
+
+  dash::barrier();
+
+  auto to_affine = [](int v) {
+                     return affine_t { (v % 3 == 0) ? -1 : 1, v % 7 };
+                   };
+  affine_compose compose;
+
+  // Expected results:
+  std::vector<affine_t> inclusive;
+  affine_t acc = to_affine(0);
+  inclusive.push_back(acc);
+  for (size_t g = 1; g < num_elem_total; ++g) {
+    acc = compose(acc, to_affine(g));
+    inclusive.push_back(acc);
+  }
+
+  dash::transform_inclusive_scan(in.begin(), in.end(), out.begin(),
+                                 compose, to_affine);
+  for (size_t li = 0; li < out.lsize(); ++li) {
+    auto g = out.pattern().global(li);
+    affine_t value = out.local[li];
+    ASSERT_EQ_U(inclusive[g].a, value.a);
+    ASSERT_EQ_U(inclusive[g].b, value.b);
+  }
+
+  affine_t init { 1, 3 };
+  dash::transform_exclusive_scan(in.begin(), in.end(), out.begin(),
+                                 init, compose, to_affine);
+  for (size_t li = 0; li < out.lsize(); ++li) {
+    auto g = out.pattern().global(li);
+    affine_t expected = (g == 0) ? init : compose(init, inclusive[g - 1]);
+    affine_t value    = out.local[li];
+    ASSERT_EQ_U(expected.a, value.a);
+    ASSERT_EQ_U(expected.b, value.b);
+  }
+}
+
+TEST_F(ScanTest, LocalPartitionsMultipleThreads) {
+  // The number of scan threads is 1 unless OpenMP is enabled, partition
+  // the local range explicitly to validate the combination of partitions:
+  typedef dash::internal::reduce_partial<affine_t> partial_t;
+  auto to_affine = [](int v) {
+                     return affine_t { (v % 3 == 0) ? -1 : 1, v % 7 };
+                   };
+  affine_compose compose;
+
+  // More elements than partitions, and fewer elements than partitions so
+  // some partitions are empty:
+  for (int l_size : { 37, 3 }) {
+    std::vector<int> in(l_size);
+    for (int i = 0; i < l_size; ++i) {
+      in[i] = i;
+    }
+    std::vector<affine_t> inclusive;
+    affine_t acc = to_affine(in[0]);
+    inclusive.push_back(acc);
+    for (int i = 1; i < l_size; ++i) {
+      acc = compose(acc, to_affine(in[i]));
+      inclusive.push_back(acc);
+    }
+
+    int  n_threads = 5;
+    auto partials  = dash::internal::local_scan_partials<affine_t>(
+                       in.begin(), l_size, n_threads, compose, to_affine);
+    ASSERT_EQ_U(n_threads, partials.size());
+
+    std::vector<affine_t> out(l_size);
+    dash::internal::local_transform_scan(
+      in.begin(), l_size, out.begin(), partial_t { affine_t(), false },
+      partials, compose, to_affine, true);
+    for (int i = 0; i < l_size; ++i) {
+      ASSERT_EQ_U(inclusive[i].a, out[i].a);
+      ASSERT_EQ_U(inclusive[i].b, out[i].b);
+    }
+
+    affine_t init { 1, 3 };
+    dash::internal::local_transform_scan(
+      in.begin(), l_size, out.begin(), partial_t { init, true },
+      partials, compose, to_affine, false);
+    for (int i = 0; i < l_size; ++i) {
+      affine_t expected = (i == 0) ? init : compose(init, inclusive[i - 1]);
+      ASSERT_EQ_U(expected.a, out[i].a);
+      ASSERT_EQ_U(expected.b, out[i].b);
+    }
+  }
+}
+
+TEST_F(ScanTest, BlockCyclicDistribution) {
+  // Units hold several blocks, the last block is underfilled:
+  size_t num_elem_total = _dash_size * 23 + 4;
+
+  dash::Array<long> in(num_elem_total, dash::BLOCKCYCLIC(3));
+  dash::Array<long> out(num_elem_total, dash::BLOCKCYCLIC(3));
+  for (size_t li = 0; li < in.lsize(); ++li) {
+    in.local[li] = in.pattern().global(li) + 1;
+  }
+
+  dash::barrier();
+
+  dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  for (size_t li = 0; li < out.lsize(); ++li) {
+    long g = out.pattern().global(li);
+    ASSERT_EQ_U((g + 1) * (g + 2) / 2, out.local[li]);
+  }
+
+  // Sub-range starting and ending within blocks, in place:
+  dash::exclusive_scan(in.begin() + 4, in.end() - 2, in.begin() + 4, 5L);
+  long g_last = num_elem_total - 2;
+  for (size_t li = 0; li < in.lsize(); ++li) {
+    long g = in.pattern().global(li);
+    if (g < 4 || g >= g_last) {
+      ASSERT_EQ_U(g + 1, in.local[li]);
+    } else {
+      // Sum of values 5 ... g, starting from 5:
+      ASSERT_EQ_U(g * (g + 1) / 2 - 10 + 5, in.local[li]);
+    }
+  }
+
+  dash::barrier();
+
+  // Operation without DART equivalent, non-commutative:
+  dash::Array<int>      cyc_in(num_elem_total, dash::CYCLIC);
+  dash::Array<affine_t> cyc_out(num_elem_total, dash::CYCLIC);
+  for (size_t li = 0; li < cyc_in.lsize(); ++li) {
+    cyc_in.local[li] = cyc_in.pattern().global(li);
+  }
+
+  dash::barrier();
+
+  auto to_affine = [](int v) {
+                     return affine_t { (v % 3 == 0) ? -1 : 1, v % 7 };
+                   };
+  affine_compose compose;
+
+  std::vector<affine_t> inclusive;
+  affine_t acc = to_affine(0);
+  inclusive.push_back(acc);
+  for (size_t g = 1; g < num_elem_total; ++g) {
+    acc = compose(acc, to_affine(g));
+    inclusive.push_back(acc);
+  }
+
+  dash::transform_inclusive_scan(cyc_in.begin(), cyc_in.end(),
+                                 cyc_out.begin(), compose, to_affine);
+  for (size_t li = 0; li < cyc_out.lsize(); ++li) {
+    auto g = cyc_out.pattern().global(li);
+    affine_t value = cyc_out.local[li];
+    ASSERT_EQ_U(inclusive[g].a, value.a);
+    ASSERT_EQ_U(inclusive[g].b, value.b);
+  }
+}
+
+TEST_F(ScanTest, MismatchedOutputDistribution) {
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  size_t block_size     = 10;
+  size_t num_elem_total = _dash_size * block_size;
+
+  dash::Array<long> in(num_elem_total, dash::BLOCKED);
+  dash::Array<long> out(num_elem_total, dash::BLOCKED);
+
+  dash::barrier();
+
+  // Only the first units hold elements of the input and the shifted
+  // output range, all units throw:
+  EXPECT_THROW(
+    dash::inclusive_scan(in.begin(), in.begin() + 2 * block_size,
+                         out.begin() + 1),
+    dash::exception::NotImplemented);
+
+  dash::barrier();
+}
@@ -0,0 +1,112 @@
+
+#include <gtest/gtest.h>
+
+#include "SortTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Copy.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+template <class ArrayType, class Compare>
+static void verify_sorted(
+  ArrayType                                      & array,
+  std::vector<typename ArrayType::value_type>      expected,
+  typename ArrayType::size_type                    offset,
+  Compare                                          comp)
+{
+  typedef typename ArrayType::value_type value_t;
+  std::sort(expected.begin(), expected.end(), comp);
+  std::vector<value_t> sorted(array.size());
+  dash::copy(array.begin(), array.end(), sorted.data());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ_U(expected[i], sorted[offset + i]);
+  }
+}
+
+TEST_F(SortTest, RandomIntegral) {
+  typedef long value_t;
+  // Size not divisible by number of units:
+  size_t num_elem_total = _dash_size * 1000 + 17;
+
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+
+  std::mt19937 rng(_dash_id + 1);
+  std::uniform_int_distribution<value_t> dist(-100000, 100000);
+  for (auto & value : array.local) {
+    value = dist(rng);
+  }
+  array.barrier();
+
+  std::vector<value_t> values(num_elem_total);
+  dash::copy(array.begin(), array.end(), values.data());
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  verify_sorted(array, values, 0, std::less<value_t>());
+}
+
+TEST_F(SortTest, DuplicatesCompare) {
+  typedef double value_t;
+  size_t num_elem_total = _dash_size * 500;
+
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+
+  // Few distinct values, skewed towards unit 0:
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<value_t>((li * 7 + _dash_id) % 5);
+  }
+  array.barrier();
+
+  std::vector<value_t> values(num_elem_total);
+  dash::copy(array.begin(), array.end(), values.data());
+  array.barrier();
+
+  dash::sort(array.begin(), array.end(), std::greater<value_t>());
+
+  verify_sorted(array, values, 0, std::greater<value_t>());
+}
+
+TEST_F(SortTest, SubRange) {
+  typedef int value_t;
+  size_t num_elem_total = _dash_size * 100;
+  size_t offset         = 13;
+  size_t range_size     = num_elem_total - offset - 29;
+
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<value_t>(
+                        num_elem_total - array.pattern().global(li));
+  }
+  array.barrier();
+
+  std::vector<value_t> values(num_elem_total);
+  dash::copy(array.begin(), array.end(), values.data());
+  array.barrier();
+
+  dash::sort(array.begin() + offset, array.begin() + offset + range_size);
+
+  // Elements outside of the range are unchanged:
+  std::vector<value_t> sorted(num_elem_total);
+  dash::copy(array.begin(), array.end(), sorted.data());
+  for (size_t i = 0; i < offset; ++i) {
+    EXPECT_EQ_U(values[i], sorted[i]);
+  }
+  for (size_t i = offset + range_size; i < num_elem_total; ++i) {
+    EXPECT_EQ_U(values[i], sorted[i]);
+  }
+  verify_sorted(
+    array,
+    std::vector<value_t>(values.begin() + offset,
+                         values.begin() + offset + range_size),
+    offset,
+    std::less<value_t>());
+}
@@ -543,3 +543,129 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, FindAfterRehash)
+{
+  typedef long                                          key_t;
+  typedef long                                          mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits            = dash::size();
+  // Use small local buffer size to enforce reallocation:
+  size_type local_buffer_size = 4;
+  // Number of elements inserted per unit and commit, exceeds initial
+  // capacity of bucket tables:
+  size_type local_elements    = 100;
+  size_type num_commits       = 3;
+
+  map_t map(0, local_buffer_size);
+
+  // Number of elements inserted by the given unit up to the given commit:
+  auto nelem = [&](int unit, int commit) {
+                 return (commit + 1) * local_elements;
+               };
+  auto key_at = [&](int unit, int li) {
+                  return static_cast<key_t>(li * nunits + unit);
+                };
+
+  for (int c = 0; c < num_commits; ++c) {
+    for (int li = nelem(dash::myid().id, c - 1);
+         li < nelem(dash::myid().id, c); ++li) {
+      key_t key = key_at(dash::myid().id, li);
+      auto insertion = map.local.insert(map_value({ key, 2 * key }));
+      EXPECT_TRUE_U(insertion.second);
+      EXPECT_EQ_U(1, map.local.count(key));
+    }
+    map.barrier();
+
+    EXPECT_EQ_U(nelem(dash::myid().id, c), map.lsize());
+
+    // Look up elements of all units:
+    for (int unit = 0; unit < nunits; ++unit) {
+      for (int li = 0; li < nelem(unit, c); ++li) {
+        key_t key   = key_at(unit, li);
+        auto  found = map.find(key);
+        EXPECT_NE_U(map.end(), found);
+        map_value found_value = *found;
+        EXPECT_EQ_U(key,     found_value.first);
+        EXPECT_EQ_U(2 * key, found_value.second);
+        EXPECT_EQ_U(unit, found.lpos().unit);
+        EXPECT_EQ_U(li,   found.lpos().index);
+      }
+      // Keys not contained in map:
+      key_t missing = key_at(unit, nelem(unit, c));
+      EXPECT_EQ_U(map.end(), map.find(missing));
+      EXPECT_EQ_U(0,         map.count(missing));
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkInsertFind)
+{
+  typedef long                                          key_t;
+  typedef double                                        mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::size_type                     size_type;
+
+  auto      myid              = dash::myid().id;
+  size_type nunits            = dash::size();
+  // Use small local buffer size to enforce reallocation:
+  size_type local_buffer_size = 5;
+  size_type local_elements    = 40;
+
+  map_t map(0, local_buffer_size);
+
+  // Each unit inserts its own keys in two batches, the second batch
+  // contains the keys of the first batch and every key twice:
+  auto key_at = [&](int unit, int li) {
+                  return static_cast<key_t>(unit * 1000 + li);
+                };
+  std::vector<map_value> batch;
+  for (size_type li = 0; li < local_elements / 2; ++li) {
+    batch.push_back(map_value(key_at(myid, li), myid + 0.1 * li));
+  }
+  EXPECT_EQ_U(local_elements / 2,
+              map.insert_many(batch.begin(), batch.end()));
+  batch.clear();
+  for (size_type li = 0; li < local_elements; ++li) {
+    batch.push_back(map_value(key_at(myid, li), myid + 0.1 * li));
+    batch.push_back(map_value(key_at(myid, li), -1.0));
+  }
+  EXPECT_EQ_U(local_elements - local_elements / 2,
+              map.insert_many(batch.begin(), batch.end()));
+  EXPECT_EQ_U(local_elements, map.lsize());
+  map.barrier();
+
+  EXPECT_EQ_U(local_elements * nunits, map.size());
+
+  // Keys of all units and a missing key per unit:
+  std::vector<key_t> keys;
+  for (size_type unit = 0; unit < nunits; ++unit) {
+    for (size_type li = 0; li <= local_elements; ++li) {
+      keys.push_back(key_at(unit, li));
+    }
+  }
+  std::vector<map_iterator> found(keys.size());
+  auto found_end = map.find_many(keys.begin(), keys.end(), found.begin());
+  EXPECT_EQ_U(found.end(), found_end);
+
+  for (size_type k = 0; k < keys.size(); ++k) {
+    int       unit = keys[k] / 1000;
+    size_type li   = keys[k] % 1000;
+    EXPECT_EQ_U(map.find(keys[k]), found[k]);
+    if (li == local_elements) {
+      EXPECT_EQ_U(map.end(), found[k]);
+      continue;
+    }
+    EXPECT_NE_U(map.end(), found[k]);
+    map_value value = *found[k];
+    EXPECT_EQ_U(keys[k],           value.first);
+    EXPECT_EQ_U(unit + 0.1 * li,   value.second);
+    EXPECT_EQ_U(unit,              found[k].lpos().unit);
+  }
+}
@@ -3,6 +3,8 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <vector>
+
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
   // we need an even amount of participating units
@@ -50,3 +52,178 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
     ASSERT_EQ(recv, data[partner]);
   }
 }
+
+TEST_F(DARTCollectiveTest, ScanExscan) {
+  int  myid  = static_cast<int>(_dash_id);
+  int  value = myid + 1;
+  int  scan_result;
+  long exscan_values[2] = { 1, static_cast<long>(myid) };
+  long exscan_result[2];
+
+  ASSERT_EQ(DART_OK,
+            dart_scan(&value, &scan_result, 1, DART_TYPE_INT, DART_OP_SUM,
+                      DART_TEAM_ALL));
+  ASSERT_EQ((myid + 1) * (myid + 2) / 2, scan_result);
+
+  ASSERT_EQ(DART_OK,
+            dart_exscan(exscan_values, exscan_result, 2, DART_TYPE_LONG,
+                        DART_OP_MAX, DART_TEAM_ALL));
+  // Result at unit 0 is undefined:
+  if (myid > 0) {
+    ASSERT_EQ(1, exscan_result[0]);
+    ASSERT_EQ(myid - 1, exscan_result[1]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, Alltoall) {
+  const int nunits = static_cast<int>(_dash_size);
+  const int myid   = static_cast<int>(_dash_id);
+  const int nelem  = 3;
+
+  std::vector<int> send(nunits * nelem);
+  std::vector<int> recv(nunits * nelem, -1);
+  for (int u = 0; u < nunits; ++u) {
+    for (int e = 0; e < nelem; ++e) {
+      send[u * nelem + e] = myid * 1000 + u * 10 + e;
+    }
+  }
+
+  ASSERT_EQ(DART_OK,
+            dart_alltoall(send.data(), recv.data(), nelem, DART_TYPE_INT,
+                          DART_TEAM_ALL));
+  for (int u = 0; u < nunits; ++u) {
+    for (int e = 0; e < nelem; ++e) {
+      ASSERT_EQ(u * 1000 + myid * 10 + e, recv[u * nelem + e]);
+    }
+  }
+
+  // In-place:
+  ASSERT_EQ(DART_OK,
+            dart_alltoall(send.data(), send.data(), nelem, DART_TYPE_INT,
+                          DART_TEAM_ALL));
+  ASSERT_EQ(recv, send);
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+  const int nunits = static_cast<int>(_dash_size);
+  const int myid   = static_cast<int>(_dash_id);
+
+  // Unit i sends i + j + 1 values to unit j, in reverse unit order:
+  std::vector<size_t> nsend(nunits), sdispls(nunits);
+  std::vector<size_t> nrecv(nunits), rdispls(nunits);
+  size_t nsend_total = 0, nrecv_total = 0;
+  for (int u = nunits - 1; u >= 0; --u) {
+    nsend[u]     = myid + u + 1;
+    sdispls[u]   = nsend_total;
+    nsend_total += nsend[u];
+  }
+  for (int u = 0; u < nunits; ++u) {
+    nrecv[u]     = myid + u + 1;
+    rdispls[u]   = nrecv_total;
+    nrecv_total += nrecv[u];
+  }
+  std::vector<long> send(nsend_total);
+  std::vector<long> recv(nrecv_total, -1);
+  for (int u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nsend[u]; ++e) {
+      send[sdispls[u] + e] = myid * 1000 + u * 100 + e;
+    }
+  }
+
+  ASSERT_EQ(DART_OK,
+            dart_alltoallv(send.data(), nsend.data(), sdispls.data(),
+                           DART_TYPE_LONG,
+                           recv.data(), nrecv.data(), rdispls.data(),
+                           DART_TEAM_ALL));
+  for (int u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nrecv[u]; ++e) {
+      ASSERT_EQ(u * 1000 + myid * 100 + static_cast<long>(e),
+                recv[rdispls[u] + e]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, AlltoallvEmptySend) {
+  const int nunits = static_cast<int>(_dash_size);
+  const int myid   = static_cast<int>(_dash_id);
+
+  // Only unit 0 sends a single value to every unit, all other units pass
+  // an empty send buffer:
+  std::vector<size_t> nsend(nunits, (myid == 0) ? 1 : 0);
+  std::vector<size_t> sdispls(nunits);
+  std::vector<size_t> nrecv(nunits, 0);
+  std::vector<size_t> rdispls(nunits, 0);
+  nrecv[0] = 1;
+  std::vector<int> send;
+  if (myid == 0) {
+    for (int u = 0; u < nunits; ++u) {
+      sdispls[u] = u;
+      send.push_back(100 + u);
+    }
+  }
+  std::vector<int> recv(1, -1);
+
+  ASSERT_EQ(DART_OK,
+            dart_alltoallv(send.data(), nsend.data(), sdispls.data(),
+                           DART_TYPE_INT,
+                           recv.data(), nrecv.data(), rdispls.data(),
+                           DART_TEAM_ALL));
+  ASSERT_EQ(100 + myid, recv[0]);
+}
+
+TEST_F(DARTCollectiveTest, NonBlockingCollectives) {
+  const int nunits = static_cast<int>(_dash_size);
+  const int myid   = static_cast<int>(_dash_id);
+
+  // Global memory of one value per unit for a mixed wait on one-sided
+  // and collective handles:
+  dart_gptr_t gptr;
+  ASSERT_EQ(DART_OK,
+            dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT,
+                                       &gptr));
+  int * lptr;
+  dart_gptr_t lgptr = gptr;
+  lgptr.unitid = myid;
+  ASSERT_EQ(DART_OK, dart_gptr_getaddr(lgptr, (void**)&lptr));
+  *lptr = myid;
+  ASSERT_EQ(DART_OK, dart_barrier(DART_TEAM_ALL));
+
+  dart_handle_t handles[5];
+  int  bcast_value  = (myid == 0) ? 42 : -1;
+  long sum_value    = myid + 1;
+  long sum_result   = 0;
+  std::vector<int> gathered(nunits, -1);
+  int  remote_value = -1;
+
+  ASSERT_EQ(DART_OK, dart_ibarrier(DART_TEAM_ALL, &handles[0]));
+  ASSERT_EQ(DART_OK,
+            dart_ibcast(&bcast_value, 1, DART_TYPE_INT,
+                        dart_team_unit_t{0}, DART_TEAM_ALL, &handles[1]));
+  ASSERT_EQ(DART_OK,
+            dart_iallreduce(&sum_value, &sum_result, 1, DART_TYPE_LONG,
+                            DART_OP_SUM, DART_TEAM_ALL, &handles[2]));
+  ASSERT_EQ(DART_OK,
+            dart_iallgather(&myid, gathered.data(), 1, DART_TYPE_INT,
+                            DART_TEAM_ALL, &handles[3]));
+  dart_gptr_t rgptr = gptr;
+  rgptr.unitid = (myid + 1) % nunits;
+  ASSERT_EQ(DART_OK,
+            dart_get_handle(&remote_value, rgptr, 1, DART_TYPE_INT,
+                            DART_TYPE_INT, &handles[4]));
+
+  // Barrier handle completes individually:
+  ASSERT_EQ(DART_OK, dart_wait(&handles[0]));
+  ASSERT_EQ(DART_HANDLE_NULL, handles[0]);
+  // Remaining collective and one-sided handles in a single wait:
+  ASSERT_EQ(DART_OK, dart_waitall(handles, 5));
+
+  ASSERT_EQ(42, bcast_value);
+  ASSERT_EQ(static_cast<long>(nunits) * (nunits + 1) / 2, sum_result);
+  for (int u = 0; u < nunits; ++u) {
+    ASSERT_EQ(u, gathered[u]);
+  }
+  ASSERT_EQ((myid + 1) % nunits, remote_value);
+
+  ASSERT_EQ(DART_OK, dart_barrier(DART_TEAM_ALL));
+  ASSERT_EQ(DART_OK, dart_team_memfree(gptr));
+}
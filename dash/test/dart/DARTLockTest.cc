@@ -1,8 +1,15 @@
 #include "DARTLockTest.h"
 
 #include <dash/Shared.h>
+#include <dash/Mutex.h>
+#include <dash/util/Timer.h>
 #include <dash/dart/if/dart.h>
 
+#include <cstdlib>
+#include <mutex>
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
 
 TEST_F(DARTLockTest, LockUnlockDoNothing) {
   using value_t = int;
@@ -234,3 +241,322 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, CohortLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 100;
+  dash::Shared<value_t> shared;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  // without a limit, all units on a node form a single cohort,
+  // cohorts of two units also pass the global lock between cohorts
+  for (const char * cohort_size : { "", "2" }) {
+    if (*cohort_size != '\0') {
+      setenv("DART_LOCK_COHORT_SIZE", cohort_size, 1);
+    }
+    dart_lock_t lock;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_cohort_lock_init(DART_TEAM_ALL, &lock));
+    unsetenv("DART_LOCK_COHORT_SIZE");
+
+    dash::barrier();
+    for (int i = 0; i < num_iterations; ++i) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_acquire(lock));
+      shared.set(shared.get() + 1);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_release(lock));
+    }
+    dash::barrier();
+
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_lock_destroy(&lock));
+  }
+
+  ASSERT_EQ_U(2 * num_iterations * dash::size(),
+              static_cast<value_t>(shared.get()));
+}
+
+TEST_F(DARTLockTest, CohortTryLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  setenv("DART_LOCK_COHORT_SIZE", "2", 1);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_cohort_lock_init(DART_TEAM_ALL, &lock));
+  unsetenv("DART_LOCK_COHORT_SIZE");
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    int32_t acquired;
+    do {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_try_acquire(lock, &acquired));
+    } while (!acquired);
+    shared.set(shared.get() + 1);
+    dart_lock_release(lock);
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(), static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, MutexPolicyContention) {
+  using value_t = int;
+  constexpr int num_iterations = 200;
+  dash::Shared<value_t> shared;
+
+  for (auto policy : { dash::mutex_policy::queue,
+                       dash::mutex_policy::cohort }) {
+    if (dash::myid() == 0) {
+      shared.set(0);
+    }
+    dash::Mutex mx(dash::Team::All(), policy);
+
+    dash::barrier();
+    auto ts_start = Timer::Now();
+    for (int i = 0; i < num_iterations; ++i) {
+      std::lock_guard<dash::Mutex> lg(mx);
+      shared.set(shared.get() + 1);
+    }
+    dash::barrier();
+    double elapsed_us = Timer::ElapsedSince(ts_start);
+
+    ASSERT_EQ_U(num_iterations * dash::size(),
+                static_cast<value_t>(shared.get()));
+    LOG_MESSAGE("%s lock: %d acquisitions per unit in %.1f us",
+                (policy == dash::mutex_policy::cohort) ? "cohort" : "queue",
+                num_iterations, elapsed_us);
+  }
+}
+
+TEST_F(DARTLockTest, TryLockFor) {
+  dart_lock_t lock;
+  int32_t     acquired;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init(DART_TEAM_ALL, &lock));
+
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+  }
+  dash::barrier();
+  if (dash::myid() == 1) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_try_acquire_for(lock, 1000, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+  if (dash::myid() == 1) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_try_acquire_for(lock, 1000000, &acquired));
+    ASSERT_EQ_U(1, acquired);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, RWLockReadWrite) {
+  constexpr int num_iterations = 100;
+  // value and copy of the value are only consistent for readers if
+  // no writer modifies them concurrently
+  dash::Shared<int> value;
+  dash::Shared<int> check;
+  dart_rwlock_t     lock;
+  int               num_inconsistent = 0;
+
+  if (dash::myid() == 0) {
+    value.set(0);
+    check.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    if (i % 5 == 0) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_acquire(lock));
+      int v = value.get();
+      value.set(v + 1);
+      check.set(v + 1);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_release(lock));
+    } else {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_acquire_shared(lock));
+      if (value.get() != check.get()) {
+        ++num_inconsistent;
+      }
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_release_shared(lock));
+    }
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(0, num_inconsistent);
+  ASSERT_EQ_U((num_iterations / 5) * dash::size(),
+              static_cast<int>(value.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, RWLockReleaseNotAcquired) {
+  dart_rwlock_t lock;
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_rwlock_release(lock));
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_rwlock_release_shared(lock));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_acquire_shared(lock));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_release_shared(lock));
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_rwlock_release_shared(lock));
+  dash::barrier();
+
+  // other units cannot release the lock held by unit 0
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_acquire(lock));
+  }
+  dash::barrier();
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(
+      DART_ERR_INVAL,
+      dart_rwlock_release(lock));
+    int32_t acquired;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, RWLockTryAcquireFor) {
+  dart_rwlock_t lock;
+  int32_t       acquired;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  // all units read concurrently while no writer can enter
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_try_acquire_shared_for(lock, 1000000, &acquired));
+  ASSERT_EQ_U(1, acquired);
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire_for(lock, 1000, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_release_shared(lock));
+  dash::barrier();
+
+  // readers time out while a writer holds the lock
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire(lock, &acquired));
+    ASSERT_EQ_U(1, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire_shared_for(lock, 1000, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
@@ -169,3 +169,210 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+TEST_F(DARTMemAllocTest, SymmetricHeap)
+{
+  const size_t block_size = 10;
+  dart_team_t team;
+  ASSERT_EQ_U(DART_OK, dart_team_clone(DART_TEAM_ALL, &team));
+  ASSERT_EQ_U(DART_OK, dart_team_memheap_reserve(team, 1024));
+  // a team can only have a single heap
+  ASSERT_EQ_U(DART_ERR_INVAL, dart_team_memheap_reserve(team, 1024));
+
+  dart_team_unit_t myid;
+  size_t           team_size;
+  dart_team_myid(team, &myid);
+  dart_team_size(team, &team_size);
+
+  dart_gptr_t gptr1, gptr2;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(team, block_size, DART_TYPE_INT, &gptr1));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(team, block_size, DART_TYPE_INT, &gptr2));
+  ASSERT_NE_U(gptr1.segid, gptr2.segid);
+  ASSERT_EQ_U(0, gptr1.addr_or_offs.offset);
+  ASSERT_EQ_U(0, gptr2.addr_or_offs.offset);
+
+  // consecutive allocations are carved out of the heap
+  int *lptr1, *lptr2;
+  gptr1.unitid = myid.id;
+  gptr2.unitid = myid.id;
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr1, (void**)&lptr1));
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr2, (void**)&lptr2));
+  ASSERT_GT_U(lptr2, lptr1);
+  ASSERT_LT_U((char*)lptr2 - (char*)lptr1, 1024);
+
+  for (size_t i = 0; i < block_size; ++i) {
+    lptr1[i] = myid.id * 100 + i;
+    lptr2[i] = -1;
+  }
+  dart_barrier(team);
+
+  // copy the first allocation of the neighbor into the second one
+  dart_team_unit_t neighbor = DART_TEAM_UNIT_ID((myid.id + 1) % team_size);
+  int buf[block_size];
+  gptr1.unitid = neighbor.id;
+  gptr2.unitid = neighbor.id;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(buf, gptr1, block_size, DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_blocking(gptr2, buf, block_size, DART_TYPE_INT, DART_TYPE_INT));
+  dart_barrier(team);
+  for (size_t i = 0; i < block_size; ++i) {
+    ASSERT_EQ_U(lptr1[i], lptr2[i]);
+  }
+
+  // freed heap memory is re-used
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr1));
+  dart_gptr_t gptr3;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(team, block_size, DART_TYPE_INT, &gptr3));
+  int *lptr3;
+  gptr3.unitid = myid.id;
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr3, (void**)&lptr3));
+  ASSERT_EQ_U(lptr1, lptr3);
+
+  // allocations exceeding the heap fall back to a window of their own
+  dart_gptr_t gptr4;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(team, 1024, DART_TYPE_INT, &gptr4));
+  int *lptr4;
+  gptr4.unitid = myid.id;
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr4, (void**)&lptr4));
+  lptr4[1023] = myid.id;
+  dart_barrier(team);
+  int val;
+  gptr4.unitid = neighbor.id;
+  gptr4.addr_or_offs.offset = 1023 * sizeof(int);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(&val, gptr4, 1, DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(neighbor.id, val);
+  dart_barrier(team);
+
+  // allocations of different sizes fail on all units
+  if (team_size > 1) {
+    dart_gptr_t gptr5;
+    ASSERT_EQ_U(
+      DART_ERR_INVAL,
+      dart_team_memalloc_aligned(
+        team, block_size + (myid.id % 2), DART_TYPE_INT, &gptr5));
+  }
+
+  // tear-down
+  gptr4.addr_or_offs.offset = 0;
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr4));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr3));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr2));
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocThreadCache)
+{
+  dart_memalloc_stats_t stats_before, stats_after;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_before));
+
+  dart_gptr_t gptr1, gptr2;
+  ASSERT_EQ_U(DART_OK, dart_memalloc(5, DART_TYPE_INT, &gptr1));
+  ASSERT_EQ_U(DART_OK, dart_memfree(gptr1));
+  // allocation of the same size class re-uses the freed allocation
+  ASSERT_EQ_U(DART_OK, dart_memalloc(8, DART_TYPE_INT, &gptr2));
+  ASSERT_EQ_U(gptr1, gptr2);
+
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_after));
+  EXPECT_EQ_U(stats_before.num_alloc + 2,      stats_after.num_alloc);
+  EXPECT_EQ_U(stats_before.num_free  + 1,      stats_after.num_free);
+  EXPECT_EQ_U(stats_before.num_cache_hits + 1, stats_after.num_cache_hits);
+  EXPECT_LE_U(stats_after.used, stats_after.size);
+
+  ASSERT_EQ_U(DART_OK, dart_memfree(gptr2));
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocPoolExtension)
+{
+  dart_memalloc_stats_t stats;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  const size_t num_blocks = stats.num_blocks;
+  // allocations of the size of the initial block of the pool
+  const size_t nbytes     = stats.size / stats.num_blocks;
+  const int    num_allocs = 3;
+
+  dart_gptr_t gptrs[num_allocs];
+  for (int i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(nbytes, DART_TYPE_BYTE, &gptrs[i]));
+    char *lptr;
+    ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptrs[i], (void**)&lptr));
+    lptr[0]          = static_cast<char>(dash::myid().id + i);
+    lptr[nbytes - 1] = static_cast<char>(dash::myid().id - i);
+  }
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  EXPECT_GE_U(stats.num_blocks, num_blocks + num_allocs - 1);
+
+  // extension blocks are accessible by other units
+  dash::Array<dart_gptr_t> arr(dash::size() * num_allocs);
+  for (int i = 0; i < num_allocs; ++i) {
+    arr.local[i] = gptrs[i];
+  }
+  arr.barrier();
+  int neighbor = (dash::myid().id + 1) % dash::size();
+  for (int i = 0; i < num_allocs; ++i) {
+    dart_gptr_t gptr = arr[neighbor * num_allocs + i];
+    char first, last;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(&first, gptr, 1, DART_TYPE_BYTE, DART_TYPE_BYTE));
+    gptr.addr_or_offs.offset += nbytes - 1;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(&last, gptr, 1, DART_TYPE_BYTE, DART_TYPE_BYTE));
+    EXPECT_EQ_U(static_cast<char>(neighbor + i), first);
+    EXPECT_EQ_U(static_cast<char>(neighbor - i), last);
+  }
+  arr.barrier();
+
+  for (int i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocMaxBlockSize)
+{
+  dart_memalloc_stats_t stats_before, stats_after;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_before));
+
+  // allocations exceeding the maximum block size of 2 GiB fail instead of
+  // extending the pool
+  dart_gptr_t gptr;
+  EXPECT_NE_U(
+    DART_OK,
+    dart_memalloc((size_t(1) << 31) + 1, DART_TYPE_BYTE, &gptr));
+  EXPECT_NE_U(
+    DART_OK,
+    dart_memalloc(size_t(1) << 33, DART_TYPE_BYTE, &gptr));
+
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_after));
+  EXPECT_EQ_U(stats_before.num_blocks, stats_after.num_blocks);
+  EXPECT_EQ_U(stats_before.used,       stats_after.used);
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocDoubleFree)
+{
+  dart_gptr_t gptr;
+  // cached size class
+  ASSERT_EQ_U(DART_OK, dart_memalloc(4, DART_TYPE_INT, &gptr));
+  ASSERT_EQ_U(DART_OK,       dart_memfree(gptr));
+  EXPECT_EQ_U(DART_ERR_INVAL, dart_memfree(gptr));
+  // re-allocation from the thread cache can be freed again
+  dart_gptr_t gptr2;
+  ASSERT_EQ_U(DART_OK, dart_memalloc(4, DART_TYPE_INT, &gptr2));
+  ASSERT_EQ_U(gptr, gptr2);
+  EXPECT_EQ_U(DART_OK, dart_memfree(gptr2));
+}
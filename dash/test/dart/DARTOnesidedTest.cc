@@ -4,6 +4,9 @@
 #include <dash/Array.h>
 #include <dash/Onesided.h>
 
+#include <vector>
+#include <algorithm>
+
 
 TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
 {
@@ -147,6 +150,114 @@ TEST_F(DARTOnesidedTest, GetHandleAllRemote)
   ASSERT_EQ_U(num_elem_copy, l);
 }
 
+TEST_F(DARTOnesidedTest, PutHandleWaitallMany)
+{
+  typedef int value_t;
+  // exceeds the number of handles allocated at once by the handle pool
+  const size_t num_elem = 1000;
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  std::vector<value_t> buf(num_elem, -1);
+  std::vector<value_t> values(num_elem);
+  std::vector<dart_handle_t> handles(num_elem);
+  // registered memory is not accessed through shared memory windows
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister(
+      DART_TEAM_ALL, num_elem, DART_TYPE_INT, buf.data(), &gptr));
+
+  dart_gptr_t dst = gptr;
+  dst.unitid      = (dash::myid() + 1) % dash::size();
+  for (int rep = 0; rep < 2; ++rep) {
+    for (size_t i = 0; i < num_elem; ++i) {
+      values[i]     = (rep * 100000) + (dash::myid() * 1000) + i;
+      dart_gptr_t g = dst;
+      dart_gptr_incaddr(&g, i * sizeof(value_t));
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_put_handle(
+          g, &values[i], 1, DART_TYPE_INT, DART_TYPE_INT, &handles[i]));
+    }
+    ASSERT_EQ_U(DART_OK, dart_waitall(handles.data(), handles.size()));
+    for (size_t i = 0; i < num_elem; ++i) {
+      ASSERT_EQ_U(DART_HANDLE_NULL, handles[i]);
+    }
+    dash::barrier();
+
+    int left = (dash::myid() + dash::size() - 1) % dash::size();
+    for (size_t i = 0; i < num_elem; ++i) {
+      ASSERT_EQ_U((rep * 100000) + (left * 1000) + i, buf[i]);
+    }
+    dash::barrier();
+  }
+  ASSERT_EQ_U(DART_OK, dart_team_memderegister(gptr));
+}
+
+TEST_F(DARTOnesidedTest, HandleGroupPutGet)
+{
+  typedef int value_t;
+  // operations do not fit into a single group
+  const size_t num_elem = 3 * DART_HANDLE_GROUP_MAX_REQS;
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  std::vector<value_t> buf(num_elem, -1);
+  std::vector<value_t> values(num_elem);
+  std::vector<value_t> result(num_elem, -1);
+  // registered memory is not accessed through shared memory windows
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memregister(
+      DART_TEAM_ALL, num_elem, DART_TYPE_INT, buf.data(), &gptr));
+
+  dart_handle_group_t group;
+  ASSERT_EQ_U(DART_OK, dart_handle_group_init(&group));
+
+  dart_gptr_t dst = gptr;
+  dst.unitid      = (dash::myid() + 1) % dash::size();
+  for (size_t i = 0; i < num_elem; ++i) {
+    values[i]     = (dash::myid() * 1000) + i;
+    dart_gptr_t g = dst;
+    dart_gptr_incaddr(&g, i * sizeof(value_t));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_handle_group_put(
+        g, &values[i], 1, DART_TYPE_INT, DART_TYPE_INT, &group));
+  }
+  ASSERT_EQ_U(DART_OK, dart_handle_group_wait(&group));
+  ASSERT_EQ_U(0, group.num_reqs);
+  ASSERT_EQ_U(0, group.num_wins);
+  dash::barrier();
+
+  int left = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t i = 0; i < num_elem; ++i) {
+    ASSERT_EQ_U((left * 1000) + i, buf[i]);
+  }
+
+  // read back the values written to the right neighbor
+  for (size_t i = 0; i < num_elem; ++i) {
+    dart_gptr_t g = dst;
+    dart_gptr_incaddr(&g, i * sizeof(value_t));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_handle_group_get(
+        &result[i], g, 1, DART_TYPE_INT, DART_TYPE_INT, &group));
+  }
+  int32_t finished = 0;
+  while (!finished) {
+    ASSERT_EQ_U(DART_OK, dart_handle_group_test(&group, &finished));
+  }
+  ASSERT_EQ_U(0, group.num_reqs);
+  for (size_t i = 0; i < num_elem; ++i) {
+    ASSERT_EQ_U(values[i], result[i]);
+  }
+  dash::barrier();
+  ASSERT_EQ_U(DART_OK, dart_team_memderegister(gptr));
+}
+
 
 TEST_F(DARTOnesidedTest, StridedGetSimple) {
   constexpr size_t num_elem_per_unit = 120;
@@ -213,6 +324,58 @@ TEST_F(DARTOnesidedTest, StridedGetSimple) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedTypeCache) {
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr int    stride            = 3;
+  constexpr int    num_repeats       = 10;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = i;
+  }
+
+  dash::barrier();
+  std::vector<int> buf(num_elem_per_unit / stride);
+
+  gptr.unitid = (dash::myid() + 1) % dash::size();
+
+  size_t hits_before, misses_before;
+  ASSERT_EQ_U(DART_OK, dart_type_cache_stats(&hits_before, &misses_before));
+
+  for (int r = 0; r < num_repeats; ++r) {
+    // every repetition creates a new DART type with identical layout
+    dart_datatype_t new_type;
+    dart_type_create_strided(DART_TYPE_INT, stride, 1, &new_type);
+    std::fill(buf.begin(), buf.end(), 0);
+    dart_get_blocking(buf.data(), gptr, buf.size(),
+                      new_type, DART_TYPE_INT);
+    for (int i = 0; i < buf.size(); ++i) {
+      ASSERT_EQ_U(i*stride, buf[i]);
+    }
+    dart_type_destroy(&new_type);
+  }
+
+  size_t hits_after, misses_after;
+  ASSERT_EQ_U(DART_OK, dart_type_cache_stats(&hits_after, &misses_after));
+  LOG_MESSAGE("Type cache hits: %zu, misses: %zu",
+              hits_after - hits_before, misses_after - misses_before);
+  // only the first transfer may create the MPI type
+  EXPECT_LE_U(misses_after - misses_before, 1);
+  EXPECT_GE_U(hits_after - hits_before, num_repeats - 1);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+}
+
+
 TEST_F(DARTOnesidedTest, StridedPutSimple) {
   constexpr size_t num_elem_per_unit = 120;
   constexpr size_t max_stride_size   = 5;
@@ -4,6 +4,7 @@
 #include <dash/Matrix.h>
 #include <dash/Algorithm.h>
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/TemporalBlocking.h>
 
 #include <iostream>
 
@@ -1286,3 +1287,249 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMultiStencil)
 
   dash::Team::All().barrier();
 }
+
+TEST_F(HaloTest, HaloMatrixWrapperPush3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using PatternCol_t = dash::Pattern<3, dash::COL_MAJOR>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using MatrixCol_t = dash::Matrix<long, 3, index_type, PatternCol_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 26>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+  PatternCol_t pattern_col(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_halo(pattern);
+  MatrixCol_t matrix_halo_col(pattern_col);
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1,-1,-1), StencilP_t(-1,-1, 0), StencilP_t(-1,-1, 1),
+      StencilP_t(-1, 0,-1), StencilP_t(-1, 0, 0), StencilP_t(-1, 0, 1),
+      StencilP_t(-1, 1,-1), StencilP_t(-1, 1, 0), StencilP_t(-1, 1, 1),
+      StencilP_t( 0,-1,-1), StencilP_t( 0,-1, 0), StencilP_t( 0,-1, 1),
+      StencilP_t( 0, 0,-1),                     StencilP_t( 0, 0, 1),
+      StencilP_t( 0, 1,-1), StencilP_t( 0, 1, 0), StencilP_t( 0, 1, 1),
+      StencilP_t( 1,-1,-1), StencilP_t( 1,-1, 0), StencilP_t( 1,-1, 1),
+      StencilP_t( 1, 0,-1), StencilP_t( 1, 0, 0), StencilP_t( 1, 0, 1),
+      StencilP_t( 1, 1,-1), StencilP_t( 1, 1, 0), StencilP_t( 1, 1, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::NONE, BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_pull(matrix_halo, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_push(
+    matrix_halo, HaloExchange::PUSH, bound_spec, stencil_spec);
+  HaloMatrixWrapper<MatrixCol_t> halo_wrapper_col_pull(matrix_halo_col, bound_spec, stencil_spec);
+  HaloMatrixWrapper<MatrixCol_t> halo_wrapper_col_push(
+    matrix_halo_col, HaloExchange::PUSH, bound_spec, stencil_spec);
+  EXPECT_EQ(HaloExchange::PULL, halo_wrapper_pull.exchange());
+  EXPECT_EQ(HaloExchange::PUSH, halo_wrapper_push.exchange());
+
+  // the plan is replayed by every update, values change between updates
+  for(auto step = 0; step < 3; ++step) {
+    for(auto i = 0; i < matrix_halo.local.size(); ++i) {
+      auto value = (matrix_halo.pattern().global(i) + 1) * (step + 1);
+      matrix_halo.lbegin()[i]     = value;
+      matrix_halo_col.lbegin()[i] = value;
+    }
+    dash::Team::All().barrier();
+
+    halo_wrapper_pull.update();
+    halo_wrapper_col_pull.update();
+    if(step % 2 == 0) {
+      halo_wrapper_push.update();
+      halo_wrapper_col_push.update();
+    } else {
+      halo_wrapper_push.update_async();
+      halo_wrapper_col_push.update_async();
+      halo_wrapper_push.wait();
+      halo_wrapper_col_push.wait();
+    }
+
+    EXPECT_TRUE(halo_wrapper_pull.halo_memory().buffer()
+                == halo_wrapper_push.halo_memory().buffer());
+    EXPECT_TRUE(halo_wrapper_col_pull.halo_memory().buffer()
+                == halo_wrapper_col_push.halo_memory().buffer());
+    dash::Team::All().barrier();
+  }
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperPushAsymmetric)
+{
+  using Pattern_t = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using Matrix_t = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 1>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::NONE);
+  TeamSpec_t team_spec(dash::size(), 1);
+  Pattern_t pattern(SizeSpec_t(ext_per_dim * dash::size(), ext_per_dim),
+                    dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_halo(pattern);
+  for(auto i = 0; i < matrix_halo.local.size(); ++i) {
+    matrix_halo.lbegin()[i] = matrix_halo.pattern().global(i) + 1;
+  }
+  dash::Team::All().barrier();
+
+  // one-sided stencil: the first unit receives no halo but sends to its
+  // southern neighbor
+  StencilSpec_t stencil_spec(StencilP_t(-1, 0));
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::NONE);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_pull(matrix_halo, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_push(
+    matrix_halo, HaloExchange::PUSH, bound_spec, stencil_spec);
+
+  halo_wrapper_pull.update();
+  halo_wrapper_push.update();
+
+  EXPECT_TRUE(halo_wrapper_pull.halo_memory().buffer()
+              == halo_wrapper_push.halo_memory().buffer());
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, StencilOperatorApply)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 6>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_halo(pattern);
+  for(auto i = 0; i < matrix_halo.local.size(); ++i) {
+    matrix_halo.lbegin()[i] = matrix_halo.pattern().global(i);
+  }
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1, 0, 0), StencilP_t( 1, 0, 0),
+      StencilP_t( 0,-1, 0), StencilP_t( 0, 1, 0),
+      StencilP_t( 0, 0,-1), StencilP_t( 0, 0, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC, BoundaryProp::NONE);
+
+  auto kernel = [](const long& center, const std::array<long, 6>& values) {
+    long sum = 6 * center;
+    for(auto i = 0; i < 6; ++i)
+      sum -= (i + 1) * values[i];
+    return sum;
+  };
+
+  for(auto exchange : { HaloExchange::PULL, HaloExchange::PUSH }) {
+    HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix_halo, exchange, bound_spec, stencil_spec);
+    auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+
+    std::vector<long> out(matrix_halo.local.size(), -1);
+    stencil_op.apply(kernel, out.data());
+
+    std::vector<long> out_check(matrix_halo.local.size(), -1);
+    halo_wrapper.update();
+    std::array<long, 6> values;
+    auto it_iend = stencil_op.inner.end();
+    for(auto it = stencil_op.inner.begin(); it != it_iend; ++it) {
+      for(auto i = 0; i < 6; ++i)
+        values[i] = it.value_at(i);
+      out_check[it.lpos()] = kernel(*it, values);
+    }
+    auto it_bend = stencil_op.boundary.end();
+    for(auto it = stencil_op.boundary.begin(); it != it_bend; ++it) {
+      for(auto i = 0; i < 6; ++i)
+        values[i] = it.value_at(i);
+      out_check[it.lpos()] = kernel(*it, values);
+    }
+
+    EXPECT_TRUE(out_check == out);
+    EXPECT_TRUE(std::any_of(out.begin(), out.end(),
+                            [](long value) { return value != -1; }));
+    dash::Team::All().barrier();
+  }
+}
+
+TEST_F(HaloTest, TemporalBlocking2D)
+{
+  using Pattern_t = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using Matrix_t = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 4>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_ref(pattern);
+  Matrix_t matrix_pull(pattern);
+  Matrix_t matrix_push(pattern);
+  for(auto i = 0; i < matrix_ref.local.size(); ++i) {
+    auto value = matrix_ref.pattern().global(i) % 97;
+    matrix_ref.lbegin()[i]  = value;
+    matrix_pull.lbegin()[i] = value;
+    matrix_push.lbegin()[i] = value;
+  }
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1, 0), StencilP_t( 1, 0),
+      StencilP_t( 0,-1), StencilP_t( 0, 1));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::NONE);
+
+  auto kernel = [](const long& center, const std::array<long, 4>& values) {
+    return (center + 2 * values[0] + 3 * values[1] + 5 * values[2]
+            + 7 * values[3]) % 1009;
+  };
+
+  const int num_steps = 7;
+
+  // one halo exchange per time step
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix_ref, bound_spec, stencil_spec);
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  for(auto step = 0; step < num_steps; ++step) {
+    std::vector<long> out(matrix_ref.lbegin(), matrix_ref.lend());
+    stencil_op.apply(kernel, out.data());
+    dash::Team::All().barrier();
+    std::copy(out.begin(), out.end(), matrix_ref.lbegin());
+    dash::Team::All().barrier();
+  }
+
+  TemporalBlocking<Matrix_t, StencilSpec_t> blocking_pull(
+    matrix_pull, bound_spec, stencil_spec, 3);
+  TemporalBlocking<Matrix_t, StencilSpec_t> blocking_push(
+    matrix_push, bound_spec, stencil_spec, 4, HaloExchange::PUSH);
+  EXPECT_EQ_U(3, blocking_pull.halo_width());
+  EXPECT_EQ_U(4, blocking_push.halo_width());
+  blocking_pull.run(kernel, num_steps);
+  blocking_push.run(kernel, num_steps);
+
+  EXPECT_TRUE(std::equal(matrix_ref.lbegin(), matrix_ref.lend(),
+                         matrix_pull.lbegin()));
+  EXPECT_TRUE(std::equal(matrix_ref.lbegin(), matrix_ref.lend(),
+                         matrix_push.lbegin()));
+  dash::Team::All().barrier();
+}
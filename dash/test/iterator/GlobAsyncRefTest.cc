@@ -3,6 +3,7 @@
 
 #include <dash/GlobAsyncRef.h>
 #include <dash/Array.h>
+#include <dash/util/CommStats.h>
 
 
 TEST_F(GlobAsyncRefTest, IsLocal) {
@@ -196,3 +197,172 @@ TEST_F(GlobAsyncRefTest, ConstTest)
   ASSERT_EQ_U(0, agref1.get());
 
 }
+
+/**
+ * Non-blocking writes to distributed array combined per target unit.
+ */
+TEST_F(GlobAsyncRefTest, WriteCombiningPush) {
+  int num_elem_per_unit = 20;
+  dash::Array<int> array(dash::size() * num_elem_per_unit);
+  array.barrier();
+  size_t lneighbor = (dash::myid() + dash::size() - 1) % dash::size();
+  size_t rneighbor = (dash::myid() + 1) % dash::size();
+
+  array.async.write_combining();
+  ASSERT_TRUE_U(array.async.is_write_combining());
+
+  bool stats_enabled = dash::util::CommStats::enabled();
+  dash::util::CommStats::enable();
+  dash::util::CommStats stats_begin;
+  // Assign values at left neighbor asynchronously in reverse order:
+  size_t start_idx = lneighbor * num_elem_per_unit;
+  for (auto gi = start_idx + num_elem_per_unit; gi > start_idx; --gi) {
+    array.async[gi - 1] = dash::myid().id;
+  }
+  array.async.flush();
+  dash::util::CommStats stats_end;
+  dash::util::CommStats::enable(stats_enabled);
+  // Writes are combined to a single contiguous transfer:
+  auto stats = stats_end - stats_begin;
+  EXPECT_EQ_U(1u, stats.target(dash::team_unit_t(lneighbor)).put_ops);
+  EXPECT_EQ_U(num_elem_per_unit * sizeof(int),
+              stats.target(dash::team_unit_t(lneighbor)).put_bytes);
+
+  dash::barrier();
+  for (auto li = 0; li < array.lcapacity(); ++li) {
+    ASSERT_EQ_U(rneighbor, array.local[li]);
+  }
+  array.async.write_combining(false);
+  ASSERT_FALSE_U(array.async.is_write_combining());
+}
+
+/**
+ * Repeated non-blocking writes of an element issued in separate batches.
+ */
+TEST_F(GlobAsyncRefTest, WriteCombiningBatchOrder) {
+  int num_writes = 100;
+  dash::Array<int> array(dash::size());
+  array.barrier();
+  size_t lneighbor = (dash::myid() + dash::size() - 1) % dash::size();
+
+  // Every second write issues a batch to the left neighbor:
+  array.async.write_combining(true, 2);
+  for (int i = 0; i < num_writes; ++i) {
+    array.async[lneighbor] = i;
+  }
+  array.async.flush();
+  array.async.write_combining(false);
+
+  dash::barrier();
+  ASSERT_EQ_U(num_writes - 1, array.local[0]);
+}
+
+/**
+ * Repeated non-blocking writes of an element in batches that are only
+ * completed locally in between.
+ */
+TEST_F(GlobAsyncRefTest, WriteCombiningBatchOrderLocalFlush) {
+  int num_writes = 100;
+  dash::Array<int> array(dash::size());
+  array.barrier();
+  size_t lneighbor = (dash::myid() + dash::size() - 1) % dash::size();
+
+  array.async.write_combining(true, 2);
+  for (int i = 0; i < num_writes; ++i) {
+    array.async[lneighbor] = i;
+    if (i % 3 == 0) {
+      // releases send buffers, later batches remain ordered
+      array.async.flush_local();
+    }
+  }
+  array.async.flush();
+  array.async.write_combining(false);
+
+  dash::barrier();
+  ASSERT_EQ_U(num_writes - 1, array.local[0]);
+}
+
+/**
+ * Non-blocking writes through references obtained before write-combining
+ * was disabled.
+ */
+TEST_F(GlobAsyncRefTest, WriteCombiningDisabledRef) {
+  dash::Array<int> array(dash::size());
+  array.barrier();
+  size_t lneighbor = (dash::myid() + dash::size() - 1) % dash::size();
+
+  array.async.write_combining();
+  auto ref = array.async[lneighbor];
+  ref = 1;
+  array.async.write_combining(false);
+  // The buffer of combined writes is destroyed, the write is transferred
+  // individually:
+  ref = 2;
+  array.async.flush();
+
+  dash::barrier();
+  ASSERT_EQ_U(2, array.local[0]);
+}
+
+/**
+ * Non-blocking writes queued before the array is moved.
+ */
+TEST_F(GlobAsyncRefTest, WriteCombiningMove) {
+  dash::Array<int> array(dash::size() * 2);
+  array.barrier();
+  size_t lneighbor = (dash::myid() + dash::size() - 1) % dash::size();
+
+  array.async.write_combining();
+  array.async[lneighbor * 2] = 1;
+  // Queued writes are moved with the array:
+  dash::Array<int> moved(std::move(array));
+  ASSERT_TRUE_U(moved.async.is_write_combining());
+  ASSERT_FALSE_U(array.async.is_write_combining());
+  moved.async[lneighbor * 2 + 1] = 2;
+
+  dash::Array<int> assigned;
+  assigned = std::move(moved);
+  ASSERT_TRUE_U(assigned.async.is_write_combining());
+  assigned.barrier();
+  ASSERT_EQ_U(1, assigned.local[0]);
+  ASSERT_EQ_U(2, assigned.local[1]);
+  assigned.async.write_combining(false);
+}
+
+/**
+ * Scattered and repeated non-blocking writes combined per target unit.
+ */
+TEST_F(GlobAsyncRefTest, WriteCombiningScatter) {
+  struct particle {
+    int    id;
+    double pos;
+  };
+  int num_elem_per_unit = 600;
+  size_t nelem          = dash::size() * num_elem_per_unit;
+  dash::Array<particle> array(nelem);
+  for (auto li = 0; li < array.lcapacity(); ++li) {
+    array.local[li] = particle { -1, 0.0 };
+  }
+  array.barrier();
+
+  // small capacity to issue transfers before flush:
+  array.async.write_combining(true, 100);
+  // Every unit writes to elements with global index i where
+  // i % size == myid, every other element twice:
+  for (size_t gi = dash::myid(); gi < nelem; gi += 2 * dash::size()) {
+    array.async[gi] = particle { -2, 0.0 };
+  }
+  for (size_t gi = dash::myid(); gi < nelem; gi += dash::size()) {
+    array.async[gi] = particle { static_cast<int>(gi), gi * 0.5 };
+  }
+  // Array barrier completes combined writes:
+  array.barrier();
+
+  for (auto li = 0; li < array.lcapacity(); ++li) {
+    particle p = array.local[li];
+    size_t   gi = array.pattern().global(li);
+    ASSERT_EQ_U(static_cast<int>(gi), p.id);
+    ASSERT_EQ_U(gi * 0.5, p.pos);
+  }
+  array.barrier();
+}
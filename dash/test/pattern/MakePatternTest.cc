@@ -129,3 +129,33 @@ TEST_F(MakePatternTest, VarArgTags)
       decltype(stride_pattern)
     >::type::blocked);
 }
+
+TEST_F(MakePatternTest, MultipleMappingSquareBlocks)
+{
+  size_t extent_x   = 20 * dash::size();
+  size_t extent_y   = 20 * dash::size();
+  auto sizespec     = dash::SizeSpec<2>(extent_x, extent_y);
+  auto teamspec     = dash::TeamSpec<2>(dash::size(), 1);
+
+  // Tiled pattern mapping more than one block to every unit, as deduced
+  // for operands of dash::summa:
+  auto tile_pattern = dash::make_pattern<
+                        pattern_partitioning_properties<
+                          pattern_partitioning_tag::rectangular,
+                          pattern_partitioning_tag::balanced
+                        >,
+                        pattern_mapping_properties<
+                          // more than one block for every process
+                          pattern_mapping_tag::multiple,
+                          pattern_mapping_tag::unbalanced
+                        >,
+                        pattern_layout_properties<
+                          pattern_layout_tag::blocked,
+                          pattern_layout_tag::linear
+                        >
+                      >(sizespec, teamspec);
+  // Blocks have the smallest extent of balanced blocks in all dimensions:
+  EXPECT_EQ_U(20, tile_pattern.block(0).extent(0));
+  EXPECT_EQ_U(20, tile_pattern.block(0).extent(1));
+  EXPECT_EQ_U(dash::size(), tile_pattern.local_blockspec().size());
+}
@@ -2,6 +2,7 @@
 #include "TeamTest.h"
 
 #include <dash/Team.h>
+#include <dash/Collective.h>
 #include <dash/Array.h>
 #include <dash/Distribution.h>
 #include <dash/Dimensional.h>
@@ -106,3 +107,82 @@ TEST_F(TeamTest, SplitTeamSync)
   }
 }
 
+
+TEST_F(TeamTest, BarrierAsync)
+{
+  auto & team = dash::Team::All();
+  dash::Array<int> arr(team.size(), team);
+  arr.local[0] = team.myid().id + 1;
+
+  auto fut = team.barrier_async();
+  // Local work overlapping the barrier:
+  int local_sum = 0;
+  for (int i = 0; i < 1000; ++i) {
+    local_sum += i % 7;
+  }
+  fut.wait();
+  ASSERT_TRUE_U(fut.test());
+  ASSERT_GT_U(local_sum, 0);
+
+  // All units entered the barrier after writing their local element:
+  for (size_t u = 0; u < team.size(); ++u) {
+    ASSERT_EQ_U(static_cast<int>(u + 1), static_cast<int>(arr[u]));
+  }
+
+  // Assigning to a future of a pending barrier completes the barrier
+  // before the future takes over the new operation:
+  auto fut_next = team.barrier_async();
+  fut_next      = team.barrier_async();
+  fut_next.wait();
+  ASSERT_TRUE_U(fut_next.test());
+  team.barrier();
+}
+
+TEST_F(TeamTest, AsyncCollectives)
+{
+  auto & team   = dash::Team::All();
+  int    myid   = team.myid().id;
+  int    nunits = team.size();
+
+  auto fut_sum = dash::allreduce_async(myid + 1);
+  auto fut_max = dash::allreduce_async(static_cast<double>(myid),
+                                       dash::max<double>());
+
+  std::vector<long> in { myid, 2L * myid };
+  std::vector<long> out(2);
+  auto fut_arr = dash::allreduce_async(in.data(), in.data() + in.size(),
+                                       out.data(), dash::plus<long>());
+
+  std::vector<int> bcast(3, myid);
+  auto fut_bcast = dash::broadcast_async(bcast.data(), bcast.data() + 3,
+                                         dash::team_unit_t(nunits - 1));
+
+  std::vector<int> gathered(nunits * 2);
+  int pair[2] = { myid, -myid };
+  auto fut_gather = dash::allgather_async(pair, pair + 2, gathered.data());
+
+  ASSERT_EQ_U(nunits * (nunits + 1) / 2, fut_sum.get());
+  ASSERT_EQ_U(static_cast<double>(nunits - 1), fut_max.get());
+
+  ASSERT_EQ_U(out.data() + 2, fut_arr.get());
+  long id_sum = static_cast<long>(nunits) * (nunits - 1) / 2;
+  ASSERT_EQ_U(id_sum,     out[0]);
+  ASSERT_EQ_U(2 * id_sum, out[1]);
+
+  ASSERT_EQ_U(bcast.data() + 3, fut_bcast.get());
+  for (auto value : bcast) {
+    ASSERT_EQ_U(nunits - 1, value);
+  }
+
+  ASSERT_EQ_U(gathered.data() + gathered.size(), fut_gather.get());
+  for (int u = 0; u < nunits; ++u) {
+    ASSERT_EQ_U(u,  gathered[2 * u]);
+    ASSERT_EQ_U(-u, gathered[2 * u + 1]);
+  }
+
+  // Assigning to a future of a pending allreduce completes the allreduce
+  // before the future takes over the new operation:
+  auto fut_next = dash::allreduce_async(myid + 1);
+  fut_next      = dash::allreduce_async(2 * (myid + 1));
+  ASSERT_EQ_U(nunits * (nunits + 1), fut_next.get());
+}
@@ -4,6 +4,7 @@
 #include <dash/Atomic.h>
 #include <dash/Array.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
 #include <dash/Matrix.h>
 #include <dash/Shared.h>
 
@@ -22,6 +23,10 @@
 #include <numeric>
 #include <thread>
 #include <chrono>
+#include <mutex>
+#if __cplusplus >= 201402L
+#include <shared_mutex>
+#endif
 
 
 TEST_F(AtomicTest, FetchAndOp)
@@ -508,6 +513,66 @@ TEST_F(AtomicTest, MutexInterface){
 }
 
 
+TEST_F(AtomicTest, SharedMutexInterface){
+  dash::SharedMutex mx;
+
+  dash::Shared<int> shared(dash::team_unit_t{0});
+
+  if(dash::myid() == 0){
+    shared.set(0);
+  }
+  dash::barrier();
+
+  {
+    std::lock_guard<dash::SharedMutex> lg(mx);
+    int tmp = shared.get();
+    shared.set(tmp + 1);
+  }
+
+  dash::barrier();
+
+  // all units hold the lock for reading at the same time
+  mx.lock_shared();
+  dash::barrier();
+  EXPECT_EQ_U(static_cast<int>(dash::size()),
+              static_cast<int>(shared.get()));
+  EXPECT_FALSE_U(mx.try_lock_for(std::chrono::milliseconds(1)));
+  dash::barrier();
+  mx.unlock_shared();
+
+  dash::barrier();
+
+#if __cplusplus >= 201402L
+  {
+    std::shared_lock<dash::SharedMutex> sl(mx, std::chrono::seconds(10));
+    EXPECT_TRUE_U(sl.owns_lock());
+    EXPECT_EQ_U(static_cast<int>(dash::size()),
+                static_cast<int>(shared.get()));
+  }
+#endif
+
+  while(!mx.try_lock()){  }
+  int tmp = shared.get();
+  shared.set(tmp + 1);
+  mx.unlock();
+
+  dash::barrier();
+
+  if(dash::myid() == 0){
+    int result = shared.get();
+    EXPECT_EQ_U(result, static_cast<int>(dash::size()*2));
+  }
+
+  // moved mutexes are destroyed once
+  dash::SharedMutex moved(std::move(mx));
+  dash::SharedMutex assigned;
+  assigned = std::move(moved);
+  {
+    std::lock_guard<dash::SharedMutex> lg(assigned);
+  }
+  dash::barrier();
+}
+
 TEST_F(AtomicTest, AtomicSignal){
   using value_t = int;
   using atom_t  = dash::Atomic<value_t>;
@@ -0,0 +1,122 @@
+
+#include "CommStatsTest.h"
+
+#include <dash/util/CommStats.h>
+#include <dash/Array.h>
+
+#include <string>
+
+
+TEST_F(CommStatsTest, CountPutGetPerTarget) {
+  using dash::util::CommStats;
+
+  const int nelem_per_unit = 10;
+  dash::Array<int> array(nelem_per_unit * dash::size());
+  std::fill(array.lbegin(), array.lend(), dash::myid().id);
+
+  bool was_enabled = CommStats::enabled();
+  CommStats::enable();
+  EXPECT_TRUE_U(CommStats::enabled());
+  array.barrier();
+  CommStats::reset();
+  CommStats before;
+
+  // Read one element from the right neighbor, write one to the left:
+  auto right = (dash::myid().id + 1) % dash::size();
+  auto left  = (dash::myid().id + dash::size() - 1) % dash::size();
+  int value  = array[right * nelem_per_unit];
+  EXPECT_EQ_U(right, value);
+  array[left * nelem_per_unit + 1] = dash::myid().id;
+  array.flush();
+
+  CommStats after;
+  array.barrier();
+  CommStats::enable(was_enabled);
+
+  CommStats diff = after - before;
+  EXPECT_EQ_U(dash::size(), diff.size());
+  const auto & get_stats = diff.target(dash::team_unit_t(right));
+  const auto & put_stats = diff.target(dash::team_unit_t(left));
+  EXPECT_EQ_U(1u, get_stats.get_ops);
+  EXPECT_EQ_U(sizeof(int), get_stats.get_bytes);
+  EXPECT_EQ_U(1u, put_stats.put_ops);
+  EXPECT_EQ_U(sizeof(int), put_stats.put_bytes);
+  EXPECT_EQ_U(2u, diff.total().total.get_ops + diff.total().total.put_ops);
+  EXPECT_EQ_U(2u, diff.total().total.local_ops +
+                  diff.total().total.shmem_ops +
+                  diff.total().total.mpi_ops);
+  EXPECT_GE_U(diff.total().total.flush_ops, 1u);
+
+  std::string json = diff.to_json();
+  LOG_MESSAGE("CommStats: get ops:%lu put ops:%lu",
+              static_cast<unsigned long>(diff.total().total.get_ops),
+              static_cast<unsigned long>(diff.total().total.put_ops));
+  EXPECT_NE_U(std::string::npos, json.find("\"targets\":["));
+  EXPECT_NE_U(std::string::npos,
+              json.find("\"unit\":" + std::to_string(right) + ","));
+}
+
+TEST_F(CommStatsTest, DisabledDoesNotCount) {
+  using dash::util::CommStats;
+
+  dash::Array<int> array(dash::size());
+  array.local[0] = dash::myid().id;
+
+  bool was_enabled = CommStats::enabled();
+  CommStats::enable(false);
+  array.barrier();
+  CommStats::reset();
+
+  int value = array[(dash::myid().id + 1) % dash::size()];
+  EXPECT_EQ_U((dash::myid().id + 1) % dash::size(), value);
+  array.barrier();
+
+  CommStats stats;
+  CommStats::enable(was_enabled);
+  EXPECT_EQ_U(0u, stats.total().total.get_ops);
+  EXPECT_EQ_U(0u, stats.total().coll_ops);
+}
+
+TEST_F(CommStatsTest, WaitAccountedToHandleTeam) {
+  using dash::util::CommStats;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+
+  auto & team = dash::Team::All().split(2);
+  dash::Array<int> array(team.size(), team);
+  array.local[0] = team.myid().id;
+
+  bool was_enabled = CommStats::enabled();
+  CommStats::enable();
+  array.barrier();
+  CommStats::reset();
+  CommStats::reset(team);
+
+  // waiting on a non-blocking collective is collective time only
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK, dart_ibarrier(team.dart_id(), &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(&handle));
+
+  int value;
+  auto right = (team.myid().id + 1) % team.size();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_handle(&value, array[right].dart_gptr(), 1,
+                    DART_TYPE_INT, DART_TYPE_INT, &handle));
+  // transfers in shared memory are complete without a handle
+  uint64_t num_waits = (handle != DART_HANDLE_NULL) ? 1 : 0;
+  ASSERT_EQ_U(DART_OK, dart_wait(&handle));
+  EXPECT_EQ_U(right, value);
+
+  CommStats all_stats;
+  CommStats team_stats(team);
+  array.barrier();
+  CommStats::enable(was_enabled);
+
+  EXPECT_EQ_U(1u, team_stats.total().coll_ops);
+  EXPECT_EQ_U(num_waits, team_stats.total().wait_ops);
+  EXPECT_EQ_U(0u, all_stats.total().coll_ops);
+  EXPECT_EQ_U(0u, all_stats.total().wait_ops);
+}
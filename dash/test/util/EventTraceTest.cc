@@ -0,0 +1,76 @@
+
+#include "EventTraceTest.h"
+
+#include <dash/util/EventTrace.h>
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+TEST_F(EventTraceTest, InternNames) {
+  using dash::util::EventTrace;
+
+  auto id_a = EventTrace::intern("EventTraceTest.a");
+  auto id_b = EventTrace::intern("EventTraceTest.b");
+  EXPECT_NE_U(id_a, id_b);
+  EXPECT_EQ_U(id_a, EventTrace::intern("EventTraceTest.a"));
+  EXPECT_EQ_U("EventTraceTest.b", EventTrace::name(id_b));
+}
+
+TEST_F(EventTraceTest, RecordAndMergeChromeTrace) {
+  using dash::util::EventTrace;
+
+  if (EventTrace::enabled()) {
+    SKIP_TEST_MSG("event trace already enabled by DASH_EVENT_TRACE_PATH");
+  }
+
+  const int nelem_per_unit = 100;
+  dash::Array<int> array(nelem_per_unit * dash::size());
+  std::fill(array.lbegin(), array.lend(), dash::myid().id);
+  array.barrier();
+
+  ASSERT_TRUE_U(EventTrace::start("/tmp"));
+  EXPECT_TRUE_U(EventTrace::enabled());
+  {
+    DASH_EVENT_TRACE_SCOPE("EventTraceTest.phase");
+    std::vector<int> buf(array.size());
+    dash::copy(array.begin(), array.end(), buf.data());
+    EventTrace::instant(EventTrace::intern("EventTraceTest.instant"), 42);
+  }
+  array.barrier();
+  std::string filename = EventTrace::filename();
+  EventTrace::stop();
+  EXPECT_FALSE_U(EventTrace::enabled());
+  EXPECT_EQ_U(0ULL, EventTrace::dropped());
+
+  // Events after stop are not recorded:
+  {
+    DASH_EVENT_TRACE_SCOPE("EventTraceTest.stopped");
+  }
+
+  std::ostringstream os;
+  auto num_events = EventTrace::merge_chrome_trace({ filename }, os);
+  std::string json = os.str();
+  // begin and end of phase, copy and barrier, instant event:
+  EXPECT_GE_U(num_events, 7u);
+  EXPECT_NE_U(std::string::npos, json.find("\"traceEvents\""));
+  EXPECT_NE_U(std::string::npos, json.find("EventTraceTest.phase"));
+  EXPECT_NE_U(std::string::npos, json.find("EventTraceTest.instant"));
+  EXPECT_NE_U(std::string::npos, json.find("\"dash::copy\""));
+  EXPECT_NE_U(std::string::npos, json.find("\"dart_barrier\""));
+  EXPECT_EQ_U(std::string::npos, json.find("EventTraceTest.stopped"));
+  std::ostringstream unit_name;
+  unit_name << "\"unit " << dash::myid().id << "\"";
+  EXPECT_NE_U(std::string::npos, json.find(unit_name.str()));
+  if (dash::size() > 1) {
+    // Remote elements are fetched with DART operations:
+    EXPECT_NE_U(std::string::npos, json.find("\"dart_get_handle\""));
+  }
+
+  array.barrier();
+  std::remove(filename.c_str());
+}